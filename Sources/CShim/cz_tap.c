@@ -45,28 +45,100 @@
 #define IFF_NO_PI 0x1000
 #endif
 
-int cz_tap_create(const char *requested_name, char *out_name, size_t out_name_len) {
-    if (out_name == NULL || out_name_len < IFNAMSIZ) {
-        return -EINVAL;
+/*
+ * Multi-queue support, same encoding as TUNSETIFF:
+ *   TUNSETOFFLOAD   = _IOW('T', 208, unsigned int) = 0x400454D0
+ *   TUNSETVNETHDRSZ = _IOW('T', 216, int)          = 0x400454D8
+ *   TUNSETQUEUE     = _IOW('T', 217, int)          = 0x400454D9
+ */
+#ifndef TUNSETOFFLOAD
+#define TUNSETOFFLOAD 0x400454D0u
+#endif
+#ifndef TUNSETVNETHDRSZ
+#define TUNSETVNETHDRSZ 0x400454D8u
+#endif
+#ifndef TUNSETQUEUE
+#define TUNSETQUEUE 0x400454D9u
+#endif
+#ifndef IFF_MULTI_QUEUE
+#define IFF_MULTI_QUEUE 0x0100
+#endif
+#ifndef IFF_DETACH_QUEUE
+#define IFF_DETACH_QUEUE 0x0400
+#endif
+#ifndef IFF_VNET_HDR
+#define IFF_VNET_HDR 0x4000
+#endif
+#ifndef TUN_F_CSUM
+#define TUN_F_CSUM 0x01
+#endif
+#ifndef TUN_F_TSO4
+#define TUN_F_TSO4 0x02
+#endif
+#ifndef TUN_F_TSO6
+#define TUN_F_TSO6 0x04
+#endif
+
+/* sizeof(struct virtio_net_hdr_v1), the header cloud-hypervisor uses. */
+#define CZ_VNET_HDR_SIZE 12
+
+static short cz_tap_flags(int multi_queue) {
+    if (multi_queue) {
+        return IFF_TAP | IFF_NO_PI | IFF_VNET_HDR | IFF_MULTI_QUEUE;
     }
+    return IFF_TAP | IFF_NO_PI;
+}
 
+static int cz_tap_attach(const char *name, int multi_queue, struct ifreq *ifr) {
     int fd = open("/dev/net/tun", O_RDWR | O_CLOEXEC);
     if (fd < 0) {
         return -errno;
     }
 
-    struct ifreq ifr;
-    memset(&ifr, 0, sizeof(ifr));
-    ifr.ifr_flags = IFF_TAP | IFF_NO_PI;
-    if (requested_name != NULL && requested_name[0] != '\0') {
-        strncpy(ifr.ifr_name, requested_name, IFNAMSIZ - 1);
+    memset(ifr, 0, sizeof(*ifr));
+    ifr->ifr_flags = cz_tap_flags(multi_queue);
+    if (name != NULL && name[0] != '\0') {
+        strncpy(ifr->ifr_name, name, IFNAMSIZ - 1);
     }
 
-    if (ioctl(fd, TUNSETIFF, &ifr) < 0) {
+    if (ioctl(fd, TUNSETIFF, ifr) < 0) {
         int saved = errno;
         close(fd);
         return -saved;
     }
+    return fd;
+}
+
+int cz_tap_create(const char *requested_name, int multi_queue, char *out_name, size_t out_name_len) {
+    if (out_name == NULL || out_name_len < IFNAMSIZ) {
+        return -EINVAL;
+    }
+
+    struct ifreq ifr;
+    int fd = cz_tap_attach(requested_name, multi_queue, &ifr);
+    if (fd < 0) {
+        return fd;
+    }
+
+    if (multi_queue) {
+        /* Header size and offloads are per-device; set them before the VMM
+         * attaches its queues so the first packets already carry them. The
+         * VMM re-applies offloads once the guest negotiates features. */
+        int hdr_size = CZ_VNET_HDR_SIZE;
+        unsigned int offload = TUN_F_CSUM | TUN_F_TSO4 | TUN_F_TSO6;
+        /* Detach this queue: it only keeps the device alive and must not be
+         * picked for packets bound to the guest. A detached queue still
+         * counts toward the device's lifetime. */
+        struct ifreq detach;
+        memset(&detach, 0, sizeof(detach));
+        detach.ifr_flags = IFF_DETACH_QUEUE;
+        if (ioctl(fd, TUNSETVNETHDRSZ, &hdr_size) < 0 || ioctl(fd, TUNSETOFFLOAD, offload) < 0
+            || ioctl(fd, TUNSETQUEUE, &detach) < 0) {
+            int saved = errno;
+            close(fd);
+            return -saved;
+        }
+    }
 
     /* Copy out the resolved name. ifr.ifr_name is always NUL-terminated
      * within IFNAMSIZ by the kernel. */
@@ -75,4 +147,12 @@ int cz_tap_create(const char *requested_name, char *out_name, size_t out_name_le
     return fd;
 }
 
+int cz_tap_open_queue(const char *name, int multi_queue) {
+    if (name == NULL || name[0] == '\0') {
+        return -EINVAL;
+    }
+    struct ifreq ifr;
+    return cz_tap_attach(name, multi_queue, &ifr);
+}
+
 #endif /* __linux__ */
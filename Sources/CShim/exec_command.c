@@ -16,6 +16,11 @@
 
 #if defined(__linux__) || defined(__APPLE__)
 
+#if defined(__linux__)
+// clone(2) is _GNU_SOURCE-only in both glibc and musl.
+#define _GNU_SOURCE
+#endif
+
 #include <errno.h>
 #include <fcntl.h>
 #include <dirent.h>
@@ -33,6 +38,9 @@
 #include <sys/wait.h>
 #include <unistd.h>
 #if defined(__linux__)
+#include <sched.h>
+#include <stdint.h>
+#include <sys/mman.h>
 #include <sys/prctl.h>
 #endif
 
@@ -46,6 +54,10 @@
 #define CLOSE_RANGE_CLOEXEC 0x4
 #endif
 
+#if defined(__linux__) && !defined(SYS_pidfd_open)
+#define SYS_pidfd_open 434
+#endif
+
 static int mark_cloexec(int fd) {
     int flags = fcntl(fd, F_GETFD);
 
@@ -55,18 +67,60 @@ static int mark_cloexec(int fd) {
     return fcntl(fd, F_SETFD, flags | FD_CLOEXEC);
 }
 
-static int cloexec_from(int min_fd) {
 #if defined(__linux__)
-    // First try close_range.
-    long ret = syscall(SYS_close_range, min_fd, ~0U, CLOSE_RANGE_CLOEXEC);
-    if (ret == 0) {
-      return 0;
+struct linux_dirent64 {
+  uint64_t d_ino;
+  int64_t d_off;
+  unsigned short d_reclen;
+  unsigned char d_type;
+  char d_name[];
+};
+
+// Runs in the vfork child, which shares the parent's memory while other
+// parent threads keep running: no malloc, so no opendir.
+static int cloexec_from(int min_fd) {
+  // First try close_range.
+  long ret = syscall(SYS_close_range, min_fd, ~0U, CLOSE_RANGE_CLOEXEC);
+  if (ret == 0) {
+    return 0;
+  }
+
+  int dp_fd = open("/proc/self/fd", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (dp_fd < 0) return -1;
+
+  char buf[1024] __attribute__((aligned(8)));
+  for (;;) {
+    long n = syscall(SYS_getdents64, dp_fd, buf, sizeof(buf));
+    if (n < 0) {
+      close(dp_fd);
+      return -1;
     }
-    const char* dirpath = "/proc/self/fd";
+    if (n == 0) break;
+
+    for (long off = 0; off < n;) {
+      struct linux_dirent64 *de = (struct linux_dirent64 *)(buf + off);
+      off += de->d_reclen;
+      if (de->d_name[0] == '.') continue;
+
+      char *end;
+      long val = strtol(de->d_name, &end, 10);
+      if (*end || val < 0 || val > INT_MAX) continue;
+
+      int fd = (int)val;
+      if (fd < min_fd || fd == dp_fd) continue;
+
+      if (mark_cloexec(fd) != 0) {
+        close(dp_fd);
+        return -1;
+      }
+    }
+  }
+  close(dp_fd);
+  return 0;
+}
 #elif defined(__APPLE__)
-    const char* dirpath = "/dev/fd";
-#endif
-    DIR *dp = opendir(dirpath);
+static int cloexec_from(int min_fd) {
+    DIR *dp = opendir("/dev/fd");
     if (!dp) return -1;
 
     int dp_fd = dirfd(dp);
@@ -91,6 +145,7 @@ static int cloexec_from(int min_fd) {
     closedir(dp);
     return 0;
 }
+#endif
 
 void exec_command_attrs_init(struct exec_command_attrs *attrs) {
   attrs->setpgid = 0;
@@ -139,12 +194,16 @@ static void child_handler(const int sync_pipes[2], const char *executable,
     }
   }
 
-  // clear sighandlers
+  // clear sighandlers. On Linux this is also what keeps a parent handler
+  // from running on the vfork child's stack once the mask is cleared.
   action.sa_flags = 0;
   action.sa_handler = SIG_DFL;
   sigemptyset(&action.sa_mask);
-  for (i = 0; i < NSIG; i++) {
-    sigaction(i, &action, 0);
+  for (i = 1; i < NSIG; i++) {
+    struct sigaction current;
+    if (sigaction(i, NULL, &current) == 0 && current.sa_handler != SIG_DFL) {
+      sigaction(i, &action, 0);
+    }
   }
 
   sigset_t local_mask;
@@ -283,6 +342,21 @@ static void child_handler(const int sync_pipes[2], const char *executable,
     goto fail;
   }
 
+#if defined(__linux__)
+  // The libc wrappers broadcast id changes to every thread of the process,
+  // which for the vfork child are the parent's threads. Change only ours.
+  if (attrs.gid != -1) {
+    if (syscall(SYS_setgid, attrs.gid) != 0) {
+      goto fail;
+    }
+  }
+
+  if (attrs.uid != -1) {
+    if (syscall(SYS_setreuid, attrs.uid, attrs.uid) != 0) {
+      goto fail;
+    }
+  }
+#else
   // set gid
   if (attrs.gid != -1) {
     if (setgid(attrs.gid) != 0) {
@@ -296,6 +370,7 @@ static void child_handler(const int sync_pipes[2], const char *executable,
       goto fail;
     }
   }
+#endif
 
   if (cwd != NULL) {
     if (chdir(cwd)) {
@@ -311,8 +386,34 @@ fail:
     while (write(syncfd, &err, sizeof(err)) < 0)
       ;
   }
-  exit(127);
+  // _exit: atexit handlers and stdio buffers belong to the parent.
+  _exit(127);
+}
+
+#if defined(__linux__)
+// Stack for the vfork child, on top of its fd table.
+#define CHILD_STACK_SIZE (64 * 1024)
+
+struct child_args {
+  const int *sync_pipes;
+  const char *executable;
+  char *const *args;
+  char *const *environment;
+  const int *file_handles;
+  int file_handle_count;
+  const char *cwd;
+  sigset_t old_mask;
+  struct exec_command_attrs attrs;
+};
+
+static int child_entry(void *arg) {
+  const struct child_args *a = arg;
+  child_handler(a->sync_pipes, a->executable, a->args, a->environment,
+                a->file_handles, a->file_handle_count, a->cwd, a->old_mask,
+                a->attrs);
+  _exit(127);
 }
+#endif
 
 int exec_command(pid_t *result, const char *executable, char *const args[],
                  char *const envp[], const int file_handles[],
@@ -327,15 +428,53 @@ int exec_command(pid_t *result, const char *executable, char *const args[],
   sigfillset(&all);
 
   if (pipe(sync_pipe)) {
-    goto fail;
+    return -1;
   }
 
   if (pthread_sigmask(SIG_SETMASK, &all, &old_mask) < 0) {
-    goto fail;
+    close(sync_pipe[0]);
+    close(sync_pipe[1]);
+    return -1;
   }
 
+#if defined(__linux__)
+  // The child borrows our address space until it execs or exits, so
+  // spawning costs the same however large this process is; fork() would
+  // copy its page tables first. We stay suspended until then.
+  struct child_args child = {
+      .sync_pipes = sync_pipe,
+      .executable = executable,
+      .args = args,
+      .environment = envp,
+      .file_handles = file_handles,
+      .file_handle_count = file_handle_count,
+      .cwd = working_directory,
+      .old_mask = old_mask,
+      .attrs = *attrs,
+  };
+  size_t stack_size = CHILD_STACK_SIZE + file_handle_count * sizeof(int);
+  void *stack = mmap(NULL, stack_size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+  if (stack == MAP_FAILED) {
+    err = errno;
+    close(sync_pipe[0]);
+    close(sync_pipe[1]);
+    goto fail;
+  }
+  pid = clone(child_entry, (char *)stack + stack_size,
+              CLONE_VM | CLONE_VFORK | SIGCHLD, &child);
+  err = errno;
+  munmap(stack, stack_size);
+  if (pid == -1) {
+    close(sync_pipe[0]);
+    close(sync_pipe[1]);
+    goto fail;
+  }
+  err = 0;
+#else
   pid = fork();
   if (pid == -1) {
+    err = errno;
     close(sync_pipe[0]);
     close(sync_pipe[1]);
     goto fail;
@@ -345,8 +484,9 @@ int exec_command(pid_t *result, const char *executable, char *const args[],
     // hand off to child
     child_handler(sync_pipe, executable, args, envp, file_handles,
                   file_handle_count, working_directory, old_mask, *attrs);
-    exit(EXIT_FAILURE);
+    _exit(EXIT_FAILURE);
   }
+#endif
 
   // handle parent operations
   if (close(sync_pipe[1]) < 0) {
@@ -385,9 +525,17 @@ fail:
   }
   if (err) {
     printf("exec_command execve: %s\n", strerror(err));
+    errno = err;
     return -1;
   }
   return 0;
 }
 
+#if defined(__linux__)
+int exec_command_pidfd_open(pid_t pid) {
+  // Musl doesn't have pidfd_open.
+  return (int)syscall(SYS_pidfd_open, pid, 0);
+}
+#endif
+
 #endif
\ No newline at end of file
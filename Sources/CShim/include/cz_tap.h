@@ -27,6 +27,11 @@
  * kernel may rename it on collision (rare). If NULL or empty, the kernel
  * picks a name like "tap%d".
  *
+ * If `multi_queue` is non-zero the device is created with IFF_MULTI_QUEUE and
+ * IFF_VNET_HDR (the flags a VMM uses to open more than one queue pair), a
+ * virtio-net header size and checksum/TSO offloads. The returned fd's queue
+ * is then detached, so it holds the device without receiving packets.
+ *
  * Returns the open fd on success, -errno on failure.
  *
  * Linux-only — the implementation in cz_tap.c is gated on __linux__. The
@@ -34,6 +39,15 @@
  * regardless of whose target's preprocessor defines reach the modulemap.
  * On non-Linux targets the symbol is not provided; do not call.
  */
-int cz_tap_create(const char *requested_name, char *out_name, size_t out_name_len);
+int cz_tap_create(const char *requested_name, int multi_queue, char *out_name, size_t out_name_len);
+
+/*
+ * Attach one more queue to the existing TAP `name`, with the flags
+ * cz_tap_create used for it. This is what a VMM does when it opens the TAP
+ * by name.
+ *
+ * Returns the open fd on success, -errno on failure. Linux-only.
+ */
+int cz_tap_open_queue(const char *name, int multi_queue);
 
 #endif /* __CZ_TAP_H */
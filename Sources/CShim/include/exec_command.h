@@ -52,5 +52,10 @@ int exec_command(pid_t *result, const char *executable, char *const argv[],
                  const int file_handle_count, const char *working_directory,
                  struct exec_command_attrs *attrs);
 
+#if defined(__linux__)
+/// open a pidfd for pid; -1 with errno set on failure (ENOSYS before Linux 5.3)
+int exec_command_pidfd_open(pid_t pid);
+#endif
+
 #endif /* defined(__linux__) || defined(__APPLE__) */
 #endif /* exec_command_h */
@@ -48,13 +48,18 @@ extension CloudHypervisor {
         ///   - requestTimeout: Per-request deadline. A request that does not
         ///     complete within this window fails with
         ///     ``CloudHypervisor/Error/transport(_:)``. Defaults to 30 seconds.
+        ///   - keepAlive: Reuse one persistent connection for every request
+        ///     rather than connecting per request. A GET that loses a race
+        ///     with the server closing the idle connection is retried once;
+        ///     other requests surface the transport error. Defaults to `true`.
         /// - Throws: ``CloudHypervisor/Error/invalidSocketPath(_:)`` when `socketPath`
         ///   is not a `file://` URL.
         public init(
             socketPath: URL,
             eventLoopGroup: (any EventLoopGroup)? = nil,
             logger: Logger = Logger(label: "CloudHypervisor.Client"),
-            requestTimeout: TimeAmount = .seconds(30)
+            requestTimeout: TimeAmount = .seconds(30),
+            keepAlive: Bool = true
         ) throws {
             guard socketPath.isFileURL else {
                 throw CloudHypervisor.Error.invalidSocketPath(socketPath.absoluteString)
@@ -70,7 +75,8 @@ extension CloudHypervisor {
                 socketPath: socketPath.path,
                 group: self.group,
                 logger: logger,
-                requestTimeout: requestTimeout
+                requestTimeout: requestTimeout,
+                keepAlive: keepAlive
             )
             self.encoder = JSONEncoder()
             self.decoder = JSONDecoder()
@@ -58,4 +58,19 @@ extension CloudHypervisor.Client {
     public func vmResume() async throws {
         try await put("/api/v1/vm.resume")
     }
+
+    /// Write a snapshot of the paused VM to `config.destinationUrl`.
+    ///
+    /// Maps to `PUT /api/v1/vm.snapshot` in the Cloud Hypervisor REST API.
+    public func vmSnapshot(_ config: CloudHypervisor.VmSnapshotConfig) async throws {
+        try await put("/api/v1/vm.snapshot", body: config)
+    }
+
+    /// Restore a VM from a snapshot directory. Must be issued against a VMM
+    /// with no VM created yet; the VM is left paused.
+    ///
+    /// Maps to `PUT /api/v1/vm.restore` in the Cloud Hypervisor REST API.
+    public func vmRestore(_ config: CloudHypervisor.RestoreConfig) async throws {
+        try await put("/api/v1/vm.restore", body: config)
+    }
 }
@@ -43,11 +43,21 @@ struct HTTPResponse: Sendable {
 /// `eventLoopGroupProvider: .shared(group)` so the underlying NIO group is
 /// the caller's to shut down — `httpClient.shutdown` only releases the
 /// client's own state.
+///
+/// By default requests reuse a single keep-alive connection. A client talks
+/// to exactly one per-VM socket, so the AHC pool is capped at one HTTP/1.1
+/// connection and requests are serialized over it; CH's API thread handles
+/// requests one at a time anyway, so a second connection would only add
+/// another accept and another HTTP session. That saves a UDS connect and
+/// teardown per call, which adds up for hotplug-heavy pods that issue
+/// dozens of `vm.add-*` calls back to back. If the connection is lost (CH
+/// restarted, the socket was reset) AHC opens a new one on the next request.
 final class HTTPOverUDSClient: Sendable {
     private let socketPath: String
     private let httpClient: HTTPClient
     private let logger: Logger
     private let requestTimeout: TimeAmount
+    private let keepAlive: Bool
     // One-shot flag tracking whether shutdown has been initiated, so
     // explicit `shutdown()` is idempotent and `deinit` skips its fallback
     // when an explicit shutdown already drained the HTTPClient.
@@ -57,15 +67,22 @@ final class HTTPOverUDSClient: Sendable {
         socketPath: String,
         group: any EventLoopGroup,
         logger: Logger,
-        requestTimeout: TimeAmount = .seconds(30)
+        requestTimeout: TimeAmount = .seconds(30),
+        keepAlive: Bool = true
     ) {
+        var configuration = HTTPClient.Configuration()
+        configuration.connectionPool = .init(
+            idleTimeout: .seconds(60),
+            concurrentHTTP1ConnectionsPerHostSoftLimit: 1
+        )
         self.socketPath = socketPath
         self.httpClient = HTTPClient(
             eventLoopGroupProvider: .shared(group),
-            configuration: .init()
+            configuration: configuration
         )
         self.logger = logger
         self.requestTimeout = requestTimeout
+        self.keepAlive = keepAlive
         self.didShutdown = NIOLockedValueBox(false)
     }
 
@@ -113,12 +130,14 @@ final class HTTPOverUDSClient: Sendable {
             request.headers.replaceOrAdd(name: name, value: value)
         }
 
-        // `Connection: close` is preserved from the previous transport. CH
-        // accepts both close and keep-alive, but close is the safer default
-        // until we have explicit smoke coverage of long-lived per-VM
-        // keep-alive behavior. Each request goes to a different per-VM UDS
-        // anyway so there's nothing to pool.
-        request.headers.replaceOrAdd(name: "Connection", value: "close")
+        // HTTP/1.1 connections are persistent unless either side says
+        // otherwise, so keep-alive needs no header. `Connection: close`
+        // restores the one-connection-per-request behavior.
+        if keepAlive {
+            request.headers.remove(name: "Connection")
+        } else {
+            request.headers.replaceOrAdd(name: "Connection", value: "close")
+        }
 
         // Body framing. CH's HTTP parser rejects body-less PUTs unless the
         // request carries `Content-Length: 0` instead of falling back to
@@ -151,11 +170,28 @@ final class HTTPOverUDSClient: Sendable {
         logger.debug("HTTPOverUDSClient: \(method) \(uri) → \(socketPath)")
 
         do {
-            let response = try await httpClient.execute(
-                request,
-                deadline: deadline,
-                logger: logger
-            )
+            let response: HTTPClientResponse
+            do {
+                response = try await httpClient.execute(
+                    request,
+                    deadline: deadline,
+                    logger: logger
+                )
+            } catch let error as HTTPClientError
+                where keepAlive && error == .remoteConnectionClosed && (method == .GET || method == .HEAD)
+            {
+                // The pooled connection was closed by the server between
+                // requests (e.g. CH dropped it) and AHC raced us onto it.
+                // AHC doesn't say whether the request reached CH before the
+                // close, so only reads are retried on a fresh connection:
+                // replaying a PUT such as vm.add-disk could apply it twice.
+                logger.debug("HTTPOverUDSClient: \(method) \(uri) connection closed, reconnecting")
+                response = try await httpClient.execute(
+                    request,
+                    deadline: deadline,
+                    logger: logger
+                )
+            }
 
             // 16 MiB is far larger than any CH response we expect — vm.info,
             // the largest, measures in low-KB even for many-disk VMs. The
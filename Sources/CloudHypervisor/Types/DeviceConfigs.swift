@@ -53,6 +53,13 @@ extension CloudHypervisor {
         public var pciSegment: UInt16?
         /// On-disk format of the backing file.
         public var imageType: ImageType?
+        /// Number of virtio queues.
+        public var numQueues: Int?
+        /// Size of each virtio queue.
+        public var queueSize: Int?
+        /// Allow a qcow2 image to open its backing file. Cloud Hypervisor
+        /// refuses backing files unless this is set.
+        public var backingFiles: Bool?
 
         public init(
             path: String,
@@ -61,7 +68,10 @@ extension CloudHypervisor {
             iommu: Bool? = nil,
             id: String? = nil,
             pciSegment: UInt16? = nil,
-            imageType: ImageType? = nil
+            imageType: ImageType? = nil,
+            numQueues: Int? = nil,
+            queueSize: Int? = nil,
+            backingFiles: Bool? = nil
         ) {
             self.path = path
             self.readonly = readonly
@@ -70,6 +80,9 @@ extension CloudHypervisor {
             self.id = id
             self.pciSegment = pciSegment
             self.imageType = imageType
+            self.numQueues = numQueues
+            self.queueSize = queueSize
+            self.backingFiles = backingFiles
         }
 
         enum CodingKeys: String, CodingKey {
@@ -80,6 +93,9 @@ extension CloudHypervisor {
             case id
             case pciSegment = "pci_segment"
             case imageType = "image_type"
+            case numQueues = "num_queues"
+            case queueSize = "queue_size"
+            case backingFiles = "backing_files"
         }
     }
 
@@ -0,0 +1,60 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+extension CloudHypervisor {
+    // MARK: - VmSnapshotConfig
+
+    /// Request body for `PUT /vm.snapshot`.
+    ///
+    /// Maps to `VmSnapshotConfig` in the Cloud Hypervisor OpenAPI spec. The
+    /// VM must be paused before the snapshot is taken.
+    public struct VmSnapshotConfig: Sendable, Codable, Equatable {
+        /// `file://` URL of the directory the snapshot is written into. CH
+        /// writes `config.json`, `state.json` and `memory-ranges` there.
+        public var destinationUrl: String
+
+        public init(destinationUrl: String) {
+            self.destinationUrl = destinationUrl
+        }
+
+        enum CodingKeys: String, CodingKey {
+            case destinationUrl = "destination_url"
+        }
+    }
+
+    // MARK: - RestoreConfig
+
+    /// Request body for `PUT /vm.restore`.
+    ///
+    /// Maps to `RestoreConfig` in the Cloud Hypervisor OpenAPI spec. The
+    /// restored VM comes up in the `Paused` state; call `vmResume()` to run it.
+    public struct RestoreConfig: Sendable, Codable, Equatable {
+        /// `file://` URL of a directory previously produced by `vm.snapshot`.
+        public var sourceUrl: String
+        /// Populate guest memory up front instead of faulting it in lazily.
+        public var prefault: Bool?
+
+        public init(sourceUrl: String, prefault: Bool? = nil) {
+            self.sourceUrl = sourceUrl
+            self.prefault = prefault
+        }
+
+        enum CodingKeys: String, CodingKey {
+            case sourceUrl = "source_url"
+            case prefault
+        }
+    }
+}
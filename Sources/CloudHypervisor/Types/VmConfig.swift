@@ -105,12 +105,29 @@ extension CloudHypervisor {
         /// CH otherwise rejects `vm.boot` with "Using vhost-user requires
         /// using shared memory or huge pages".
         public var shared: Bool?
+        /// Back guest RAM with hugepages from the host's hugetlbfs pool.
+        public var hugepages: Bool?
+        /// Hugepage size in bytes. The host's default hugepage size when nil.
+        public var hugepageSize: UInt64?
+        /// Populate all guest RAM (`MAP_POPULATE`) before boot.
+        public var prefault: Bool?
 
-        public init(size: UInt64, hotplugSize: UInt64? = nil, mergeable: Bool? = nil, shared: Bool? = nil) {
+        public init(
+            size: UInt64,
+            hotplugSize: UInt64? = nil,
+            mergeable: Bool? = nil,
+            shared: Bool? = nil,
+            hugepages: Bool? = nil,
+            hugepageSize: UInt64? = nil,
+            prefault: Bool? = nil
+        ) {
             self.size = size
             self.hotplugSize = hotplugSize
             self.mergeable = mergeable
             self.shared = shared
+            self.hugepages = hugepages
+            self.hugepageSize = hugepageSize
+            self.prefault = prefault
         }
 
         enum CodingKeys: String, CodingKey {
@@ -118,6 +135,9 @@ extension CloudHypervisor {
             case hotplugSize = "hotplug_size"
             case mergeable
             case shared
+            case hugepages
+            case hugepageSize = "hugepage_size"
+            case prefault
         }
     }
 
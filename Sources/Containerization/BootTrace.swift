@@ -0,0 +1,185 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import Synchronization
+
+/// A per-sandbox boot-latency timeline in the Chrome trace event format,
+/// loadable in `chrome://tracing` or Perfetto.
+///
+/// Host events are stamped with the host's `CLOCK_MONOTONIC`, guest events
+/// with the guest's. ``merging(guest:)`` lines the two clocks up using a
+/// ``clockAnchorEvent`` that both sides record for the same RPC.
+public struct BootTrace: Sendable, Codable, Equatable {
+    /// Name of the event both sides record for the RPC that fetches the
+    /// guest trace. The host records it as a span around the call, the guest
+    /// as an instant while serving it.
+    public static let clockAnchorEvent = "clockAnchor"
+
+    /// The track an event is drawn on.
+    public enum Lane: String, Sendable, Codable, CaseIterable {
+        /// `LinuxContainer` setup on the host.
+        case container
+        /// The VMM and its helper processes on the host.
+        case vmm
+        /// vminitd inside the guest.
+        case guest
+
+        var pid: Int {
+            self == .guest ? 2 : 1
+        }
+
+        var tid: Int {
+            self == .vmm ? 2 : 1
+        }
+    }
+
+    public struct Event: Sendable, Codable, Equatable {
+        public enum Kind: String, Sendable, Codable {
+            /// A span with a duration ("X").
+            case complete = "X"
+            /// A point in time ("i").
+            case instant = "i"
+        }
+
+        public var name: String
+        public var lane: Lane
+        public var kind: Kind
+        /// Start time in microseconds on the recording side's monotonic clock.
+        public var timestamp: Int64
+        /// Duration in microseconds; nil for instants.
+        public var duration: Int64?
+
+        public init(name: String, lane: Lane, kind: Kind, timestamp: Int64, duration: Int64? = nil) {
+            self.name = name
+            self.lane = lane
+            self.kind = kind
+            self.timestamp = timestamp
+            self.duration = duration
+        }
+
+        enum CodingKeys: String, CodingKey {
+            case name
+            case lane = "cat"
+            case kind = "ph"
+            case timestamp = "ts"
+            case duration = "dur"
+            case pid
+            case tid
+        }
+
+        public init(from decoder: any Decoder) throws {
+            let container = try decoder.container(keyedBy: CodingKeys.self)
+            self.name = try container.decode(String.self, forKey: .name)
+            self.lane = try container.decode(Lane.self, forKey: .lane)
+            self.kind = try container.decode(Kind.self, forKey: .kind)
+            self.timestamp = try container.decode(Int64.self, forKey: .timestamp)
+            self.duration = try container.decodeIfPresent(Int64.self, forKey: .duration)
+        }
+
+        public func encode(to encoder: any Encoder) throws {
+            var container = encoder.container(keyedBy: CodingKeys.self)
+            try container.encode(name, forKey: .name)
+            try container.encode(lane, forKey: .lane)
+            try container.encode(kind, forKey: .kind)
+            try container.encode(timestamp, forKey: .timestamp)
+            try container.encodeIfPresent(duration, forKey: .duration)
+            try container.encode(lane.pid, forKey: .pid)
+            try container.encode(lane.tid, forKey: .tid)
+        }
+    }
+
+    public var traceEvents: [Event]
+    public var displayTimeUnit: String = "ms"
+
+    public init(traceEvents: [Event] = []) {
+        self.traceEvents = traceEvents
+    }
+
+    /// Return this (host) trace with `guest`'s events appended, shifted onto
+    /// the host clock. The guest's ``clockAnchorEvent`` instant is placed at
+    /// the midpoint of the host's ``clockAnchorEvent`` span. If either side lacks
+    /// the anchor the guest events are appended unshifted.
+    public func merging(guest: BootTrace) -> BootTrace {
+        var offset: Int64 = 0
+        if let host = traceEvents.first(where: { $0.name == Self.clockAnchorEvent && $0.lane != .guest }),
+            let anchor = guest.traceEvents.first(where: { $0.name == Self.clockAnchorEvent && $0.lane == .guest })
+        {
+            offset = host.timestamp + (host.duration ?? 0) / 2 - anchor.timestamp
+        }
+
+        var merged = self
+        merged.traceEvents += guest.traceEvents.map {
+            var event = $0
+            event.timestamp += offset
+            return event
+        }
+        merged.traceEvents.sort { $0.timestamp < $1.timestamp }
+        return merged
+    }
+
+    /// The trace as Chrome trace event JSON.
+    public func jsonData() throws -> Data {
+        let encoder = JSONEncoder()
+        encoder.outputFormatting = [.sortedKeys]
+        return try encoder.encode(self)
+    }
+}
+
+/// Collects ``BootTrace`` events. Safe to record into from any task.
+public final class BootTraceRecorder: Sendable {
+    private let events: Mutex<[BootTrace.Event]>
+
+    public init() {
+        self.events = Mutex([])
+    }
+
+    /// Current `CLOCK_MONOTONIC` time in microseconds.
+    public static func now() -> Int64 {
+        var ts = timespec()
+        clock_gettime(CLOCK_MONOTONIC, &ts)
+        return Int64(ts.tv_sec) * 1_000_000 + Int64(ts.tv_nsec) / 1_000
+    }
+
+    /// Record a span from `start` to `end`, both from ``now()``.
+    public func record(_ name: String, lane: BootTrace.Lane, start: Int64, end: Int64 = BootTraceRecorder.now()) {
+        let event = BootTrace.Event(name: name, lane: lane, kind: .complete, timestamp: start, duration: max(0, end - start))
+        events.withLock { $0.append(event) }
+    }
+
+    /// Record a point in time.
+    public func instant(_ name: String, lane: BootTrace.Lane, at timestamp: Int64 = BootTraceRecorder.now()) {
+        let event = BootTrace.Event(name: name, lane: lane, kind: .instant, timestamp: timestamp)
+        events.withLock { $0.append(event) }
+    }
+
+    /// Run `body` and record it as a span, whether or not it throws.
+    public func span<T>(_ name: String, lane: BootTrace.Lane, _ body: () async throws -> T) async rethrows -> T {
+        let start = Self.now()
+        defer { record(name, lane: lane, start: start) }
+        return try await body()
+    }
+
+    /// Whether an event called `name` has been recorded.
+    public func contains(_ name: String) -> Bool {
+        events.withLock { $0.contains { $0.name == name } }
+    }
+
+    /// A snapshot of everything recorded so far.
+    public var trace: BootTrace {
+        BootTrace(traceEvents: events.withLock { $0 })
+    }
+}
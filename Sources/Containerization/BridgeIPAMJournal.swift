@@ -0,0 +1,434 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+#if os(Linux)
+import ContainerizationError
+import Foundation
+import Synchronization
+
+#if canImport(Musl)
+import Musl
+#elseif canImport(Glibc)
+import Glibc
+#endif
+
+/// On-disk record of the IPv4 addresses `LinuxBridgedNetwork` has handed
+/// out on one bridge, so assignments survive a host-process restart and
+/// are shared by every process allocating on that bridge.
+///
+/// Two files live next to the bridge's state file:
+///
+/// - `bridge-<name>.ipam`: an append-only log. A 12-byte header (magic,
+///   generation) followed by one checksummed record per allocate/release.
+/// - `bridge-<name>.ipam.snapshot`: every live assignment as of a
+///   generation, replaced atomically by rename.
+///
+/// Once the log holds `compactAfter` records the journal writes a snapshot
+/// of generation `n + 1`, fsyncs it and its directory, then resets the log
+/// to an empty generation `n + 1`. A crash between the two leaves a log
+/// older than the snapshot; recovery treats it as already folded in. A log
+/// newer than the snapshot means the rename was lost anyway (a filesystem
+/// that doesn't honour the directory fsync); its records are still
+/// replayed on top of the older snapshot rather than dropped. A torn
+/// record at the log's tail is dropped.
+///
+/// Every transaction holds the bridge's `FileLock` and first replays
+/// records other processes appended since its last one, so each allocate
+/// or release costs O(1) plus whatever the other processes wrote. Records
+/// reach the page cache on every write, so a process crash loses nothing.
+/// `fsync` runs once per `syncEvery` records: a host crash can lose at most
+/// that many trailing records, which only describe VMs that died with the
+/// host.
+final class BridgeIPAMJournal: Sendable {
+    /// One logged change.
+    enum Entry: Equatable, Sendable {
+        case allocate(id: String, address: UInt32)
+        case release(id: String, address: UInt32)
+    }
+
+    /// What changed since the caller's previous transaction.
+    enum Changes: Sendable {
+        /// Entries appended by other processes, in order.
+        case entries([Entry])
+        /// The journal was (re)loaded from disk; this is the complete set of
+        /// live assignments.
+        case reload([String: UInt32])
+    }
+
+    private struct State {
+        var fd: Int32
+        /// Generation of the log contents applied so far, or nil before the
+        /// first load.
+        var generation: UInt64?
+        /// Bytes of the log applied so far.
+        var offset: Int
+        /// Records in the log after the header.
+        var records: Int
+        /// Records written since the last `fsync`.
+        var unsynced: Int
+        var allocations: [String: UInt32]
+    }
+
+    let logPath: String
+    let snapshotPath: String
+    let lockPath: String
+    private let syncEvery: Int
+    private let compactAfter: Int
+    private let state: Mutex<State>
+
+    /// Open (creating if needed) the journal for `bridge` under `directory`.
+    init(
+        directory: URL,
+        bridge: String,
+        syncEvery: Int = 32,
+        compactAfter: Int = 4096
+    ) throws {
+        try FileManager.default.createDirectory(
+            at: directory,
+            withIntermediateDirectories: true,
+            attributes: [.posixPermissions: 0o755]
+        )
+        let paths = Self.paths(directory: directory, bridge: bridge)
+        self.logPath = paths.log
+        self.snapshotPath = paths.snapshot
+        self.lockPath = paths.lock
+        self.syncEvery = max(syncEvery, 1)
+        self.compactAfter = max(compactAfter, 1)
+        let fd = try Self.openLog(paths.log)
+        self.state = Mutex(
+            State(fd: fd, generation: nil, offset: 0, records: 0, unsynced: 0, allocations: [:]))
+    }
+
+    deinit {
+        state.withLock { state in
+            _ = fsync(state.fd)
+            close(state.fd)
+        }
+    }
+
+    /// Log, snapshot and lock paths for `bridge` under `directory`. The lock
+    /// is the one `BridgeManager` takes for `create()`/`delete()`.
+    static func paths(directory: URL, bridge: String) -> (log: String, snapshot: String, lock: String) {
+        let base = directory.appendingPathComponent("bridge-\(bridge)").path
+        return (base + ".ipam", base + ".ipam.snapshot", base + ".lock")
+    }
+
+    /// The live assignments, as of this process's last transaction.
+    var allocations: [String: UInt32] {
+        state.withLock { $0.allocations }
+    }
+
+    /// Run `body` under the bridge lock. `body` receives the changes since
+    /// this process's last transaction and a `commit` function that appends
+    /// an entry to the log; an entry is durable against process crashes
+    /// once `commit` returns.
+    func transaction<T: Sendable>(
+        _ body: (Changes, _ commit: (Entry) throws -> Void) throws -> T
+    ) throws -> T {
+        let lock = try FileLock(path: lockPath)
+        return try lock.withExclusive {
+            try state.withLock { state in
+                let changes = try catchUp(&state)
+                return try body(changes) { entry in
+                    try append(entry, to: &state)
+                }
+            }
+        }
+    }
+
+    /// Flush every record written so far to stable storage.
+    func sync() throws {
+        try state.withLock { state in
+            guard state.unsynced > 0 else {
+                return
+            }
+            try Self.check(fsync(state.fd), "fsync \(logPath)")
+            state.unsynced = 0
+        }
+    }
+
+    // MARK: - Log replay
+
+    private func catchUp(_ state: inout State) throws -> Changes {
+        // `BridgeManager.delete()` unlinks the journal; start a fresh one
+        // rather than appending to the orphaned inode.
+        var st = stat()
+        try Self.check(fstat(state.fd, &st), "fstat \(logPath)")
+        if st.st_nlink == 0 {
+            close(state.fd)
+            state.fd = try Self.openLog(logPath)
+            state.generation = nil
+        }
+
+        guard let generation = state.generation,
+            let header = try Self.read(state.fd, from: 0, count: Self.headerSize),
+            Self.decodeHeader(header, magic: Self.logMagic) == generation
+        else {
+            return .reload(try reload(&state))
+        }
+
+        let tail = try Self.read(state.fd, from: state.offset, count: nil) ?? []
+        let (entries, consumed) = Self.decodeEntries(tail[...])
+        if consumed < tail.count {
+            try truncateTornTail(&state, at: state.offset + consumed)
+        }
+        for entry in entries {
+            Self.apply(entry, to: &state.allocations)
+        }
+        state.offset += consumed
+        state.records += entries.count
+        return .entries(entries)
+    }
+
+    private func reload(_ state: inout State) throws -> [String: UInt32] {
+        var generation: UInt64 = 0
+        var allocations: [String: UInt32] = [:]
+        if let bytes = FileManager.default.contents(atPath: snapshotPath).map(Array.init) {
+            guard let snapshotGeneration = Self.decodeHeader(bytes, magic: Self.snapshotMagic) else {
+                throw ContainerizationError(.internalError, message: "invalid IPAM snapshot \(snapshotPath)")
+            }
+            let (entries, consumed) = Self.decodeEntries(bytes[Self.headerSize...])
+            guard Self.headerSize + consumed == bytes.count else {
+                throw ContainerizationError(.internalError, message: "truncated IPAM snapshot \(snapshotPath)")
+            }
+            for entry in entries {
+                Self.apply(entry, to: &allocations)
+            }
+            generation = snapshotGeneration
+        }
+
+        let log = try Self.read(state.fd, from: 0, count: nil) ?? []
+        if let logGeneration = Self.decodeHeader(log, magic: Self.logMagic), logGeneration >= generation {
+            generation = logGeneration
+            let (entries, consumed) = Self.decodeEntries(log[Self.headerSize...])
+            for entry in entries {
+                Self.apply(entry, to: &allocations)
+            }
+            state.offset = Self.headerSize + consumed
+            state.records = entries.count
+            if state.offset < log.count {
+                try truncateTornTail(&state, at: state.offset)
+            }
+        } else {
+            // Empty, unreadable, or older than the snapshot and so already
+            // folded into it.
+            try resetLog(&state, generation: generation)
+        }
+
+        state.generation = generation
+        state.allocations = allocations
+        return allocations
+    }
+
+    private func truncateTornTail(_ state: inout State, at offset: Int) throws {
+        try Self.check(ftruncate(state.fd, off_t(offset)), "ftruncate \(logPath)")
+    }
+
+    private func resetLog(_ state: inout State, generation: UInt64) throws {
+        try Self.check(ftruncate(state.fd, 0), "ftruncate \(logPath)")
+        try Self.write(state.fd, Self.encodeHeader(magic: Self.logMagic, generation: generation), at: 0)
+        try Self.check(fsync(state.fd), "fsync \(logPath)")
+        state.offset = Self.headerSize
+        state.records = 0
+        state.unsynced = 0
+    }
+
+    // MARK: - Appending
+
+    private func append(_ entry: Entry, to state: inout State) throws {
+        let bytes = Self.encode(entry)
+        try Self.write(state.fd, bytes, at: state.offset)
+        state.offset += bytes.count
+        state.records += 1
+        state.unsynced += 1
+        Self.apply(entry, to: &state.allocations)
+
+        if state.records >= compactAfter {
+            try compact(&state)
+        } else if state.unsynced >= syncEvery {
+            try Self.check(fsync(state.fd), "fsync \(logPath)")
+            state.unsynced = 0
+        }
+    }
+
+    private func compact(_ state: inout State) throws {
+        let generation = (state.generation ?? 0) + 1
+        var bytes = Self.encodeHeader(magic: Self.snapshotMagic, generation: generation)
+        for (id, address) in state.allocations.sorted(by: { $0.value < $1.value }) {
+            bytes += Self.encode(.allocate(id: id, address: address))
+        }
+
+        let temp = snapshotPath + ".tmp"
+        let fd = open(temp, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0o600)
+        try Self.check(fd, "open \(temp)")
+        do {
+            try Self.write(fd, bytes, at: 0)
+            try Self.check(fsync(fd), "fsync \(temp)")
+            close(fd)
+        } catch {
+            close(fd)
+            throw error
+        }
+        try Self.check(rename(temp, snapshotPath), "rename \(temp)")
+        // The rename must be durable before the log it replaces is reset.
+        try Self.syncDirectory(of: snapshotPath)
+
+        try resetLog(&state, generation: generation)
+        state.generation = generation
+    }
+
+    private static func apply(_ entry: Entry, to allocations: inout [String: UInt32]) {
+        switch entry {
+        case .allocate(let id, let address):
+            allocations[id] = address
+        case .release(let id, _):
+            allocations.removeValue(forKey: id)
+        }
+    }
+
+    // MARK: - Encoding
+
+    static let headerSize = 12
+    private static let logMagic: [UInt8] = Array("CZIL".utf8)
+    private static let snapshotMagic: [UInt8] = Array("CZIS".utf8)
+
+    static func encodeHeader(magic: [UInt8], generation: UInt64) -> [UInt8] {
+        magic + withUnsafeBytes(of: generation.littleEndian, Array.init)
+    }
+
+    static func decodeHeader(_ bytes: [UInt8], magic: [UInt8]) -> UInt64? {
+        guard bytes.count >= headerSize, Array(bytes[0..<4]) == magic else {
+            return nil
+        }
+        return bytes[4..<12].reversed().reduce(0) { $0 << 8 | UInt64($1) }
+    }
+
+    /// `op:u8 address:u32 idLength:u16 id checksum:u32`, little-endian, with
+    /// an FNV-1a checksum over everything before it.
+    static func encode(_ entry: Entry) -> [UInt8] {
+        let (op, id, address): (UInt8, String, UInt32) =
+            switch entry {
+            case .allocate(let id, let address): (1, id, address)
+            case .release(let id, let address): (2, id, address)
+            }
+        let idBytes = Array(id.utf8.prefix(Int(UInt16.max)))
+        var bytes: [UInt8] = [op]
+        bytes += withUnsafeBytes(of: address.littleEndian, Array.init)
+        bytes += withUnsafeBytes(of: UInt16(idBytes.count).littleEndian, Array.init)
+        bytes += idBytes
+        bytes += withUnsafeBytes(of: checksum(bytes[...]).littleEndian, Array.init)
+        return bytes
+    }
+
+    /// Decode records from the front of `bytes`, stopping at the first
+    /// incomplete or corrupt one. Returns the records and the bytes they
+    /// span.
+    static func decodeEntries(_ bytes: ArraySlice<UInt8>) -> (entries: [Entry], consumed: Int) {
+        func uint(_ slice: ArraySlice<UInt8>) -> UInt32 {
+            slice.reversed().reduce(0) { $0 << 8 | UInt32($1) }
+        }
+
+        var entries: [Entry] = []
+        var cursor = bytes.startIndex
+        while bytes.endIndex - cursor >= 11 {
+            let idLength = Int(uint(bytes[(cursor + 5)..<(cursor + 7)]))
+            let end = cursor + 7 + idLength + 4
+            guard end <= bytes.endIndex,
+                uint(bytes[(end - 4)..<end]) == checksum(bytes[cursor..<(end - 4)])
+            else {
+                break
+            }
+            let address = uint(bytes[(cursor + 1)..<(cursor + 5)])
+            let id = String(decoding: bytes[(cursor + 7)..<(end - 4)], as: UTF8.self)
+            switch bytes[cursor] {
+            case 1: entries.append(.allocate(id: id, address: address))
+            case 2: entries.append(.release(id: id, address: address))
+            default: return (entries, cursor - bytes.startIndex)
+            }
+            cursor = end
+        }
+        return (entries, cursor - bytes.startIndex)
+    }
+
+    private static func checksum(_ bytes: ArraySlice<UInt8>) -> UInt32 {
+        bytes.reduce(0x811c_9dc5) { ($0 ^ UInt32($1)) &* 0x0100_0193 }
+    }
+
+    // MARK: - File I/O
+
+    private static func syncDirectory(of path: String) throws {
+        let directory = URL(fileURLWithPath: path).deletingLastPathComponent().path
+        let fd = open(directory, O_RDONLY | O_DIRECTORY | O_CLOEXEC)
+        try check(fd, "open \(directory)")
+        defer { close(fd) }
+        try check(fsync(fd), "fsync \(directory)")
+    }
+
+    private static func openLog(_ path: String) throws -> Int32 {
+        let fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0o600)
+        try check(fd, "open \(path)")
+        return fd
+    }
+
+    /// Read `count` bytes (or to EOF when nil) at `offset`. Returns nil if
+    /// fewer than `count` bytes are available.
+    private static func read(_ fd: Int32, from offset: Int, count: Int?) throws -> [UInt8]? {
+        var st = stat()
+        try check(fstat(fd, &st), "fstat")
+        let available = max(Int(st.st_size) - offset, 0)
+        let length = count ?? available
+        guard length <= available else {
+            return nil
+        }
+        var buffer = [UInt8](repeating: 0, count: length)
+        var done = 0
+        while done < length {
+            let n = buffer.withUnsafeMutableBytes {
+                pread(fd, $0.baseAddress! + done, length - done, off_t(offset + done))
+            }
+            if n < 0 && errno == EINTR {
+                continue
+            }
+            try check(Int32(clamping: n), "pread")
+            guard n > 0 else {
+                break
+            }
+            done += n
+        }
+        return Array(buffer[0..<done])
+    }
+
+    private static func write(_ fd: Int32, _ bytes: [UInt8], at offset: Int) throws {
+        var done = 0
+        while done < bytes.count {
+            let n = bytes.withUnsafeBytes {
+                pwrite(fd, $0.baseAddress! + done, bytes.count - done, off_t(offset + done))
+            }
+            if n < 0 && errno == EINTR {
+                continue
+            }
+            try check(Int32(clamping: n), "pwrite")
+            done += n
+        }
+    }
+
+    private static func check(_ rc: Int32, _ what: String) throws {
+        guard rc >= 0 else {
+            throw ContainerizationError(.internalError, message: "\(what) failed: errno=\(errno)")
+        }
+    }
+}
+#endif
@@ -41,14 +41,16 @@ import Glibc
 /// to the host, but not to the outside world. Pass `enableNAT: true` to
 /// also enable IPv4 forwarding and program a scoped MASQUERADE/FORWARD
 /// pair (`-i <bridge> -o <egress>`); the bridge becomes a NAT exit and the
-/// host now routes guest traffic.
+/// host now routes guest traffic. The rules live in a per-bridge nftables
+/// table programmed over netlink, falling back to the `iptables` CLI when
+/// nftables is unavailable.
 ///
 /// Concurrent `create()`/`delete()` calls (e.g. from two `cctl run`
 /// processes) serialize via `flock(LOCK_EX)` on
 /// `/run/containerization/bridge-<name>.lock`.
 ///
 /// Requires root (or `CAP_NET_ADMIN` plus, when NAT is enabled, the ability
-/// to write `/proc/sys/...` and invoke `iptables`).
+/// to write `/proc/sys/...` and program nftables or invoke `iptables`).
 public struct BridgeManager: Sendable {
     public let name: String
     public let subnet: CIDRv4
@@ -207,34 +209,75 @@ public struct BridgeManager: Sendable {
             )
         }
 
-        // 6. Record state BEFORE iptables. If a later iptables -A fails,
+        // 6. Record state BEFORE the rules. If programming them fails,
         //    delete() still has authority to clean up partial rules; if we
         //    deferred the write until after, a mid-failure would orphan rules
         //    with no record.
-        let state = BridgeState(
-            natEnabled: true,
-            prevIpForward: prevIpForward,
-            egressInterface: egress
-        )
-        try state.encode().write(to: stateURL)
-
-        // 7. iptables rules — idempotent. The FORWARD rule is scoped to
-        //    `-i <bridge> -o <egress>` so the host doesn't become an
-        //    unrestricted router for guest traffic across every host iface
-        //    (e.g. a VPN or a sibling bridge).
-        try IptablesRules.ensure(
-            table: "nat",
-            args: [
-                "POSTROUTING", "-s", subnet.description, "!", "-o", name, "-j", "MASQUERADE",
+        //
+        // 7. NAT rules. The FORWARD rule is scoped to `-i <bridge> -o
+        //    <egress>` so the host doesn't become an unrestricted router for
+        //    guest traffic across every host iface (e.g. a VPN or a sibling
+        //    bridge). nftables is tried first: one netlink batch replaces
+        //    this bridge's table atomically, where iptables costs two process
+        //    spawns and an xtables-lock round per rule. A bridge whose rules
+        //    were already programmed through iptables stays on iptables so
+        //    re-runs don't stack a second copy.
+        //
+        //    Our table's forward chain only gets a say alongside every other
+        //    base chain on the forward hook: a drop in iptables-nft's
+        //    `filter` table (Docker's FORWARD policy, DOCKER-USER) or in
+        //    firewalld's table still drops, and the batch itself succeeds.
+        //    When any such chain exists the ACCEPTs have to live in that
+        //    `filter` FORWARD chain, so iptables is used instead.
+        var backend: BridgeState.NATBackend =
+            priorState?.natEnabled == true && priorState?.natBackend == .iptables ? .iptables : .nftables
+        if backend == .nftables {
+            try BridgeState(
+                natEnabled: true,
+                prevIpForward: prevIpForward,
+                egressInterface: egress,
+                natBackend: .nftables
+            ).encode().write(to: stateURL)
+            do {
+                let nft = NftablesSession(socket: try DefaultNetlinkSocket.netfilter(), log: log)
+                let foreign = try nft.foreignForwardChains(excluding: natTable)
+                if foreign.isEmpty {
+                    try nft.applyNAT(natRules(egress: egress))
+                } else {
+                    let chains = foreign.map { "\($0.table)/\($0.chain)" }.joined(separator: ", ")
+                    log.info("bridge \(name): forward hook also filtered by \(chains); using iptables")
+                    // Drop a table left by an earlier run that took the
+                    // nftables path; state now records iptables.
+                    try nft.deleteTable(natTable)
+                    backend = .iptables
+                }
+            } catch {
+                // The batch is atomic, so nothing was applied.
+                log.warning("nftables unavailable for bridge \(name) (\(error)); falling back to iptables")
+                backend = .iptables
+            }
+        }
+        if backend == .iptables {
+            try BridgeState(
+                natEnabled: true,
+                prevIpForward: prevIpForward,
+                egressInterface: egress,
+                natBackend: .iptables
+            ).encode().write(to: stateURL)
+            try IptablesRules.ensure(
+                table: "nat",
+                args: [
+                    "POSTROUTING", "-s", subnet.description, "!", "-o", name, "-j", "MASQUERADE",
+                ])
+            try IptablesRules.ensure(args: [
+                "FORWARD", "-i", name, "-o", egress, "-j", "ACCEPT",
             ])
-        try IptablesRules.ensure(args: [
-            "FORWARD", "-i", name, "-o", egress, "-j", "ACCEPT",
-        ])
-        try IptablesRules.ensure(args: [
-            "FORWARD", "-i", egress, "-o", name, "-m", "conntrack", "--ctstate", "RELATED,ESTABLISHED", "-j", "ACCEPT",
-        ])
-
-        log.info("bridge \(name) ready (subnet \(subnet), egress \(egress), NAT enabled)")
+            try IptablesRules.ensure(args: [
+                "FORWARD", "-i", egress, "-o", name, "-m", "conntrack", "--ctstate", "RELATED,ESTABLISHED", "-j", "ACCEPT",
+            ])
+        }
+
+        log.info("bridge \(name) ready (subnet \(subnet), egress \(egress), NAT enabled via \(backend.rawValue))")
     }
 
     private func deleteLocked() throws {
@@ -242,11 +285,20 @@ public struct BridgeManager: Sendable {
         let state: BridgeState? = (try? Data(contentsOf: stateURL))
             .flatMap { try? BridgeState.decode($0) }
 
-        // 1. iptables — only if a prior create() with NAT enabled left state
-        //    we own. The rules are keyed off subnet, bridge name, and the
+        // 1. NAT rules — only if a prior create() with NAT enabled left state
+        //    we own. The nftables table belongs to this bridge alone; the
+        //    iptables rules are keyed off subnet, bridge name, and the
         //    recorded egress iface, so removal is precise even when the
         //    host has rules from other tools.
-        if let state, state.natEnabled, let egress = state.egressInterface {
+        if let state, state.natEnabled, state.natBackend == .nftables {
+            log.debug("removing nftables table \(natTable) for bridge \(name)")
+            do {
+                try NftablesSession(socket: try DefaultNetlinkSocket.netfilter(), log: log)
+                    .deleteTable(natTable)
+            } catch {
+                log.warning("failed to remove nftables table \(natTable): \(error)")
+            }
+        } else if let state, state.natEnabled, let egress = state.egressInterface {
             log.debug("removing iptables rules for bridge \(name) (egress \(egress))")
             IptablesRules.remove(
                 table: "nat",
@@ -303,13 +355,28 @@ public struct BridgeManager: Sendable {
             try? Self.writeSysctl("net/ipv4/ip_forward", value: "0")
         }
 
-        // 4. Remove state file.
+        // 4. Remove state file and the bridge's IPAM journal; no address on
+        //    a deleted bridge is live.
         try? FileManager.default.removeItem(at: stateURL)
+        let ipam = BridgeIPAMJournal.paths(directory: URL(fileURLWithPath: Self.stateDir), bridge: name)
+        try? FileManager.default.removeItem(atPath: ipam.log)
+        try? FileManager.default.removeItem(atPath: ipam.snapshot)
+    }
+
+    // MARK: - NAT rules
+
+    /// The nftables table holding this bridge's NAT rules.
+    var natTable: String {
+        "containerization-\(name)"
+    }
+
+    func natRules(egress: String) -> NftablesNATRules {
+        NftablesNATRules(table: natTable, subnet: subnet, bridge: name, egress: egress)
     }
 
     // MARK: - Paths / sysctl helpers
 
-    private static let stateDir = "/run/containerization"
+    static let stateDir = "/run/containerization"
 
     private static func statePath(for name: String) -> String {
         "\(stateDir)/bridge-\(name).state"
@@ -41,16 +41,37 @@ struct BridgeState: Codable, Equatable {
     /// subnet, bridge name, and egress.
     let egressInterface: String?
 
-    init(natEnabled: Bool, prevIpForward: String? = nil, egressInterface: String? = nil) {
+    /// Which mechanism programmed the NAT rules, so `delete()` removes them
+    /// the same way. Only set when `natEnabled`. State files predating this
+    /// field are decoded as `.iptables`, the only backend at the time.
+    let natBackend: NATBackend?
+
+    /// How `BridgeManager` programs masquerade/forward rules.
+    enum NATBackend: String, Codable {
+        /// A dedicated `ip containerization-<bridge>` nftables table, written
+        /// over netlink in one atomic batch.
+        case nftables
+        /// Rules appended to the `nat`/`filter` tables by the `iptables` CLI.
+        case iptables
+    }
+
+    init(
+        natEnabled: Bool,
+        prevIpForward: String? = nil,
+        egressInterface: String? = nil,
+        natBackend: NATBackend? = nil
+    ) {
         self.natEnabled = natEnabled
         self.prevIpForward = prevIpForward
         self.egressInterface = egressInterface
+        self.natBackend = natBackend
     }
 
     enum CodingKeys: String, CodingKey {
         case natEnabled
         case prevIpForward
         case egressInterface
+        case natBackend
     }
 
     init(from decoder: Decoder) throws {
@@ -61,6 +82,9 @@ struct BridgeState: Codable, Equatable {
         self.natEnabled = try container.decodeIfPresent(Bool.self, forKey: .natEnabled) ?? true
         self.prevIpForward = try container.decodeIfPresent(String.self, forKey: .prevIpForward)
         self.egressInterface = try container.decodeIfPresent(String.self, forKey: .egressInterface)
+        self.natBackend =
+            try container.decodeIfPresent(NATBackend.self, forKey: .natBackend)
+            ?? (natEnabled ? .iptables : nil)
     }
 
     func encode() throws -> Data {
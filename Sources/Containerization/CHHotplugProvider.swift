@@ -44,20 +44,26 @@ final class CHHotplugProvider: HotplugProvider {
         var process: VirtiofsdProcess
         var refcount: Int
         var chDeviceId: String
+        /// The tuning the virtiofsd was spawned with; later users of the
+        /// same tag share it.
+        var profile: VirtiofsProfile
     }
 
     private let client: CloudHypervisor.Client
     private let workDir: URL
     private let virtiofsdBinaryOverride: URL?
     private let allocator: any AddressAllocator<Character>
+    /// Guest vCPU count; hotplugged disks default to one queue per vCPU.
+    private let cpus: Int
     private let _mounts: Mutex<[String: [AttachedFilesystem]]>
     private let _records: Mutex<[String: [HotplugRecord]]>
     private let _tags: Mutex<[String: VirtiofsdTagState]>
-    /// Serializes per-tag virtiofsd spawn so a concurrent hotplug for the
+    /// Serializes virtiofsd spawn per tag so a concurrent hotplug for the
     /// same tag can't race the existence-check / process-registration window
-    /// (TOCTOU → orphaned virtiofsd). Held across awaits, so it must be an
-    /// `AsyncLock` rather than the sync `Mutex` that protects `_tags`.
-    private let spawnLock: AsyncLock
+    /// (TOCTOU → orphaned virtiofsd), while different tags spawn in
+    /// parallel. Held across awaits, so these must be `AsyncLock`s rather
+    /// than the sync `Mutex` that protects `_tags`.
+    private let spawnLocks: Mutex<[String: AsyncLock]>
     private let logger: Logger?
 
     init(
@@ -65,6 +71,7 @@ final class CHHotplugProvider: HotplugProvider {
         workDir: URL,
         virtiofsdBinary: URL?,
         allocator: any AddressAllocator<Character>,
+        cpus: Int,
         initialMounts: [String: [AttachedFilesystem]],
         logger: Logger?
     ) {
@@ -72,10 +79,11 @@ final class CHHotplugProvider: HotplugProvider {
         self.workDir = workDir
         self.virtiofsdBinaryOverride = virtiofsdBinary
         self.allocator = allocator
+        self.cpus = cpus
         self._mounts = Mutex(initialMounts)
         self._records = Mutex([:])
         self._tags = Mutex([:])
-        self.spawnLock = AsyncLock()
+        self.spawnLocks = Mutex([:])
         self.logger = logger
     }
 
@@ -98,15 +106,12 @@ final class CHHotplugProvider: HotplugProvider {
         case .virtioblk:
             let letter = try allocator.allocate()
             let chId = "blk-\(id)-\(letter)"
-            let disk = CloudHypervisor.DiskConfig(
-                path: rootfs.source,
-                readonly: rootfs.options.contains("ro"),
-                id: chId,
-                imageType: .raw
-            )
 
             let pci: CloudHypervisor.PciDeviceInfo
             do {
+                guard let disk = try rootfs.chDiskConfig(id: chId, cpus: cpus) else {
+                    throw ContainerizationError(.invalidArgument, message: "mount \(rootfs.source) is not a block device")
+                }
                 pci = try await chCall { try await self.client.vmAddDisk(disk) }
             } catch {
                 try? allocator.release(letter)
@@ -133,7 +138,8 @@ final class CHHotplugProvider: HotplugProvider {
             let chDeviceId = try await ensureVirtiofsDevice(
                 tag: tag,
                 source: rootfs.source,
-                readonly: rootfs.options.contains("ro")
+                readonly: rootfs.options.contains("ro"),
+                profile: try VirtiofsProfile.shared(by: [rootfs])
             )
             _records.withLock {
                 $0[id, default: []].append(HotplugRecord(chDeviceId: chDeviceId, kind: .virtiofs(tag: tag)))
@@ -150,6 +156,73 @@ final class CHHotplugProvider: HotplugProvider {
         }
     }
 
+    /// Attaches every container's rootfs without waiting on the guest in
+    /// between; the caller mounts the whole batch in one agent round trip.
+    ///
+    /// virtio-fs shares with distinct tags spawn their `virtiofsd`s
+    /// concurrently; only their `vm.add-fs` calls queue on CH's API thread.
+    /// Block devices are submitted back to back in letter order
+    /// rather than concurrently: CH assigns PCI slots in arrival order and
+    /// the guest names `/dev/vd<letter>` in probe order, so submitting them
+    /// out of order would hand a container another container's disk. CH's
+    /// API thread handles one request at a time either way.
+    func hotplug(_ rootfs: [String: Mount]) async throws -> [String: AttachedFilesystem] {
+        let ordered = rootfs.sorted { $0.key < $1.key }
+        let blocks = ordered.filter {
+            if case .virtioblk = $0.value.runtimeOptions { return true }
+            return false
+        }
+        let shares = ordered.filter {
+            if case .virtioblk = $0.value.runtimeOptions { return false }
+            return true
+        }
+
+        var attached: [String: AttachedFilesystem] = [:]
+        var firstError: (any Error)?
+        await withTaskGroup(of: [(String, Result<AttachedFilesystem, any Error>)].self) { group in
+            group.addTask {
+                var results: [(String, Result<AttachedFilesystem, any Error>)] = []
+                for (id, mount) in blocks {
+                    do {
+                        results.append((id, .success(try await self.hotplug(mount, id: id))))
+                    } catch {
+                        results.append((id, .failure(error)))
+                        break
+                    }
+                }
+                return results
+            }
+            for (id, mount) in shares {
+                group.addTask {
+                    do {
+                        return [(id, .success(try await self.hotplug(mount, id: id)))]
+                    } catch {
+                        return [(id, .failure(error))]
+                    }
+                }
+            }
+            for await results in group {
+                for (id, result) in results {
+                    switch result {
+                    case .success(let fs):
+                        attached[id] = fs
+                    case .failure(let error):
+                        firstError = firstError ?? error
+                    }
+                }
+            }
+        }
+
+        if let firstError {
+            for id in attached.keys {
+                try? await releaseHotplug(id: id)
+                try? await releaseVirtioFS(id: id)
+            }
+            throw firstError
+        }
+        return attached
+    }
+
     func registerMounts(id: String, rootfs: AttachedFilesystem, additionalMounts: [Mount]) throws {
         var attached: [AttachedFilesystem] = [rootfs]
         for mount in additionalMounts {
@@ -160,6 +233,10 @@ final class CHHotplugProvider: HotplugProvider {
         }
     }
 
+    func unregisterMounts(id: String) {
+        _ = _mounts.withLock { $0.removeValue(forKey: id) }
+    }
+
     func releaseHotplug(id: String) async throws {
         let popped: [HotplugRecord] = _records.withLock { records in
             let all = records[id] ?? []
@@ -223,7 +300,8 @@ final class CHHotplugProvider: HotplugProvider {
         for (tag, group) in byTag {
             guard let source = group.first?.source else { continue }
             let readonly = group.allSatisfy { $0.options.contains("ro") }
-            let chDeviceId = try await ensureVirtiofsDevice(tag: tag, source: source, readonly: readonly)
+            let profile = try VirtiofsProfile.shared(by: group)
+            let chDeviceId = try await ensureVirtiofsDevice(tag: tag, source: source, readonly: readonly, profile: profile)
             // Record once per tag for this container. The AttachedFilesystem
             // entries for these mounts are written by registerMounts (the sole
             // _mounts writer), so we do NOT touch _mounts here.
@@ -236,21 +314,41 @@ final class CHHotplugProvider: HotplugProvider {
     /// Ensure a virtio-fs device backed by `virtiofsd` exists for `tag`,
     /// spawning one (and issuing `vm.add-fs`) on first use or bumping the
     /// refcount of an existing one. Returns the cloud-hypervisor device id
-    /// (`vm.remove-device` keys on it). Serialized per-provider by `spawnLock`
-    /// so two concurrent callers for the same tag can't double-spawn.
-    private func ensureVirtiofsDevice(tag: String, source: String, readonly: Bool) async throws -> String {
-        try await spawnLock.withLock { _ in
+    /// (`vm.remove-device` keys on it). Serialized per tag by `spawnLocks` so
+    /// two concurrent callers for the same tag can't double-spawn.
+    ///
+    /// A running virtiofsd can't be retuned, so a caller joining an existing
+    /// tag with a different `profile` gets the running one's tuning.
+    private func ensureVirtiofsDevice(
+        tag: String,
+        source: String,
+        readonly: Bool,
+        profile: VirtiofsProfile
+    ) async throws -> String {
+        let spawnLock = spawnLocks.withLock { locks in
+            if let lock = locks[tag] {
+                return lock
+            }
+            let lock = AsyncLock()
+            locks[tag] = lock
+            return lock
+        }
+        return try await spawnLock.withLock { _ in
             // Refcount-bump path: a virtiofsd already serves this tag.
-            let cached: String? = self._tags.withLock { tags in
+            let cached: (String, VirtiofsProfile)? = self._tags.withLock { tags in
                 if var state = tags[tag] {
                     state.refcount += 1
                     tags[tag] = state
-                    return state.chDeviceId
+                    return (state.chDeviceId, state.profile)
                 }
                 return nil
             }
             if let cached {
-                return cached
+                let (chDeviceId, running) = cached
+                if running != profile {
+                    self.logger?.warning("virtiofs share \(source) is already served with different ch* options; keeping the running virtiofsd's")
+                }
+                return chDeviceId
             }
 
             // First-spawn path: spawn → vm.add-fs → commit _tags, rolling back
@@ -265,7 +363,8 @@ final class CHHotplugProvider: HotplugProvider {
                     binary: virtiofsdBinary,
                     socketPath: socket,
                     sharedDir: URL(fileURLWithPath: source),
-                    readonly: readonly
+                    readonly: readonly,
+                    profile: profile
                 ),
                 logger: self.logger
             )
@@ -275,6 +374,8 @@ final class CHHotplugProvider: HotplugProvider {
             let fsConfig = CloudHypervisor.FsConfig(
                 tag: tag,
                 socket: socket.path,
+                numQueues: profile.numQueues,
+                queueSize: profile.queueSize,
                 id: "fs-\(tag)"
             )
             let pci: CloudHypervisor.PciDeviceInfo
@@ -287,7 +388,7 @@ final class CHHotplugProvider: HotplugProvider {
             }
 
             self._tags.withLock {
-                $0[tag] = VirtiofsdTagState(process: process, refcount: 1, chDeviceId: pci.id)
+                $0[tag] = VirtiofsdTagState(process: process, refcount: 1, chDeviceId: pci.id, profile: profile)
             }
             return pci.id
         }
@@ -363,10 +464,16 @@ final class CHHotplugProvider: HotplugProvider {
         tag: String,
         process: VirtiofsdProcess,
         chDeviceId: String,
+        profile: VirtiofsProfile,
         ownerIds: [String]
     ) {
         _tags.withLock {
-            $0[tag] = VirtiofsdTagState(process: process, refcount: ownerIds.count, chDeviceId: chDeviceId)
+            $0[tag] = VirtiofsdTagState(
+                process: process,
+                refcount: ownerIds.count,
+                chDeviceId: chDeviceId,
+                profile: profile
+            )
         }
         _records.withLock { records in
             for id in ownerIds {
@@ -16,6 +16,7 @@
 
 #if os(Linux)
 import CloudHypervisor
+import ContainerizationError
 import ContainerizationExtras
 
 /// An `Interface` specialization that can produce a `CloudHypervisor.NetConfig`
@@ -31,36 +32,59 @@ public protocol CHInterface {
 /// those would assign an address to the host end of the TAP, which we do not
 /// use. Bringing up the TAP and any bridge/NAT plumbing is the caller's
 /// responsibility.
+///
+/// `queuePairs` > 1 needs a TAP created with `IFF_MULTI_QUEUE` (see
+/// `TAPDevice(queuePairs:)`); cloud-hypervisor fails to open a single-queue
+/// TAP for more than one pair.
 public struct TAPInterface: CHInterface, Interface, Sendable {
     public let tapName: String
     public let ipv4Address: CIDRv4
     public let ipv4Gateway: IPv4Address?
     public let macAddress: MACAddress?
     public let mtu: UInt32
+    /// Number of RX/TX virtqueue pairs, or nil for cloud-hypervisor's
+    /// default of one.
+    public let queuePairs: Int?
+    /// Depth of each virtqueue, or nil for cloud-hypervisor's default.
+    public let queueSize: Int?
 
     public init(
         tapName: String,
         ipv4Address: CIDRv4,
         ipv4Gateway: IPv4Address? = nil,
         macAddress: MACAddress? = nil,
-        mtu: UInt32 = 1500
+        mtu: UInt32 = 1500,
+        queuePairs: Int? = nil,
+        queueSize: Int? = nil
     ) {
         self.tapName = tapName
         self.ipv4Address = ipv4Address
         self.ipv4Gateway = ipv4Gateway
         self.macAddress = macAddress
         self.mtu = mtu
+        self.queuePairs = queuePairs
+        self.queueSize = queueSize
     }
 
     public func chNetConfig() throws -> CloudHypervisor.NetConfig {
-        CloudHypervisor.NetConfig(
+        if let queuePairs, queuePairs < 1 {
+            throw ContainerizationError(.invalidArgument, message: "invalid queuePairs for \(tapName): \(queuePairs)")
+        }
+        if let queueSize, queueSize < 1 || queueSize & (queueSize - 1) != 0 {
+            throw ContainerizationError(
+                .invalidArgument,
+                message: "invalid queueSize for \(tapName): \(queueSize) (must be a power of two)"
+            )
+        }
+        // CH counts RX and TX queues separately.
+        return CloudHypervisor.NetConfig(
             tap: tapName,
             ip: nil,
             mask: nil,
             mac: macAddress?.description,
             mtu: Int(mtu),
-            numQueues: nil,
-            queueSize: nil,
+            numQueues: queuePairs.map { $0 * 2 },
+            queueSize: queueSize,
             id: nil
         )
     }
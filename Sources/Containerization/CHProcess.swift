@@ -50,6 +50,7 @@ final class CHProcess: Sendable {
         var command: Command?
         var bootLogHandle: FileHandle?
         var exitTask: Task<ExitReason, Never>?
+        var exited = false
     }
 
     private let config: Config
@@ -102,9 +103,10 @@ final class CHProcess: Sendable {
             throw error
         }
 
-        let exitTask = Task<ExitReason, Never>.detached { [command, logger] in
+        let exitTask = Task<ExitReason, Never>.detached { [command, logger, state] in
+            defer { state.withLock { $0.exited = true } }
             do {
-                let status = try command.wait()
+                let status = try await command.waitForExit()
                 if status >= 128 {
                     return .signalled(status - 128)
                 }
@@ -133,6 +135,13 @@ final class CHProcess: Sendable {
         return await task.value
     }
 
+    /// Whether the subprocess has been started and has since exited. Unlike
+    /// `wait()` this doesn't block, so callers can probe a VMM they expect
+    /// to still be running.
+    var hasExited: Bool {
+        state.withLock { $0.exited }
+    }
+
     /// Send SIGTERM, then SIGKILL after `graceSeconds` if the process is still
     /// running. Returns once the process has been reaped.
     func terminate(graceSeconds: UInt32) async {
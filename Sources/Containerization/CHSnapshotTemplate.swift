@@ -0,0 +1,163 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+#if os(Linux)
+import CloudHypervisor
+import ContainerizationError
+import Foundation
+
+/// A cloud-hypervisor snapshot of a freshly booted VM whose guest agent is
+/// up and idle, used to start new sandboxes by restoring rather than
+/// cold-booting.
+///
+/// A template captures only the VM "shape": vCPU count, memory size, kernel,
+/// kernel command line and initial filesystem. Everything that differs per
+/// sandbox — container disks, virtiofs shares and network interfaces — is
+/// hotplugged into the restored clone. Right after resume the guest clock is
+/// resynced and the guest RNG reseeded with host entropy, so clones don't
+/// share the template's random state.
+/// Templates are produced by ``CHVirtualMachineManager/makeSnapshotTemplate(cpus:memoryInBytes:directory:)``
+/// and persist a small manifest next to the snapshot files so they can be
+/// reloaded with ``load(from:)`` across host process restarts.
+public struct CHSnapshotTemplate: Sendable, Codable, Equatable {
+    /// Directory holding the cloud-hypervisor snapshot (`config.json`,
+    /// `state.json`, `memory-ranges`) and the template manifest.
+    public let directory: URL
+    /// vCPU count the template was booted with.
+    public let cpus: Int
+    /// Requested memory size the template was booted with.
+    public let memoryInBytes: UInt64
+    /// Path of the kernel image the template booted.
+    public let kernelPath: String
+    /// Full kernel command line the template booted, including the
+    /// arguments passed on to vminitd.
+    public let kernelCommandLine: String
+    /// Source of the initial filesystem the template booted.
+    public let initialFilesystemSource: String
+
+    static let manifestName = "template.json"
+
+    /// Files written by `vm.snapshot` that a clone reuses as-is.
+    private static let sharedSnapshotFiles = ["state.json", "memory-ranges"]
+    private static let configFile = "config.json"
+
+    init(
+        directory: URL,
+        cpus: Int,
+        memoryInBytes: UInt64,
+        kernelPath: String,
+        kernelCommandLine: String,
+        initialFilesystemSource: String
+    ) {
+        self.directory = directory
+        self.cpus = cpus
+        self.memoryInBytes = memoryInBytes
+        self.kernelPath = kernelPath
+        self.kernelCommandLine = kernelCommandLine
+        self.initialFilesystemSource = initialFilesystemSource
+    }
+
+    /// Load a template previously written by `makeSnapshotTemplate`.
+    public static func load(from directory: URL) throws -> CHSnapshotTemplate {
+        let manifest = directory.appendingPathComponent(Self.manifestName)
+        guard FileManager.default.fileExists(atPath: manifest.path) else {
+            throw ContainerizationError(.notFound, message: "no snapshot template at \(directory.path)")
+        }
+        let data = try Data(contentsOf: manifest)
+        return try JSONDecoder().decode(CHSnapshotTemplate.self, from: data)
+    }
+
+    func writeManifest() throws {
+        let data = try JSONEncoder().encode(self)
+        try data.write(to: directory.appendingPathComponent(Self.manifestName), options: .atomic)
+    }
+
+    /// Whether an instance with `config` can be started from this template.
+    ///
+    /// The shape must match exactly, command line included: the restored
+    /// guest keeps whatever the template booted with, vminitd flags too.
+    /// Configurations carrying a `CHInstanceExtension` are excluded because
+    /// `configureCH` mutates the `VmConfig` that a restore never sends.
+    func matches(_ config: CHVirtualMachineInstance.Configuration) -> Bool {
+        guard let kernel = config.kernel, let initialFilesystem = config.initialFilesystem else {
+            return false
+        }
+        guard config.cpus == cpus,
+            CHVirtualMachineInstance.alignMemorySize(config.memoryInBytes)
+                == CHVirtualMachineInstance.alignMemorySize(memoryInBytes),
+            kernel.path.path == kernelPath,
+            kernel.linuxCommandline(initialFilesystem: initialFilesystem) == kernelCommandLine,
+            initialFilesystem.source == initialFilesystemSource,
+            // Templates are taken from standard-page VMs and restore with
+            // the snapshot's own memory config.
+            config.memoryBacking == .standard
+        else {
+            return false
+        }
+        return !config.extensions.contains { $0 is any CHInstanceExtension }
+    }
+
+    /// Build a per-clone snapshot directory under `cloneDir`.
+    ///
+    /// The snapshot's `config.json` records host paths of the template VM —
+    /// most importantly the vsock UDS, which every clone needs to own. The
+    /// device state and guest memory are shared read-only through symlinks,
+    /// and only `config.json` is rewritten to point at the clone's sockets
+    /// and console. Returns the directory to pass to `vm.restore`.
+    func materialize(
+        into cloneDir: URL,
+        vsockSocket: URL,
+        console: CloudHypervisor.ConsoleConfig
+    ) throws -> URL {
+        try FileManager.default.createDirectory(
+            at: cloneDir,
+            withIntermediateDirectories: true,
+            attributes: [.posixPermissions: 0o700]
+        )
+        for name in Self.sharedSnapshotFiles {
+            try FileManager.default.createSymbolicLink(
+                at: cloneDir.appendingPathComponent(name),
+                withDestinationURL: directory.appendingPathComponent(name)
+            )
+        }
+
+        let data = try Data(contentsOf: directory.appendingPathComponent(Self.configFile))
+        guard var json = try JSONSerialization.jsonObject(with: data) as? [String: Any] else {
+            throw ContainerizationError(
+                .invalidArgument,
+                message: "snapshot config.json in \(directory.path) is not a JSON object"
+            )
+        }
+        guard var vsock = json["vsock"] as? [String: Any] else {
+            throw ContainerizationError(
+                .invalidArgument,
+                message: "snapshot in \(directory.path) has no vsock device"
+            )
+        }
+        vsock["socket"] = vsockSocket.path
+        json["vsock"] = vsock
+
+        var consoleJSON = json["console"] as? [String: Any] ?? [:]
+        consoleJSON["mode"] = console.mode.rawValue
+        consoleJSON["file"] = console.file ?? NSNull()
+        json["console"] = consoleJSON
+
+        let rewritten = try JSONSerialization.data(withJSONObject: json)
+        try rewritten.write(to: cloneDir.appendingPathComponent(Self.configFile), options: .atomic)
+        return cloneDir
+    }
+}
+#endif
@@ -0,0 +1,57 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+/// Wall-clock breakdown of a cloud-hypervisor VM's `start()`.
+///
+/// Phases that run concurrently overlap, so their durations can add up to
+/// more than ``total``. Phases that a given start path skips (e.g. `vmBoot`
+/// when restoring from a snapshot) are absent.
+public struct CHStartupTimings: Sendable, Equatable {
+    public enum Phase: String, Sendable, CaseIterable {
+        /// Binding the pre-allocated stdio vsock listeners.
+        case stdioPool
+        /// Building the `VmConfig`, including spawning boot-time virtiofsd
+        /// instances and waiting for their sockets. A restore has no
+        /// `VmConfig` to build and records only the virtiofsd part.
+        case buildConfig
+        /// Spawning cloud-hypervisor and waiting for its API socket.
+        case vmmSpawn
+        /// `vm.create`.
+        case vmCreate
+        /// `vm.boot`.
+        case vmBoot
+        /// `vm.restore` plus `vm.resume` from a snapshot template.
+        case vmRestore
+        /// Hotplugging per-sandbox devices into a restored or pooled VM.
+        case deviceAttach
+        /// Dialing vminitd until it answers.
+        case agentConnect
+    }
+
+    public private(set) var phases: [Phase: Duration] = [:]
+    /// Time from entering `start()` until the VM was marked running.
+    public internal(set) var total: Duration = .zero
+
+    public init() {}
+
+    mutating func record(_ phase: Phase, _ duration: Duration) {
+        phases[phase, default: .zero] += duration
+    }
+
+    public subscript(_ phase: Phase) -> Duration? {
+        phases[phase]
+    }
+}
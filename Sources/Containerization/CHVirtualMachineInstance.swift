@@ -52,6 +52,17 @@ public final class CHVirtualMachineInstance: Sendable {
         public var initialFilesystem: Mount?
         public var bootLog: BootLog?
         public var extensions: [any Sendable] = []
+        /// When set, `start()` restores this snapshot and hotplugs the
+        /// per-sandbox devices instead of cold-booting the kernel. The
+        /// template must match the configuration's shape (see
+        /// ``CHSnapshotTemplate``).
+        public var snapshotTemplate: CHSnapshotTemplate?
+        /// When set, every ``CHStartupTimings/Phase`` is also recorded as a
+        /// span on the ``BootTrace/Lane/vmm`` lane.
+        public var bootTrace: BootTraceRecorder?
+        /// Requested host backing for guest RAM. See ``memoryBacking`` on
+        /// the instance for what was actually used.
+        public var memoryBacking: MemoryBacking = .standard
 
         public init() {
             self.cpus = 4
@@ -93,6 +104,10 @@ public final class CHVirtualMachineInstance: Sendable {
     /// these into `VmConfig.disks`.
     let bootDisks: [BootDisk]
 
+    /// Set when this instance adopted an already-running VM from the warm
+    /// pool. `start()` then only hotplugs the per-sandbox devices.
+    private let prebooted: Bool
+
     /// Owned resources
     let workDir: URL
     let config: Configuration
@@ -119,13 +134,29 @@ public final class CHVirtualMachineInstance: Sendable {
     /// `stdioPoolSize` if you need more concurrent stdio streams than that.
     static let stdioPoolBase: UInt32 = 0x1000_0000
     static let stdioPoolSize: Int = 16
-    private struct PreboundListener: Sendable {
+    struct PreboundListener: Sendable {
         let port: UInt32
         let listenFd: Int32
         let path: URL
     }
     private let _stdioPool: Mutex<[UInt32: PreboundListener]>
 
+    private let _startupTimings: Mutex<CHStartupTimings?>
+    /// Per-phase timing of the most recent `start()`, or nil if the
+    /// instance has never been started. Populated for failed starts too, up
+    /// to the phase that failed.
+    public var startupTimings: CHStartupTimings? {
+        _startupTimings.withLock { $0 }
+    }
+
+    private let _memoryBacking: Mutex<MemoryBacking>
+    /// The backing guest RAM was booted with. Equals the configured
+    /// ``Configuration/memoryBacking`` unless the host's hugepage pool was
+    /// too small, in which case this reports the standard-page fallback.
+    public var memoryBacking: MemoryBacking {
+        _memoryBacking.withLock { $0 }
+    }
+
     public convenience init(
         group: (any EventLoopGroup)? = nil,
         runtimeRoot: URL,
@@ -208,6 +239,7 @@ public final class CHVirtualMachineInstance: Sendable {
             workDir: workDir,
             virtiofsdBinary: virtiofsdBinary,
             allocator: allocator,
+            cpus: config.cpus,
             initialMounts: inventory.attachments,
             logger: logger
         )
@@ -220,6 +252,56 @@ public final class CHVirtualMachineInstance: Sendable {
         self.timeSyncer = .init(logger: logger)
         self._state = Mutex(.stopped)
         self._stdioPool = Mutex([:])
+        self._startupTimings = Mutex(nil)
+        self._memoryBacking = Mutex(.standard)
+        self.prebooted = false
+    }
+
+    /// Take over the running VM behind `warm` (booted with no container
+    /// mounts or interfaces by the warm pool) for a sandbox described by
+    /// `config`. The cloud-hypervisor process, REST client, vminitd time
+    /// sync and pre-bound stdio listeners move to the new instance; `warm`
+    /// is left in the `.unknown` state and must not be used afterwards.
+    init(adopting warm: CHVirtualMachineInstance, config: Configuration) throws {
+        // The guest already has the initial filesystem at vda, so a fresh
+        // allocator walking the same inventory lines up with what the guest
+        // will enumerate as container disks are hotplugged in order.
+        let allocator = Character.blockDeviceTagAllocator()
+        let inventory = try config.bootInventory(allocator: allocator)
+        self.blockAllocator = allocator
+        self.bootDisks = inventory.bootDisks
+
+        self.workDir = warm.workDir
+        self.group = warm.group
+        self.ownsGroup = warm.ownsGroup
+        self.chProcess = warm.chProcess
+        self.client = warm.client
+        self.timeSyncer = warm.timeSyncer
+        self.hotplug = CHHotplugProvider(
+            client: warm.client,
+            workDir: warm.workDir,
+            virtiofsdBinary: warm.virtiofsdBinaryOverride,
+            allocator: allocator,
+            cpus: config.cpus,
+            initialMounts: inventory.attachments,
+            logger: warm.logger
+        )
+
+        self.config = config
+        self.virtiofsdBinaryOverride = warm.virtiofsdBinaryOverride
+        self.logger = warm.logger
+        self.lock = .init()
+        self._state = Mutex(.stopped)
+        self._stdioPool = Mutex(
+            warm._stdioPool.withLock { pool in
+                let entries = pool
+                pool.removeAll()
+                return entries
+            })
+        self._startupTimings = Mutex(nil)
+        self._memoryBacking = Mutex(warm.memoryBacking)
+        self.prebooted = true
+        warm._state.withLock { $0 = .unknown }
     }
 
     /// Mutate the mount registry. Forwards to the hotplug provider, which
@@ -242,34 +324,52 @@ extension CHVirtualMachineInstance: VirtualMachineInstance {
                 )
             }
             self._state.withLock { $0 = .starting }
+            let started = ContinuousClock.now
+            self._startupTimings.withLock { $0 = CHStartupTimings() }
 
             do {
-                var vmConfig = try await self.buildVmConfig()
-                for ext in self.config.extensions.compactMap({ $0 as? any CHInstanceExtension }) {
-                    try ext.configureCH(&vmConfig)
+                if self.prebooted {
+                    // vminitd is already connected and the time syncer
+                    // running; only the per-sandbox devices are missing.
+                    try await self.timed(.deviceAttach) { try await self.attachBootDevices() }
+                    if self.config.bootTrace != nil {
+                        // The agent's boot spans describe the warm VM's boot,
+                        // not this sandbox's.
+                        let agent = try await Vminitd(connection: try await self.dialVminitdWithRetries(), group: self.group)
+                        try? await agent.resetBootTrace()
+                        try? await agent.close()
+                    }
+                } else {
+                    if let template = self.config.snapshotTemplate {
+                        try await self.restore(from: template)
+                    } else {
+                        try await self.coldBoot()
+                    }
+
+                    let fh = try await self.timed(.agentConnect) { try await self.dialVminitdWithRetries() }
+                    let agent = try await Vminitd(connection: fh, group: self.group)
+                    if self.config.snapshotTemplate != nil {
+                        // The guest clock stopped when the template was
+                        // snapshotted; don't wait a full sync interval to fix it.
+                        try await TimeSyncer.sync(agent)
+                        // Every clone resumes with the template's RNG state.
+                        try await agent.reseed(entropy: Self.hostEntropy())
+                        // The agent's boot spans are the template's, too.
+                        if self.config.bootTrace != nil {
+                            try? await agent.resetBootTrace()
+                        }
+                    }
+                    await self.timeSyncer.start(context: agent)
                 }
-                let finalConfig = vmConfig
-
-                // Pre-bind the stdio vsock listener pool before launching CH.
-                // CH inherits a fs snapshot at fork time and is blind to
-                // anything we add to workDir after — see `_stdioPool` doc.
-                try self.prebindStdioPool()
-
-                try await self.chProcess.start()
-
-                try await chCall { try await self.client.vmCreate(finalConfig) }
-                try await chCall { try await self.client.vmBoot() }
-
-                let fh = try await self.dialVminitdWithRetries()
-                let agent = try await Vminitd(connection: fh, group: self.group)
-                await self.timeSyncer.start(context: agent)
 
                 for ext in self.config.extensions.compactMap({ $0 as? any CHInstanceExtension }) {
                     try ext.didCreate(self)
                 }
 
+                self._startupTimings.withLock { $0?.total = ContinuousClock.now - started }
                 self._state.withLock { $0 = .running }
             } catch {
+                self._startupTimings.withLock { $0?.total = ContinuousClock.now - started }
                 self.logger?.warning("CH VM start failed; tearing down partial resources: \(error)")
                 await self.teardownAfterFailedStart()
                 self._state.withLock { $0 = .stopped }
@@ -278,6 +378,168 @@ extension CHVirtualMachineInstance: VirtualMachineInstance {
         }
     }
 
+    /// Build the `VmConfig`, spawn cloud-hypervisor and boot the kernel.
+    ///
+    /// Building the config starts every boot-time virtiofsd, whose sockets
+    /// land in workDir, so it has to finish before cloud-hypervisor forks
+    /// (see `_stdioPool`). It overlaps with binding the stdio pool, which
+    /// has the same constraint, and the kernel and initial filesystem are
+    /// read ahead into the page cache meanwhile so `vm.create`/`vm.boot`
+    /// don't stall on cold storage.
+    private func coldBoot() async throws {
+        if let kernel = config.kernel {
+            Self.readAhead([kernel.path.path, config.initialFilesystem?.source].compactMap { $0 })
+        }
+
+        async let built = self.timed(.buildConfig) { try await self.buildVmConfig() }
+
+        // Pre-bind the stdio vsock listener pool before launching CH.
+        // CH inherits a fs snapshot at fork time and is blind to
+        // anything we add to workDir after — see `_stdioPool` doc.
+        try self.timedSync(.stdioPool) { try self.prebindStdioPool() }
+
+        // Every workDir side effect is done once the config is built.
+        var vmConfig = try await built
+        try await self.timed(.vmmSpawn) { try await self.chProcess.start() }
+        for ext in self.config.extensions.compactMap({ $0 as? any CHInstanceExtension }) {
+            try ext.configureCH(&vmConfig)
+        }
+        let finalConfig = vmConfig
+
+        try await timed(.vmCreate) { try await chCall { try await self.client.vmCreate(finalConfig) } }
+        try await timed(.vmBoot) { try await chCall { try await self.client.vmBoot() } }
+    }
+
+    /// Run `body`, adding its wall-clock duration to `phase` in
+    /// `startupTimings` (and the boot trace, if one is configured).
+    private func timed<T: Sendable>(
+        _ phase: CHStartupTimings.Phase,
+        _ body: @Sendable () async throws -> T
+    ) async throws -> T {
+        let start = ContinuousClock.now
+        let traceStart = BootTraceRecorder.now()
+        defer {
+            let elapsed = ContinuousClock.now - start
+            _startupTimings.withLock { $0?.record(phase, elapsed) }
+            config.bootTrace?.record(phase.rawValue, lane: .vmm, start: traceStart)
+        }
+        return try await body()
+    }
+
+    private func timedSync<T>(_ phase: CHStartupTimings.Phase, _ body: () throws -> T) rethrows -> T {
+        let start = ContinuousClock.now
+        let traceStart = BootTraceRecorder.now()
+        defer {
+            let elapsed = ContinuousClock.now - start
+            _startupTimings.withLock { $0?.record(phase, elapsed) }
+            config.bootTrace?.record(phase.rawValue, lane: .vmm, start: traceStart)
+        }
+        return try body()
+    }
+
+    /// 64 bytes from the host CSPRNG for ``Vminitd/reseed(entropy:)``.
+    private static func hostEntropy() -> Data {
+        var generator = SystemRandomNumberGenerator()
+        return Data((0..<64).map { _ in UInt8.random(in: .min ... .max, using: &generator) })
+    }
+
+    /// Ask the kernel to start reading `paths` into the page cache. Returns
+    /// immediately; `POSIX_FADV_WILLNEED` schedules asynchronous readahead.
+    /// Best-effort — failures only lose the prefetch.
+    private static func readAhead(_ paths: [String]) {
+        for path in paths {
+            let fd = open(path, O_RDONLY | O_CLOEXEC)
+            guard fd >= 0 else { continue }
+            _ = posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED)
+            _ = close(fd)
+        }
+    }
+
+    /// Spawn cloud-hypervisor, restore `template` into it and resume, then
+    /// hotplug the devices a cold boot would have put in `VmConfig`.
+    private func restore(from template: CHSnapshotTemplate) async throws {
+        guard config.kernel != nil, config.initialFilesystem != nil else {
+            throw ContainerizationError(.invalidArgument, message: "kernel and initialFilesystem are required for cloud-hypervisor backend")
+        }
+
+        // Same ordering constraint as a cold boot: the clone's snapshot
+        // directory, virtiofsd sockets and stdio listeners must all exist
+        // before CH is spawned (see `_stdioPool`).
+        async let virtiofs = self.timed(.buildConfig) { try await self.startBootVirtiofs() }
+        let vsockSocket = workDir.appendingPathComponent("vsock.sock")
+        let source = try template.materialize(
+            into: workDir.appendingPathComponent("snapshot"),
+            vsockSocket: vsockSocket,
+            console: Self.consoleConfig(forBootLog: config.bootLog)
+        )
+        try self.timedSync(.stdioPool) { try self.prebindStdioPool() }
+        let fsConfigs = try await virtiofs
+
+        try await timed(.vmmSpawn) { try await self.chProcess.start() }
+
+        let restoreConfig = CloudHypervisor.RestoreConfig(sourceUrl: source.absoluteString, prefault: false)
+        try await timed(.vmRestore) {
+            try await chCall { try await self.client.vmRestore(restoreConfig) }
+            try await chCall { try await self.client.vmResume() }
+        }
+
+        try await timed(.deviceAttach) { try await self.attachBootDevices(virtiofs: fsConfigs) }
+    }
+
+    /// Hotplug into an already-running guest the devices a cold boot would
+    /// have put in `VmConfig`: container disks in allocator-letter order (so
+    /// the guest's `/dev/vdX` names match `bootDisks`), virtiofs shares and
+    /// network interfaces. `virtiofs` carries shares whose virtiofsd was
+    /// already started; when nil they are started here.
+    private func attachBootDevices(virtiofs: [CloudHypervisor.FsConfig]? = nil) async throws {
+        for bd in bootDisks {
+            guard let cid = bd.containerId else { continue }
+            guard let disk = try bd.mount.chDiskConfig(id: "blk-\(cid)-\(bd.letter)", cpus: config.cpus) else { continue }
+            _ = try await chCall { try await self.client.vmAddDisk(disk) }
+        }
+        let fsConfigs: [CloudHypervisor.FsConfig]
+        if let virtiofs {
+            fsConfigs = virtiofs
+        } else {
+            fsConfigs = try await self.startBootVirtiofs()
+        }
+        for fs in fsConfigs {
+            _ = try await chCall { try await self.client.vmAddFs(fs) }
+        }
+        for interface in config.interfaces {
+            guard let net = try (interface as? any CHInterface)?.chNetConfig() else { continue }
+            _ = try await chCall { try await self.client.vmAddNet(net) }
+        }
+    }
+
+    /// Quiesce the guest agent, pause the VM and write a snapshot of it into
+    /// `directory`. The VM is left paused; the caller is expected to `stop()`
+    /// it. Used to produce a ``CHSnapshotTemplate``.
+    func snapshot(into directory: URL) async throws {
+        try await lock.withLock { _ in
+            try self.requireRunning()
+
+            // Flush guest dirty pages and drop every host-side vsock
+            // connection into vminitd. A connection open at snapshot time
+            // would be restored into each clone with no host peer behind it.
+            let agent = try await Vminitd(
+                connection: try await chVsockDial(
+                    baseSocket: self.workDir.appendingPathComponent("vsock.sock"),
+                    port: Vminitd.port
+                ),
+                group: self.group
+            )
+            try await agent.sync()
+            try await agent.close()
+            try? await self.timeSyncer.close()
+
+            try FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+            try await chCall { try await self.client.vmPause() }
+            let snapshotConfig = CloudHypervisor.VmSnapshotConfig(destinationUrl: directory.absoluteString)
+            try await chCall { try await self.client.vmSnapshot(snapshotConfig) }
+        }
+    }
+
     /// Reverse the side effects of any partially-completed `start()`:
     /// terminate cloud-hypervisor, kill registered virtiofsd processes,
     /// close pre-bound stdio listener fds, remove the workDir, and shut
@@ -478,6 +740,10 @@ extension CHVirtualMachineInstance: VirtualMachineInstance {
         try await hotplug.hotplug(block, id: id)
     }
 
+    public func hotplug(_ rootfs: [String: Mount]) async throws -> [String: AttachedFilesystem] {
+        try await hotplug.hotplug(rootfs)
+    }
+
     public func releaseHotplug(id: String) async throws {
         try await hotplug.releaseHotplug(id: id)
     }
@@ -493,6 +759,10 @@ extension CHVirtualMachineInstance: VirtualMachineInstance {
     public func registerMounts(id: String, rootfs: AttachedFilesystem, additionalMounts: [Mount]) throws {
         try hotplug.registerMounts(id: id, rootfs: rootfs, additionalMounts: additionalMounts)
     }
+
+    public func unregisterMounts(id: String) {
+        hotplug.unregisterMounts(id: id)
+    }
 }
 
 // MARK: - VmConfig + vminitd dial helpers
@@ -515,7 +785,7 @@ extension CHVirtualMachineInstance {
         var disks: [CloudHypervisor.DiskConfig] = []
         for bd in bootDisks {
             let chId = bd.containerId.map { "blk-\($0)-\(bd.letter)" } ?? "rootfs"
-            if var disk = bd.mount.chDiskConfig(id: chId) {
+            if var disk = try bd.mount.chDiskConfig(id: chId, cpus: config.cpus) {
                 if bd.containerId == nil {
                     disk.readonly = true
                 }
@@ -523,63 +793,7 @@ extension CHVirtualMachineInstance {
             }
         }
 
-        // Virtiofs: group all .virtiofs mounts in mountsByID by source-hash
-        // tag, spawn one virtiofsd per tag, build matching FsConfigs.
-        var byTag: [String: (mounts: [Mount], owners: [String])] = [:]
-        for cid in config.mountsByID.keys.sorted() {
-            guard let mounts = config.mountsByID[cid] else { continue }
-            for mount in mounts {
-                guard case .virtiofs = mount.runtimeOptions else { continue }
-                let tag = try hashFilePath(path: mount.source)
-                var entry = byTag[tag] ?? (mounts: [], owners: [])
-                entry.mounts.append(mount)
-                if !entry.owners.contains(cid) {
-                    entry.owners.append(cid)
-                }
-                byTag[tag] = entry
-            }
-        }
-
-        var fsConfigs: [CloudHypervisor.FsConfig] = []
-        // Resolve virtiofsd lazily — only if we actually have any virtiofs
-        // mounts at boot. A block-only VM doesn't require virtiofsd.
-        let resolvedVirtiofsdBinary: URL? =
-            byTag.isEmpty
-            ? nil
-            : try CHVirtualMachineManager.resolveBinary(virtiofsdBinaryOverride, name: "virtiofsd")
-        for (tag, entry) in byTag {
-            guard let source = entry.mounts.first?.source else { continue }
-            guard let binary = resolvedVirtiofsdBinary else { continue }
-            let socket = chVirtiofsSocketURL(workDir: workDir, tag: tag)
-            let readonly = entry.mounts.allSatisfy { $0.options.contains("ro") }
-            let chDeviceId = "fs-\(tag)"
-
-            let process = VirtiofsdProcess(
-                config: .init(
-                    binary: binary,
-                    socketPath: socket,
-                    sharedDir: URL(fileURLWithPath: source),
-                    readonly: readonly
-                ),
-                logger: logger
-            )
-            try await process.start()
-
-            hotplug.recordBootTimeVirtiofs(
-                tag: tag,
-                process: process,
-                chDeviceId: chDeviceId,
-                ownerIds: entry.owners
-            )
-
-            fsConfigs.append(
-                CloudHypervisor.FsConfig(
-                    tag: tag,
-                    socket: socket.path,
-                    id: chDeviceId
-                )
-            )
-        }
+        let fsConfigs = try await startBootVirtiofs()
 
         let net: [CloudHypervisor.NetConfig] = try config.interfaces.compactMap {
             try ($0 as? any CHInterface)?.chNetConfig()
@@ -590,6 +804,18 @@ extension CHVirtualMachineInstance {
             socket: workDir.appendingPathComponent("vsock.sock").path
         )
 
+        let backing = Self.effectiveMemoryBacking(
+            config.memoryBacking,
+            memoryInBytes: config.memoryInBytes,
+            availableHugepages: Self.availableHugepages
+        )
+        if backing != config.memoryBacking, let size = config.memoryBacking.hugepageSize {
+            logger?.warning(
+                "host pool of \(size.rawValue)-byte hugepages can't back \(config.memoryInBytes) bytes of guest memory; falling back to standard pages"
+            )
+        }
+        _memoryBacking.withLock { $0 = backing }
+
         let payload = CloudHypervisor.PayloadConfig(
             kernel: kernel.path.path,
             cmdline: kernel.linuxCommandline(initialFilesystem: rootfs)
@@ -605,8 +831,11 @@ extension CHVirtualMachineInstance {
             // memory config can't be changed once the VM has booted. The
             // MAP_SHARED-backed RAM has negligible runtime impact.
             memory: .init(
-                size: Self.alignMemorySize(config.memoryInBytes),
-                shared: true
+                size: Self.alignMemorySize(config.memoryInBytes, to: backing.hugepageSize?.rawValue),
+                shared: true,
+                hugepages: backing.hugepageSize == nil ? nil : true,
+                hugepageSize: backing.hugepageSize?.rawValue,
+                prefault: backing.prefault ? true : nil
             ),
             payload: payload,
             disks: disks.isEmpty ? nil : disks,
@@ -628,18 +857,137 @@ extension CHVirtualMachineInstance {
         )
     }
 
+    /// Spawn one `virtiofsd` per unique boot-time virtiofs source-hash tag,
+    /// register each with the hotplug provider so `releaseVirtioFS(id:)` and
+    /// `stop()` can reclaim them, and return the matching `FsConfig`s.
+    private func startBootVirtiofs() async throws -> [CloudHypervisor.FsConfig] {
+        // Virtiofs: group all .virtiofs mounts in mountsByID by source-hash
+        // tag, spawn one virtiofsd per tag, build matching FsConfigs.
+        var byTag: [String: (mounts: [Mount], owners: [String])] = [:]
+        for cid in config.mountsByID.keys.sorted() {
+            guard let mounts = config.mountsByID[cid] else { continue }
+            for mount in mounts {
+                guard case .virtiofs = mount.runtimeOptions else { continue }
+                let tag = try hashFilePath(path: mount.source)
+                var entry = byTag[tag] ?? (mounts: [], owners: [])
+                entry.mounts.append(mount)
+                if !entry.owners.contains(cid) {
+                    entry.owners.append(cid)
+                }
+                byTag[tag] = entry
+            }
+        }
+
+        // Resolve virtiofsd lazily — only if we actually have any virtiofs
+        // mounts at boot. A block-only VM doesn't require virtiofsd.
+        guard !byTag.isEmpty else {
+            return []
+        }
+        let binary = try CHVirtualMachineManager.resolveBinary(virtiofsdBinaryOverride, name: "virtiofsd")
+
+        // Each virtiofsd spends most of its startup waiting for its socket,
+        // so spawn them all at once. Every process is registered with the
+        // hotplug provider as soon as it is up, so a sibling's failure still
+        // leaves it reachable by `teardownAfterFailedStart`.
+        let fsConfigs = try await withThrowingTaskGroup(of: CloudHypervisor.FsConfig.self) { group in
+            for (tag, entry) in byTag {
+                guard let source = entry.mounts.first?.source else { continue }
+                let socket = chVirtiofsSocketURL(workDir: workDir, tag: tag)
+                let readonly = entry.mounts.allSatisfy { $0.options.contains("ro") }
+                let profile = try VirtiofsProfile.shared(by: entry.mounts)
+                let chDeviceId = "fs-\(tag)"
+                let owners = entry.owners
+
+                group.addTask {
+                    let process = VirtiofsdProcess(
+                        config: .init(
+                            binary: binary,
+                            socketPath: socket,
+                            sharedDir: URL(fileURLWithPath: source),
+                            readonly: readonly,
+                            profile: profile
+                        ),
+                        logger: self.logger
+                    )
+                    try await process.start()
+
+                    self.hotplug.recordBootTimeVirtiofs(
+                        tag: tag,
+                        process: process,
+                        chDeviceId: chDeviceId,
+                        profile: profile,
+                        ownerIds: owners
+                    )
+
+                    return CloudHypervisor.FsConfig(
+                        tag: tag,
+                        socket: socket.path,
+                        numQueues: profile.numQueues,
+                        queueSize: profile.queueSize,
+                        id: chDeviceId
+                    )
+                }
+            }
+
+            var configs: [CloudHypervisor.FsConfig] = []
+            for try await config in group {
+                configs.append(config)
+            }
+            return configs
+        }
+        // Completion order is nondeterministic; keep VmConfig stable.
+        return fsConfigs.sorted { $0.tag < $1.tag }
+    }
+
     /// Round `bytes` up to the nearest 2 MiB boundary. Cloud Hypervisor
     /// rejects `vm.boot` with "Memory size is misaligned with default page
     /// size or its hugepage size" if the memory size isn't a multiple of the
     /// guest's page size; 2 MiB is a multiple of both 4 KiB and 64 KiB pages
     /// and the standard hugepage size on aarch64.
-    private static func alignMemorySize(_ bytes: UInt64) -> UInt64 {
-        let alignment: UInt64 = 2 * 1024 * 1024
+    /// Hugepage-backed memory is instead rounded up to `hugepageSize`.
+    static func alignMemorySize(_ bytes: UInt64, to hugepageSize: UInt64? = nil) -> UInt64 {
+        let alignment = max(hugepageSize ?? 0, 2 * 1024 * 1024)
         let remainder = bytes % alignment
         return remainder == 0 ? bytes : bytes + (alignment - remainder)
     }
 
-    private static func consoleConfig(forBootLog bootLog: BootLog?) -> CloudHypervisor.ConsoleConfig {
+    /// Resolve `requested` against the host's hugepage pool. Hugepages are
+    /// only used when the pool has enough unreserved pages for all of guest
+    /// RAM; otherwise CH would fail `vm.create`, so fall back to standard
+    /// pages and keep the requested prefault setting.
+    static func effectiveMemoryBacking(
+        _ requested: MemoryBacking,
+        memoryInBytes: UInt64,
+        availableHugepages: (MemoryBacking.HugepageSize) -> UInt64?
+    ) -> MemoryBacking {
+        guard let size = requested.hugepageSize else {
+            return requested
+        }
+        let needed = alignMemorySize(memoryInBytes, to: size.rawValue) / size.rawValue
+        guard let available = availableHugepages(size), available >= needed else {
+            return MemoryBacking(hugepageSize: nil, prefault: requested.prefault)
+        }
+        return requested
+    }
+
+    /// Unreserved pages in the host's hugepage pool of `size`, or nil if the
+    /// kernel doesn't expose a pool of that size.
+    static func availableHugepages(_ size: MemoryBacking.HugepageSize) -> UInt64? {
+        let dir = "/sys/kernel/mm/hugepages/hugepages-\(size.rawValue / 1024)kB"
+        func read(_ name: String) -> UInt64? {
+            guard let text = try? String(contentsOfFile: "\(dir)/\(name)", encoding: .utf8) else {
+                return nil
+            }
+            return UInt64(text.trimmingCharacters(in: .whitespacesAndNewlines))
+        }
+        guard let free = read("free_hugepages") else {
+            return nil
+        }
+        let reserved = read("resv_hugepages") ?? 0
+        return free > reserved ? free - reserved : 0
+    }
+
+    static func consoleConfig(forBootLog bootLog: BootLog?) -> CloudHypervisor.ConsoleConfig {
         guard let bootLog else { return .init(mode: .Null) }
         switch bootLog.base {
         case .file(let path, _):
@@ -33,6 +33,9 @@ public struct CHVirtualMachineManager: VirtualMachineManager {
     private let runtimeRoot: URL
     private let group: (any EventLoopGroup)?
     private let logger: Logger?
+    private var snapshotTemplate: CHSnapshotTemplate?
+    /// The warm pool backing this manager, if any.
+    public private(set) var warmPool: CHWarmPool?
 
     /// - Parameters:
     ///   - kernel: The Linux kernel image used for every VM this manager creates.
@@ -101,9 +104,34 @@ public struct CHVirtualMachineManager: VirtualMachineManager {
         instanceConfig.interfaces = vmConfig.interfaces
         instanceConfig.mountsByID = vmConfig.mountsByID
         instanceConfig.bootLog = vmConfig.bootLog
+        instanceConfig.bootTrace = vmConfig.bootTrace
+        instanceConfig.memoryBacking = vmConfig.memoryBacking
         instanceConfig.extensions = vmConfig.extensions
         instanceConfig.kernel = kernel
         instanceConfig.initialFilesystem = initialFilesystem
+        if let snapshotTemplate, snapshotTemplate.matches(instanceConfig) {
+            instanceConfig.snapshotTemplate = snapshotTemplate
+        }
+
+        // A pooled VM's console and VmConfig were fixed when it booted, so
+        // only configurations that don't customize either can adopt one.
+        let poolable =
+            instanceConfig.bootLog == nil
+            && instanceConfig.memoryBacking == .standard
+            && !instanceConfig.extensions.contains { $0 is any CHInstanceExtension }
+        if let warmPool, poolable {
+            let shape = CHWarmPool.Shape(cpus: instanceConfig.cpus, memoryInBytes: instanceConfig.memoryInBytes)
+            if let warm = await warmPool.take(shape) {
+                do {
+                    return try CHVirtualMachineInstance(adopting: warm, config: instanceConfig)
+                } catch {
+                    // The pool has already let go of `warm`; stop it rather
+                    // than leak a running VMM, and boot one from scratch.
+                    logger?.warning("failed to adopt warm VM, booting a new one: \(error)")
+                    try? await warm.stop()
+                }
+            }
+        }
 
         return try CHVirtualMachineInstance(
             group: group,
@@ -115,6 +143,108 @@ public struct CHVirtualMachineManager: VirtualMachineManager {
         )
     }
 
+    // MARK: - Warm pool
+
+    /// Returns a copy of this manager backed by a pool of pre-booted VMs.
+    /// The pool starts filling immediately; `create` hands out a pooled VM
+    /// when one of the requested shape is idle and falls back to a normal
+    /// boot otherwise. Pooled VMs restore from the snapshot template set
+    /// before this call, if any. Call ``shutdownWarmPool()`` to stop idle VMs.
+    public func withWarmPool(_ config: CHWarmPool.Configuration) -> CHVirtualMachineManager {
+        var copy = self
+        let base = self
+        let pool = CHWarmPool(config: config, logger: logger) { shape in
+            try await base.bootWarmVM(shape)
+        }
+        copy.warmPool = pool
+        Task {
+            await pool.fill()
+        }
+        return copy
+    }
+
+    /// Stop every idle pooled VM. VMs already handed out are unaffected.
+    public func shutdownWarmPool() async {
+        await warmPool?.shutdown()
+    }
+
+    private func bootWarmVM(_ shape: CHWarmPool.Shape) async throws -> CHVirtualMachineInstance {
+        var instanceConfig = CHVirtualMachineInstance.Configuration()
+        instanceConfig.cpus = shape.cpus
+        instanceConfig.memoryInBytes = shape.memoryInBytes
+        instanceConfig.kernel = kernel
+        instanceConfig.initialFilesystem = initialFilesystem
+        if let snapshotTemplate, snapshotTemplate.matches(instanceConfig) {
+            instanceConfig.snapshotTemplate = snapshotTemplate
+        }
+
+        let instance = try CHVirtualMachineInstance(
+            group: group,
+            config: instanceConfig,
+            runtimeRoot: runtimeRoot,
+            chBinary: chBinary,
+            virtiofsdBinary: virtiofsdBinaryOverride,
+            logger: logger
+        )
+        try await instance.start()
+        return instance
+    }
+
+    // MARK: - Snapshot templates
+
+    /// Returns a copy of this manager that restores VMs from `template`
+    /// whenever the requested configuration matches its shape, and cold-boots
+    /// otherwise.
+    public func withSnapshotTemplate(_ template: CHSnapshotTemplate?) -> CHVirtualMachineManager {
+        var copy = self
+        copy.snapshotTemplate = template
+        return copy
+    }
+
+    /// Boot a VM with no container mounts or interfaces, wait for vminitd,
+    /// snapshot it into `directory` and shut it down. The resulting template
+    /// can be handed to ``withSnapshotTemplate(_:)``; sandboxes of the same
+    /// CPU/memory shape then skip kernel boot entirely.
+    public func makeSnapshotTemplate(
+        cpus: Int,
+        memoryInBytes: UInt64,
+        directory: URL
+    ) async throws -> CHSnapshotTemplate {
+        var instanceConfig = CHVirtualMachineInstance.Configuration()
+        instanceConfig.cpus = cpus
+        instanceConfig.memoryInBytes = memoryInBytes
+        instanceConfig.kernel = kernel
+        instanceConfig.initialFilesystem = initialFilesystem
+
+        let instance = try CHVirtualMachineInstance(
+            group: group,
+            config: instanceConfig,
+            runtimeRoot: runtimeRoot,
+            chBinary: chBinary,
+            virtiofsdBinary: virtiofsdBinaryOverride,
+            logger: logger
+        )
+        try await instance.start()
+        do {
+            try await instance.snapshot(into: directory)
+        } catch {
+            try? await instance.stop()
+            throw error
+        }
+        try await instance.stop()
+
+        let template = CHSnapshotTemplate(
+            directory: directory,
+            cpus: cpus,
+            memoryInBytes: memoryInBytes,
+            kernelPath: kernel.path.path,
+            kernelCommandLine: kernel.linuxCommandline(initialFilesystem: initialFilesystem),
+            initialFilesystemSource: initialFilesystem.source
+        )
+        try template.writeManifest()
+        return template
+    }
+
     // MARK: - Binary resolution
 
     /// Resolve a binary path, accepting an explicit override or falling back to
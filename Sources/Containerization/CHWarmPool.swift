@@ -0,0 +1,152 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+#if os(Linux)
+import Foundation
+import Logging
+
+/// A pool of cloud-hypervisor VMs that have already booted their kernel and
+/// connected to vminitd, kept per CPU/memory shape so sandbox creation does
+/// not pay for kernel boot.
+///
+/// Pooled VMs have no container mounts or interfaces; the instance that
+/// adopts one hotplugs those on `start()`. Taking a VM schedules a
+/// replacement in the background. Replacement boots are spaced at least
+/// `minimumBootInterval` apart so a burst of `create` calls doesn't turn into
+/// a burst of concurrent kernel boots on the host.
+public actor CHWarmPool {
+    /// The VM shape a pooled instance was booted with. The kernel and
+    /// initial filesystem are fixed per manager, so only the sizing varies.
+    public struct Shape: Sendable, Hashable {
+        public var cpus: Int
+        public var memoryInBytes: UInt64
+
+        public init(cpus: Int, memoryInBytes: UInt64) {
+            self.cpus = cpus
+            self.memoryInBytes = CHVirtualMachineInstance.alignMemorySize(memoryInBytes)
+        }
+    }
+
+    public struct Configuration: Sendable {
+        /// Number of idle VMs to keep ready for each shape.
+        public var targets: [Shape: Int]
+        /// Minimum spacing between two background boots.
+        public var minimumBootInterval: Duration
+
+        public init(targets: [Shape: Int], minimumBootInterval: Duration = .milliseconds(250)) {
+            self.targets = targets
+            self.minimumBootInterval = minimumBootInterval
+        }
+    }
+
+    typealias Boot = @Sendable (Shape) async throws -> CHVirtualMachineInstance
+
+    private let config: Configuration
+    private let boot: Boot
+    private let logger: Logger?
+    private var idle: [Shape: [CHVirtualMachineInstance]] = [:]
+    private var booting: [Shape: Int] = [:]
+    private var nextBootSlot: ContinuousClock.Instant = .now
+    private var closed = false
+
+    init(config: Configuration, logger: Logger?, boot: @escaping Boot) {
+        self.config = config
+        self.boot = boot
+        self.logger = logger
+    }
+
+    /// Number of idle VMs currently held for `shape`.
+    public func available(_ shape: Shape) -> Int {
+        idle[shape]?.count ?? 0
+    }
+
+    /// Start filling the pool up to its targets.
+    func fill() {
+        for shape in config.targets.keys {
+            replenish(shape)
+        }
+    }
+
+    /// Hand out an idle VM of `shape`, or nil if none is ready. Always
+    /// schedules a replacement.
+    func take(_ shape: Shape) -> CHVirtualMachineInstance? {
+        defer { replenish(shape) }
+        while var vms = idle[shape], !vms.isEmpty {
+            let vm = vms.removeFirst()
+            idle[shape] = vms
+            // The instance still reports `.running` if its cloud-hypervisor
+            // exited while the VM sat idle, so check the process as well.
+            // Drop dead VMs, reclaiming their workdir, and try the next one.
+            if vm.state == .running && !vm.chProcess.hasExited {
+                return vm
+            }
+            logger?.warning("discarding warm VM in state \(vm.state), vmm exited: \(vm.chProcess.hasExited)")
+            Task {
+                try? await vm.stop()
+            }
+        }
+        return nil
+    }
+
+    /// Stop every idle VM and stop replenishing.
+    public func shutdown() async {
+        closed = true
+        let vms = idle.values.flatMap { $0 }
+        idle.removeAll()
+        for vm in vms {
+            try? await vm.stop()
+        }
+    }
+
+    private func replenish(_ shape: Shape) {
+        guard !closed, let target = config.targets[shape] else {
+            return
+        }
+        let deficit = target - (idle[shape]?.count ?? 0) - (booting[shape] ?? 0)
+        guard deficit > 0 else {
+            return
+        }
+        for _ in 0..<deficit {
+            booting[shape, default: 0] += 1
+            let slot = max(ContinuousClock.now, nextBootSlot)
+            nextBootSlot = slot.advanced(by: config.minimumBootInterval)
+            Task {
+                await self.bootOne(shape, at: slot)
+            }
+        }
+    }
+
+    private func bootOne(_ shape: Shape, at slot: ContinuousClock.Instant) async {
+        defer { booting[shape, default: 1] -= 1 }
+        try? await Task.sleep(until: slot, clock: .continuous)
+        guard !closed else {
+            return
+        }
+        do {
+            let vm = try await boot(shape)
+            if closed {
+                try? await vm.stop()
+                return
+            }
+            idle[shape, default: []].append(vm)
+        } catch {
+            // Don't retry here: a persistent failure (missing kernel, KVM
+            // unavailable) would spin. The next `take` schedules another try.
+            logger?.error("failed to boot warm VM: \(error)")
+        }
+    }
+}
+#endif
@@ -32,17 +32,23 @@ public struct DNS: Sendable {
     public var searchDomains: [String]
     /// The DNS options to use.
     public var options: [String]
+    /// Resolve through a caching stub resolver that the guest agent runs on
+    /// a loopback address, shared by every container in the VM. The stub
+    /// forwards to `nameservers`.
+    public var localCache: Bool
 
     public init(
         nameservers: [String] = defaultNameservers,
         domain: String? = nil,
         searchDomains: [String] = [],
-        options: [String] = []
+        options: [String] = [],
+        localCache: Bool = false
     ) {
         self.nameservers = nameservers
         self.domain = domain
         self.searchDomains = searchDomains
         self.options = options
+        self.localCache = localCache
     }
 
     /// Validates the DNS configuration.
@@ -70,7 +76,9 @@ extension DNS {
     public var resolvConf: String {
         var text = ""
 
-        if !nameservers.isEmpty {
+        if localCache {
+            text += "nameserver \(DNSStubResolver.defaultAddress)\n"
+        } else if !nameservers.isEmpty {
             text += nameservers.map { "nameserver \($0)" }.joined(separator: "\n") + "\n"
         }
 
@@ -0,0 +1,829 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+import ContainerizationError
+import ContainerizationOS
+import Foundation
+import Synchronization
+
+#if canImport(Musl)
+import Musl
+private let _SOCK_DGRAM = SOCK_DGRAM
+private let _SOCK_STREAM = SOCK_STREAM
+#elseif canImport(Glibc)
+import Glibc
+private let _SOCK_DGRAM = Int32(SOCK_DGRAM.rawValue)
+private let _SOCK_STREAM = Int32(SOCK_STREAM.rawValue)
+#elseif canImport(Darwin)
+import Darwin
+private let _SOCK_DGRAM = SOCK_DGRAM
+private let _SOCK_STREAM = SOCK_STREAM
+#endif
+
+/// A small caching DNS forwarder run by the guest agent so containers don't
+/// each pay a round trip to the upstream nameserver for every lookup.
+///
+/// Queries arrive over UDP and TCP on `Configuration.listenAddress`. The
+/// resolver answers them, in order, from:
+/// - the hosts table (A and AAAA only), as `/etc/hosts` would;
+/// - the cache, holding positive answers for their smallest TTL and
+///   negative answers for the SOA minimum (RFC 2308);
+/// - an in-flight upstream lookup for the same question, so a burst of
+///   identical queries costs one upstream round trip;
+/// - a new upstream query, retried across upstreams until
+///   `Configuration.attempts` timeouts, then SERVFAIL.
+///
+/// A UDP client that didn't advertise EDNS gets a truncated reply when the
+/// answer won't fit in 512 bytes, and retries over TCP. TCP misses are
+/// forwarded over TCP, one connection per query, so the answer arrives
+/// whole; they don't join UDP lookups, whose answers may be truncated.
+///
+/// Hit and miss counters are available from `statistics` and, as dnsmasq
+/// does, as CHAOS TXT records named `hits.bind` and `misses.bind`.
+///
+/// All state is owned by one serial queue.
+public final class DNSStubResolver: Sendable {
+    /// The address resolv.conf should name when the cache is enabled.
+    public static let defaultAddress = "127.0.0.53"
+
+    public struct Configuration: Sendable {
+        /// Address to accept queries on.
+        public var listenAddress: String
+        /// Port to accept queries on; 0 picks one (see `port`).
+        public var listenPort: UInt16
+        /// Nameservers to forward misses to, tried in order.
+        public var upstreams: [String]
+        /// Port the upstream nameservers listen on.
+        public var upstreamPort: UInt16
+        /// Cached questions kept before the oldest are evicted.
+        public var maxEntries: Int
+        /// Upper bound on how long any answer is cached, in seconds.
+        public var maxTTL: UInt32
+        /// How long to wait for an upstream before trying the next.
+        public var upstreamTimeout: Duration
+        /// Upstream sends per query before answering SERVFAIL.
+        public var attempts: Int
+
+        public init(
+            listenAddress: String = DNSStubResolver.defaultAddress,
+            listenPort: UInt16 = 53,
+            upstreams: [String],
+            upstreamPort: UInt16 = 53,
+            maxEntries: Int = 4096,
+            maxTTL: UInt32 = 86400,
+            upstreamTimeout: Duration = .seconds(2),
+            attempts: Int = 3
+        ) {
+            self.listenAddress = listenAddress
+            self.listenPort = listenPort
+            self.upstreams = upstreams
+            self.upstreamPort = upstreamPort
+            self.maxEntries = maxEntries
+            self.maxTTL = maxTTL
+            self.upstreamTimeout = upstreamTimeout
+            self.attempts = attempts
+        }
+    }
+
+    public struct Statistics: Sendable, Equatable {
+        /// Queries answered from the cache, including `negativeHits`.
+        public var hits: UInt64 = 0
+        /// Cache hits that were NXDOMAIN or no-data answers.
+        public var negativeHits: UInt64 = 0
+        /// Queries that started an upstream lookup.
+        public var misses: UInt64 = 0
+        /// Queries that joined another query's upstream lookup.
+        public var coalesced: UInt64 = 0
+        /// Queries answered from the hosts table.
+        public var localAnswers: UInt64 = 0
+        /// Upstream lookups that ran out of attempts.
+        public var upstreamFailures: UInt64 = 0
+        /// Questions currently cached.
+        public var entries: Int = 0
+
+        /// The fraction of upstream-bound queries that didn't need their own
+        /// upstream round trip.
+        public var hitRate: Double {
+            let total = hits + coalesced + misses
+            return total == 0 ? 0 : Double(hits + coalesced) / Double(total)
+        }
+    }
+
+    private let configuration: Configuration
+    private let queue: DispatchQueue
+
+    // Queue-owned; see `Core`.
+    private nonisolated(unsafe) let core = Core()
+
+    private struct Entry {
+        var response: [UInt8]
+        var questionEnd: Int
+        var stored: ContinuousClock.Instant
+        var expires: ContinuousClock.Instant
+        var negative: Bool
+    }
+
+    private enum Client {
+        case datagram(InetType)
+        case stream(StreamConnection)
+    }
+
+    private struct Waiter {
+        var client: Client
+        var id: UInt16
+        var edns: Bool
+    }
+
+    /// A connection carrying length-prefixed messages (RFC 7766): a TCP
+    /// client, or a TCP query to an upstream. The fd is closed once it is
+    /// closed and every source on it has been cancelled.
+    private final class StreamConnection {
+        let fd: Int32
+        var input: [UInt8] = []
+        var output: [UInt8] = []
+        var reader: DispatchSourceRead?
+        var writer: DispatchSourceWrite?
+        var sources = 0
+        var deadline: ContinuousClock.Instant
+        var closed = false
+        var onMessage: (([UInt8]) -> Void)?
+        var onClose: (() -> Void)?
+
+        init(fd: Int32, deadline: ContinuousClock.Instant) {
+            self.fd = fd
+            self.deadline = deadline
+        }
+
+        func sourceCancelled() {
+            sources -= 1
+            if sources == 0 && closed {
+                close(fd)
+            }
+        }
+    }
+
+    private final class Lookup {
+        let question: DNSWire.Question
+        var query: [UInt8]
+        var questionEnd: Int
+        var upstreamID: UInt16 = 0
+        var waiters: [Waiter] = []
+        var sends = 0
+        var upstream = 0
+        var deadline: ContinuousClock.Instant = .now
+        /// The upstream connection of a lookup made over TCP.
+        var stream: StreamConnection?
+
+        init(question: DNSWire.Question, query: [UInt8], questionEnd: Int) {
+            self.question = question
+            self.query = query
+            self.questionEnd = questionEnd
+        }
+    }
+
+    /// Sockets, tables and counters. Owned by the resolver's queue.
+    private final class Core {
+        var listenFd: Int32 = -1
+        var port: UInt16 = 0
+        var upstreamFds: [Int32: Int32] = [:]
+        var sources: [DispatchSourceRead] = []
+        var timer: DispatchSourceTimer?
+        var upstreams: [InetType] = []
+        var hosts: [String: (v4: [[UInt8]], v6: [[UInt8]])] = [:]
+        var cache: [DNSWire.Question: Entry] = [:]
+        var inflight: [DNSWire.Question: Lookup] = [:]
+        var byUpstreamID: [UInt16: Lookup] = [:]
+        var clients: [ObjectIdentifier: StreamConnection] = [:]
+        var streamLookups: [ObjectIdentifier: Lookup] = [:]
+        var stats = Statistics()
+        var buffer = [UInt8](repeating: 0, count: 65535)
+        var stopped = false
+    }
+
+    /// TCP clients served at once; more are refused until one leaves.
+    private static let maxStreamClients = 64
+    /// How long a TCP client may sit idle before it is closed.
+    private static let streamIdleTimeout: Duration = .seconds(10)
+
+    public init(configuration: Configuration) {
+        self.configuration = configuration
+        self.queue = DispatchQueue(label: "com.apple.containerization.dns-stub")
+    }
+}
+
+extension DNSStubResolver {
+    /// Binds the listening sockets and starts serving.
+    public func start() throws {
+        try queue.sync {
+            try setUpstreams(configuration.upstreams)
+            let address = try InetType(address: configuration.listenAddress, port: configuration.listenPort)
+            let fd = try Self.makeSocket(domain: address.domain, type: _SOCK_DGRAM)
+            do {
+                try Self.bindSocket(fd, to: address)
+                core.port = Self.boundPort(fd) ?? configuration.listenPort
+            } catch {
+                close(fd)
+                throw error
+            }
+            // TCP on the same port, for clients retrying a truncated answer.
+            let streamFd: Int32
+            do {
+                streamFd = try Self.makeSocket(domain: address.domain, type: _SOCK_STREAM)
+            } catch {
+                close(fd)
+                throw error
+            }
+            do {
+                let streamAddress = try InetType(address: configuration.listenAddress, port: core.port)
+                var one: Int32 = 1
+                setsockopt(streamFd, SOL_SOCKET, SO_REUSEADDR, &one, socklen_t(MemoryLayout<Int32>.size))
+                try Self.bindSocket(streamFd, to: streamAddress)
+                guard listen(streamFd, 64) == 0 else {
+                    throw ContainerizationError(.internalError, message: "failed to listen for DNS over TCP on \(streamAddress): errno \(errno)")
+                }
+            } catch {
+                close(fd)
+                close(streamFd)
+                throw error
+            }
+            core.listenFd = fd
+            core.sources.append(readSource(fd) { [self] in receiveQueries() })
+            core.sources.append(readSource(streamFd) { [self] in acceptClients(streamFd) })
+
+            let interval = max(configuration.upstreamTimeout / 4, .milliseconds(25))
+            let nanos = Int(interval.components.seconds) * 1_000_000_000 + Int(interval.components.attoseconds / 1_000_000_000)
+            let timer = DispatchSource.makeTimerSource(queue: queue)
+            timer.schedule(deadline: .now() + .nanoseconds(nanos), repeating: .nanoseconds(nanos))
+            timer.setEventHandler { [self] in retryExpired() }
+            timer.activate()
+            core.timer = timer
+        }
+    }
+
+    /// Stops serving and closes all sockets. Pending lookups are dropped.
+    public func stop() {
+        queue.sync {
+            guard !core.stopped else {
+                return
+            }
+            core.stopped = true
+            core.timer?.cancel()
+            core.timer = nil
+            for source in core.sources {
+                source.cancel()
+            }
+            core.sources.removeAll()
+            core.inflight.removeAll()
+            core.byUpstreamID.removeAll()
+            let streams = Array(core.clients.values) + core.streamLookups.values.compactMap(\.stream)
+            core.clients.removeAll()
+            core.streamLookups.removeAll()
+            for stream in streams {
+                closeStream(stream)
+            }
+        }
+    }
+
+    /// The port queries are served on, resolved after `start` when
+    /// `listenPort` is 0.
+    public var port: UInt16 {
+        queue.sync { core.port }
+    }
+
+    public var statistics: Statistics {
+        queue.sync {
+            var stats = core.stats
+            stats.entries = core.cache.count
+            return stats
+        }
+    }
+
+    /// Replaces the upstream nameservers. Cached answers are kept.
+    public func update(upstreams: [String]) throws {
+        try queue.sync { try setUpstreams(upstreams) }
+    }
+
+    /// Replaces the hosts table answered locally.
+    public func update(hosts: [Hosts.Entry]) {
+        var table: [String: (v4: [[UInt8]], v6: [[UInt8]])] = [:]
+        for entry in hosts {
+            let v4 = Self.addressBytes(entry.ipAddress, family: AF_INET, count: 4)
+            let v6 = Self.addressBytes(entry.ipAddress, family: AF_INET6, count: 16)
+            guard v4 != nil || v6 != nil else {
+                continue
+            }
+            for name in entry.hostnames {
+                let key = name.lowercased().trimmingCharacters(in: CharacterSet(charactersIn: "."))
+                var addresses = table[key] ?? ([], [])
+                if let v4 { addresses.v4.append(v4) }
+                if let v6 { addresses.v6.append(v6) }
+                table[key] = addresses
+            }
+        }
+        queue.sync { core.hosts = table }
+    }
+
+    /// Drops every cached answer.
+    public func flush() {
+        queue.sync { core.cache.removeAll() }
+    }
+}
+
+// MARK: - Queries
+
+extension DNSStubResolver {
+    private func receiveQueries() {
+        while case let (query, client)? = receive(core.listenFd) {
+            handleQuery(query, from: .datagram(client))
+        }
+    }
+
+    private func acceptClients(_ listenFd: Int32) {
+        while true {
+            let fd = accept(listenFd, nil, nil)
+            if fd < 0 {
+                if errno == EINTR { continue }
+                return
+            }
+            guard core.clients.count < Self.maxStreamClients, Self.configure(fd) else {
+                close(fd)
+                continue
+            }
+            let client = StreamConnection(fd: fd, deadline: .now + Self.streamIdleTimeout)
+            core.clients[ObjectIdentifier(client)] = client
+            client.onMessage = { [self, unowned client] query in
+                client.deadline = .now + Self.streamIdleTimeout
+                handleQuery(query, from: .stream(client))
+            }
+            client.onClose = { [self, unowned client] in
+                core.clients[ObjectIdentifier(client)] = nil
+            }
+            openStream(client)
+        }
+    }
+
+    private func handleQuery(_ query: [UInt8], from client: Client) {
+        guard query.count >= DNSWire.headerSize, !DNSWire.isResponse(query) else {
+            return
+        }
+        guard DNSWire.opcode(query) == 0, case let (question, questionEnd)? = DNSWire.question(in: query) else {
+            let header = Array(query[0..<DNSWire.headerSize])
+            var reply = DNSWire.response(to: header, questionEnd: DNSWire.headerSize, rcode: DNSWire.rcodeFormErr)
+            DNSWire.put16(&reply, 4, 0)
+            send(reply, to: client)
+            return
+        }
+        let waiter = Waiter(client: client, id: DNSWire.id(query), edns: DNSWire.additionalCount(query) > 0)
+
+        if question.qclass == DNSWire.classCH {
+            answerChaos(query, question: question, questionEnd: questionEnd, waiter: waiter)
+            return
+        }
+        if question.qclass == DNSWire.classIN, question.type == DNSWire.typeA || question.type == DNSWire.typeAAAA,
+            let addresses = core.hosts[question.name]
+        {
+            core.stats.localAnswers += 1
+            let isV4 = question.type == DNSWire.typeA
+            let answers = (isV4 ? addresses.v4 : addresses.v6).map {
+                (type: question.type, qclass: DNSWire.classIN, ttl: UInt32(0), rdata: $0)
+            }
+            reply(DNSWire.response(to: query, questionEnd: questionEnd, rcode: DNSWire.rcodeNoError, answers: answers), questionEnd, to: waiter)
+            return
+        }
+
+        let now = ContinuousClock.now
+        if let entry = core.cache[question] {
+            if entry.expires > now {
+                core.stats.hits += 1
+                if entry.negative {
+                    core.stats.negativeHits += 1
+                }
+                var response = entry.response
+                let age = UInt32((now - entry.stored).components.seconds)
+                DNSWire.age(&response, questionEnd: entry.questionEnd, by: age)
+                reply(response, entry.questionEnd, to: waiter)
+                return
+            }
+            core.cache[question] = nil
+        }
+        if let lookup = core.inflight[question] {
+            core.stats.coalesced += 1
+            lookup.waiters.append(waiter)
+            return
+        }
+
+        core.stats.misses += 1
+        let lookup = Lookup(question: question, query: query, questionEnd: questionEnd)
+        lookup.waiters.append(waiter)
+        if case .stream = client {
+            sendUpstreamStream(lookup)
+            return
+        }
+        core.inflight[question] = lookup
+        sendUpstream(lookup)
+    }
+
+    private func answerChaos(_ query: [UInt8], question: DNSWire.Question, questionEnd: Int, waiter: Waiter) {
+        let value: UInt64?
+        switch (question.type, question.name) {
+        case (DNSWire.typeTXT, "hits.bind"):
+            value = core.stats.hits
+        case (DNSWire.typeTXT, "misses.bind"):
+            value = core.stats.misses
+        case (DNSWire.typeTXT, "cachesize.bind"):
+            value = UInt64(configuration.maxEntries)
+        default:
+            value = nil
+        }
+        guard let value else {
+            reply(DNSWire.response(to: query, questionEnd: questionEnd, rcode: DNSWire.rcodeRefused), questionEnd, to: waiter)
+            return
+        }
+        let answer = (type: DNSWire.typeTXT, qclass: DNSWire.classCH, ttl: UInt32(0), rdata: DNSWire.txt("\(value)"))
+        reply(DNSWire.response(to: query, questionEnd: questionEnd, rcode: DNSWire.rcodeNoError, answers: [answer]), questionEnd, to: waiter)
+    }
+
+    /// Sends `response` to a waiting client under its own query ID. UDP
+    /// clients that didn't advertise EDNS get a truncated reply when it won't
+    /// fit in 512 bytes, so they retry over TCP.
+    private func reply(_ response: [UInt8], _ questionEnd: Int, to waiter: Waiter) {
+        var response = response
+        DNSWire.put16(&response, 0, waiter.id)
+        if case .datagram = waiter.client, !waiter.edns && response.count > DNSWire.classicUDPSize {
+            response = DNSWire.truncated(response, questionEnd: questionEnd)
+        }
+        send(response, to: waiter.client)
+    }
+}
+
+// MARK: - Upstream
+
+extension DNSStubResolver {
+    private func setUpstreams(_ addresses: [String]) throws {
+        guard !addresses.isEmpty else {
+            throw ContainerizationError(.invalidArgument, message: "DNS stub resolver needs at least one upstream nameserver")
+        }
+        let upstreams = try addresses.map { try InetType(address: $0, port: configuration.upstreamPort) }
+        for upstream in upstreams where core.upstreamFds[upstream.domain] == nil {
+            let fd = try Self.makeSocket(domain: upstream.domain, type: _SOCK_DGRAM)
+            core.upstreamFds[upstream.domain] = fd
+            core.sources.append(readSource(fd) { [self] in receiveResponses(fd) })
+        }
+        core.upstreams = upstreams
+    }
+
+    private func sendUpstream(_ lookup: Lookup) {
+        if lookup.sends == 0 {
+            var id = UInt16.random(in: .min ... .max)
+            while core.byUpstreamID[id] != nil {
+                id &+= 1
+            }
+            lookup.upstreamID = id
+            core.byUpstreamID[id] = lookup
+            DNSWire.put16(&lookup.query, 0, id)
+        }
+        let upstream = core.upstreams[lookup.upstream % core.upstreams.count]
+        lookup.sends += 1
+        lookup.deadline = .now + configuration.upstreamTimeout
+        if let fd = core.upstreamFds[upstream.domain] {
+            send(lookup.query, to: upstream, on: fd)
+        }
+    }
+
+    private func receiveResponses(_ fd: Int32) {
+        while case let (response, from)? = receive(fd) {
+            guard response.count >= DNSWire.headerSize, DNSWire.isResponse(response),
+                core.upstreams.contains(where: { $0.address == from.address && $0.port == from.port }),
+                let lookup = core.byUpstreamID[DNSWire.id(response)],
+                case let (question, questionEnd)? = DNSWire.question(in: response), question == lookup.question
+            else {
+                continue
+            }
+            core.byUpstreamID[lookup.upstreamID] = nil
+            core.inflight[question] = nil
+
+            if case let (ttl, negative)? = DNSWire.cacheTTL(of: response, questionEnd: questionEnd, maxTTL: configuration.maxTTL) {
+                store(question, Entry(response: response, questionEnd: questionEnd, stored: .now, expires: .now + .seconds(ttl), negative: negative))
+            }
+            for waiter in lookup.waiters {
+                reply(response, questionEnd, to: waiter)
+            }
+        }
+    }
+
+    /// Sends `lookup` to the next upstream over a new TCP connection.
+    private func sendUpstreamStream(_ lookup: Lookup) {
+        let upstream = core.upstreams[lookup.upstream % core.upstreams.count]
+        lookup.sends += 1
+        lookup.deadline = .now + configuration.upstreamTimeout
+        DNSWire.put16(&lookup.query, 0, UInt16.random(in: .min ... .max))
+        guard let fd = try? Self.makeSocket(domain: upstream.domain, type: _SOCK_STREAM) else {
+            upstreamStreamFailed(lookup)
+            return
+        }
+        var rc: Int32 = -1
+        try? upstream.withSockAddr { addr, len in
+            rc = connect(fd, addr, socklen_t(len))
+        }
+        guard rc == 0 || errno == EINPROGRESS else {
+            close(fd)
+            upstreamStreamFailed(lookup)
+            return
+        }
+        let stream = StreamConnection(fd: fd, deadline: lookup.deadline)
+        lookup.stream = stream
+        core.streamLookups[ObjectIdentifier(stream)] = lookup
+        stream.onMessage = { [self, unowned stream] response in
+            guard response.count >= DNSWire.headerSize, DNSWire.isResponse(response),
+                DNSWire.id(response) == DNSWire.id(lookup.query),
+                case let (question, questionEnd)? = DNSWire.question(in: response), question == lookup.question,
+                core.streamLookups.removeValue(forKey: ObjectIdentifier(stream)) != nil
+            else {
+                return
+            }
+            closeStream(stream)
+            if case let (ttl, negative)? = DNSWire.cacheTTL(of: response, questionEnd: questionEnd, maxTTL: configuration.maxTTL) {
+                store(question, Entry(response: response, questionEnd: questionEnd, stored: .now, expires: .now + .seconds(ttl), negative: negative))
+            }
+            for waiter in lookup.waiters {
+                reply(response, questionEnd, to: waiter)
+            }
+        }
+        stream.onClose = { [self, unowned stream] in
+            // Closed before answering: refused, reset or timed out.
+            if core.streamLookups.removeValue(forKey: ObjectIdentifier(stream)) != nil {
+                upstreamStreamFailed(lookup)
+            }
+        }
+        openStream(stream)
+        writeStream(stream, lookup.query)
+    }
+
+    private func upstreamStreamFailed(_ lookup: Lookup) {
+        lookup.stream = nil
+        if lookup.sends < configuration.attempts {
+            lookup.upstream += 1
+            sendUpstreamStream(lookup)
+            return
+        }
+        core.stats.upstreamFailures += 1
+        let failure = DNSWire.response(to: lookup.query, questionEnd: lookup.questionEnd, rcode: DNSWire.rcodeServFail)
+        for waiter in lookup.waiters {
+            reply(failure, lookup.questionEnd, to: waiter)
+        }
+    }
+
+    private func store(_ question: DNSWire.Question, _ entry: Entry) {
+        if core.cache.count >= configuration.maxEntries && core.cache[question] == nil {
+            let now = ContinuousClock.now
+            core.cache = core.cache.filter { $0.value.expires > now }
+            // Still full: evict whatever expires soonest.
+            if core.cache.count >= configuration.maxEntries,
+                let victim = core.cache.min(by: { $0.value.expires < $1.value.expires })?.key
+            {
+                core.cache[victim] = nil
+            }
+        }
+        core.cache[question] = entry
+    }
+
+    /// Resends lookups whose upstream didn't answer in time to the next
+    /// upstream, and fails those out of attempts with SERVFAIL. Also closes
+    /// idle TCP clients.
+    private func retryExpired() {
+        let now = ContinuousClock.now
+        for stream in core.clients.values where stream.deadline <= now {
+            closeStream(stream)
+        }
+        for lookup in core.streamLookups.values where lookup.deadline <= now {
+            if let stream = lookup.stream {
+                closeStream(stream)
+            }
+        }
+        for lookup in core.inflight.values where lookup.deadline <= now {
+            if lookup.sends < configuration.attempts {
+                lookup.upstream += 1
+                sendUpstream(lookup)
+                continue
+            }
+            core.stats.upstreamFailures += 1
+            core.inflight[lookup.question] = nil
+            core.byUpstreamID[lookup.upstreamID] = nil
+            let failure = DNSWire.response(to: lookup.query, questionEnd: lookup.questionEnd, rcode: DNSWire.rcodeServFail)
+            for waiter in lookup.waiters {
+                reply(failure, lookup.questionEnd, to: waiter)
+            }
+        }
+    }
+}
+
+// MARK: - Sockets
+
+extension DNSStubResolver {
+    private static func makeSocket(domain: Int32, type: Int32) throws -> Int32 {
+        let fd = socket(domain, type, 0)
+        guard fd >= 0 else {
+            throw ContainerizationError(.internalError, message: "failed to create socket: errno \(errno)")
+        }
+        guard configure(fd) else {
+            close(fd)
+            throw ContainerizationError(.internalError, message: "failed to make fd \(fd) non-blocking: errno \(errno)")
+        }
+        return fd
+    }
+
+    /// Makes `fd` non-blocking and close-on-exec.
+    private static func configure(_ fd: Int32) -> Bool {
+        let flags = fcntl(fd, F_GETFL)
+        guard flags != -1, fcntl(fd, F_SETFL, flags | O_NONBLOCK) != -1 else {
+            return false
+        }
+        _ = fcntl(fd, F_SETFD, FD_CLOEXEC)
+        return true
+    }
+
+    private static func bindSocket(_ fd: Int32, to address: InetType) throws {
+        try address.beforeBind(fd: fd)
+        var rc: Int32 = 0
+        try address.withSockAddr { ptr, len in
+            rc = bind(fd, ptr, socklen_t(len))
+        }
+        guard rc == 0 else {
+            throw ContainerizationError(.internalError, message: "failed to bind DNS stub on \(address): errno \(errno)")
+        }
+    }
+
+    private static func boundPort(_ fd: Int32) -> UInt16? {
+        var addr = sockaddr_storage()
+        var len = socklen_t(MemoryLayout<sockaddr_storage>.size)
+        let rc = withUnsafeMutablePointer(to: &addr) {
+            $0.withMemoryRebound(to: sockaddr.self, capacity: 1) { getsockname(fd, $0, &len) }
+        }
+        guard rc == 0 else {
+            return nil
+        }
+        return InetType(sockaddr: addr)?.port
+    }
+
+    private static func addressBytes(_ address: String, family: Int32, count: Int) -> [UInt8]? {
+        var bytes = [UInt8](repeating: 0, count: count)
+        let rc = bytes.withUnsafeMutableBytes { inet_pton(family, address, $0.baseAddress) }
+        return rc == 1 ? bytes : nil
+    }
+
+    private func readSource(_ fd: Int32, _ handler: @escaping () -> Void) -> DispatchSourceRead {
+        let source = DispatchSource.makeReadSource(fileDescriptor: fd, queue: queue)
+        source.setEventHandler(handler: handler)
+        source.setCancelHandler { close(fd) }
+        source.activate()
+        return source
+    }
+
+    /// Reads one datagram, or nil once the socket is drained.
+    private func receive(_ fd: Int32) -> ([UInt8], InetType)? {
+        while true {
+            var addr = sockaddr_storage()
+            var len = socklen_t(MemoryLayout<sockaddr_storage>.size)
+            let n = core.buffer.withUnsafeMutableBytes { buf in
+                withUnsafeMutablePointer(to: &addr) {
+                    $0.withMemoryRebound(to: sockaddr.self, capacity: 1) {
+                        recvfrom(fd, buf.baseAddress, buf.count, 0, $0, &len)
+                    }
+                }
+            }
+            if n < 0 {
+                if errno == EINTR { continue }
+                // EAGAIN, or ICMP feedback from an unreachable upstream.
+                return nil
+            }
+            guard let from = InetType(sockaddr: addr) else {
+                continue
+            }
+            return (Array(core.buffer[0..<n]), from)
+        }
+    }
+
+    private func send(_ message: [UInt8], to client: Client) {
+        switch client {
+        case .datagram(let peer):
+            send(message, to: peer, on: core.listenFd)
+        case .stream(let stream):
+            writeStream(stream, message)
+        }
+    }
+
+    /// Sends one datagram. Like any UDP hop, a message the socket won't take
+    /// is dropped and left to the client's retry.
+    private func send(_ message: [UInt8], to peer: InetType, on fd: Int32) {
+        message.withUnsafeBytes { payload in
+            try? peer.withSockAddr { addr, len in
+                _ = sendto(fd, payload.baseAddress, payload.count, 0, addr, socklen_t(len))
+            }
+        }
+    }
+
+    // MARK: Streams
+
+    private func openStream(_ stream: StreamConnection) {
+        let reader = DispatchSource.makeReadSource(fileDescriptor: stream.fd, queue: queue)
+        reader.setEventHandler { [self] in readStream(stream) }
+        reader.setCancelHandler { stream.sourceCancelled() }
+        stream.sources += 1
+        stream.reader = reader
+        reader.activate()
+    }
+
+    /// Reads what's available and hands each complete message on.
+    private func readStream(_ stream: StreamConnection) {
+        while !stream.closed {
+            let n = core.buffer.withUnsafeMutableBytes { read(stream.fd, $0.baseAddress, $0.count) }
+            if n < 0 {
+                if errno == EINTR { continue }
+                if errno == EAGAIN || errno == EWOULDBLOCK { return }
+            }
+            guard n > 0 else {
+                closeStream(stream)
+                return
+            }
+            stream.input += core.buffer[0..<n]
+            while stream.input.count >= 2 {
+                let length = Int(DNSWire.u16(stream.input, 0))
+                guard stream.input.count >= 2 + length else {
+                    break
+                }
+                let message = Array(stream.input[2..<(2 + length)])
+                stream.input.removeFirst(2 + length)
+                stream.onMessage?(message)
+                if stream.closed {
+                    return
+                }
+            }
+        }
+    }
+
+    private func writeStream(_ stream: StreamConnection, _ message: [UInt8]) {
+        guard !stream.closed, message.count <= Int(UInt16.max) else {
+            return
+        }
+        stream.output += [UInt8(message.count >> 8), UInt8(truncatingIfNeeded: message.count)] + message
+        flushStream(stream)
+    }
+
+    /// Writes pending output, waiting for the socket to drain (or an
+    /// upstream to finish connecting) when it won't take more.
+    private func flushStream(_ stream: StreamConnection) {
+        while !stream.closed && !stream.output.isEmpty {
+            let n = stream.output.withUnsafeBytes { write(stream.fd, $0.baseAddress, $0.count) }
+            if n < 0 {
+                if errno == EINTR { continue }
+                if errno == EAGAIN || errno == EWOULDBLOCK {
+                    if stream.writer == nil {
+                        let writer = DispatchSource.makeWriteSource(fileDescriptor: stream.fd, queue: queue)
+                        writer.setEventHandler { [self] in flushStream(stream) }
+                        writer.setCancelHandler { stream.sourceCancelled() }
+                        stream.sources += 1
+                        stream.writer = writer
+                        writer.activate()
+                    }
+                    return
+                }
+                closeStream(stream)
+                return
+            }
+            stream.output.removeFirst(n)
+        }
+        stream.writer?.cancel()
+        stream.writer = nil
+    }
+
+    private func closeStream(_ stream: StreamConnection) {
+        guard !stream.closed else {
+            return
+        }
+        stream.closed = true
+        stream.writer?.cancel()
+        stream.reader?.cancel()
+        stream.writer = nil
+        stream.reader = nil
+        if stream.sources == 0 {
+            close(stream.fd)
+        }
+        let onClose = stream.onClose
+        stream.onMessage = nil
+        stream.onClose = nil
+        onClose?()
+    }
+}
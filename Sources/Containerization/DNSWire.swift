@@ -0,0 +1,245 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+/// Just enough of the DNS wire format (RFC 1035) for `DNSStubResolver`: it
+/// reads questions and TTLs and builds small answers. Upstream responses are
+/// otherwise passed through untouched.
+enum DNSWire {
+    static let headerSize = 12
+    /// The largest response a client that didn't send EDNS will accept.
+    static let classicUDPSize = 512
+
+    static let typeA: UInt16 = 1
+    static let typeSOA: UInt16 = 6
+    static let typeTXT: UInt16 = 16
+    static let typeAAAA: UInt16 = 28
+    static let typeOPT: UInt16 = 41
+
+    static let classIN: UInt16 = 1
+    static let classCH: UInt16 = 3
+
+    static let rcodeNoError: UInt8 = 0
+    static let rcodeFormErr: UInt8 = 1
+    static let rcodeServFail: UInt8 = 2
+    static let rcodeNXDomain: UInt8 = 3
+    static let rcodeRefused: UInt8 = 5
+
+    /// A query's question, with the name lowercased and without the
+    /// trailing dot. Used as the cache key.
+    struct Question: Hashable, Sendable {
+        var name: String
+        var type: UInt16
+        var qclass: UInt16
+    }
+
+    /// One resource record, located within its message.
+    struct Record {
+        var type: UInt16
+        var ttlOffset: Int
+        var rdata: Range<Int>
+    }
+
+    static func u16(_ b: [UInt8], _ o: Int) -> UInt16 {
+        UInt16(b[o]) << 8 | UInt16(b[o + 1])
+    }
+
+    static func u32(_ b: [UInt8], _ o: Int) -> UInt32 {
+        UInt32(b[o]) << 24 | UInt32(b[o + 1]) << 16 | UInt32(b[o + 2]) << 8 | UInt32(b[o + 3])
+    }
+
+    static func put16(_ b: inout [UInt8], _ o: Int, _ v: UInt16) {
+        b[o] = UInt8(v >> 8)
+        b[o + 1] = UInt8(truncatingIfNeeded: v)
+    }
+
+    static func put32(_ b: inout [UInt8], _ o: Int, _ v: UInt32) {
+        b[o] = UInt8(v >> 24)
+        b[o + 1] = UInt8(truncatingIfNeeded: v >> 16)
+        b[o + 2] = UInt8(truncatingIfNeeded: v >> 8)
+        b[o + 3] = UInt8(truncatingIfNeeded: v)
+    }
+
+    static func id(_ b: [UInt8]) -> UInt16 { u16(b, 0) }
+    static func isResponse(_ b: [UInt8]) -> Bool { b[2] & 0x80 != 0 }
+    static func opcode(_ b: [UInt8]) -> UInt8 { (b[2] >> 3) & 0x0f }
+    static func isTruncated(_ b: [UInt8]) -> Bool { b[2] & 0x02 != 0 }
+    static func rcode(_ b: [UInt8]) -> UInt8 { b[3] & 0x0f }
+    static func questionCount(_ b: [UInt8]) -> Int { Int(u16(b, 4)) }
+    static func answerCount(_ b: [UInt8]) -> Int { Int(u16(b, 6)) }
+    static func additionalCount(_ b: [UInt8]) -> Int { Int(u16(b, 10)) }
+
+    /// Parses the single question of a message. Returns the question and the
+    /// offset just past it.
+    static func question(in b: [UInt8]) -> (Question, Int)? {
+        guard b.count >= headerSize, questionCount(b) == 1,
+            case let (name, end)? = readName(b, at: headerSize), end + 4 <= b.count
+        else {
+            return nil
+        }
+        return (Question(name: name, type: u16(b, end), qclass: u16(b, end + 2)), end + 4)
+    }
+
+    /// Reads a possibly compressed name. Returns it lowercased and the offset
+    /// just past its encoding at `offset`.
+    static func readName(_ b: [UInt8], at offset: Int) -> (String, Int)? {
+        var labels: [String] = []
+        var o = offset
+        var end: Int?
+        var jumps = 0
+        while true {
+            guard o < b.count else { return nil }
+            let len = Int(b[o])
+            if len & 0xc0 == 0xc0 {
+                guard o + 1 < b.count, jumps < 16 else { return nil }
+                if end == nil { end = o + 2 }
+                o = (len & 0x3f) << 8 | Int(b[o + 1])
+                jumps += 1
+                continue
+            }
+            guard len & 0xc0 == 0 else { return nil }
+            if len == 0 {
+                return (labels.joined(separator: "."), end ?? o + 1)
+            }
+            guard o + 1 + len <= b.count else { return nil }
+            labels.append(String(decoding: b[(o + 1)..<(o + 1 + len)], as: UTF8.self).lowercased())
+            o += 1 + len
+        }
+    }
+
+    static func skipName(_ b: [UInt8], at offset: Int) -> Int? {
+        var o = offset
+        while o < b.count {
+            let len = Int(b[o])
+            if len & 0xc0 == 0xc0 {
+                return o + 2 <= b.count ? o + 2 : nil
+            }
+            if len == 0 {
+                return o + 1
+            }
+            o += 1 + len
+        }
+        return nil
+    }
+
+    /// The answer, authority and additional records of a message, each
+    /// tagged with its section (1, 2 or 3). Nil if the message is malformed.
+    static func records(in b: [UInt8], after questionEnd: Int) -> [(section: Int, record: Record)]? {
+        let counts = [Int(u16(b, 6)), Int(u16(b, 8)), Int(u16(b, 10))]
+        var out: [(Int, Record)] = []
+        var o = questionEnd
+        for (i, count) in counts.enumerated() {
+            for _ in 0..<count {
+                guard let nameEnd = skipName(b, at: o), nameEnd + 10 <= b.count else {
+                    return nil
+                }
+                let rdlength = Int(u16(b, nameEnd + 8))
+                let rdata = (nameEnd + 10)..<(nameEnd + 10 + rdlength)
+                guard rdata.upperBound <= b.count else {
+                    return nil
+                }
+                out.append((i + 1, Record(type: u16(b, nameEnd), ttlOffset: nameEnd + 4, rdata: rdata)))
+                o = rdata.upperBound
+            }
+        }
+        return out
+    }
+
+    /// How long a response may be cached, capped at `maxTTL`, and whether it
+    /// is a negative (NXDOMAIN or no data) answer. Nil if it must not be
+    /// cached: errors, truncated replies, zero TTLs, and negative answers
+    /// without an SOA to bound them (RFC 2308).
+    static func cacheTTL(of b: [UInt8], questionEnd: Int, maxTTL: UInt32) -> (ttl: UInt32, negative: Bool)? {
+        guard !isTruncated(b), let records = records(in: b, after: questionEnd) else {
+            return nil
+        }
+        let rc = rcode(b)
+        let ttl: UInt32?
+        let negative: Bool
+        if rc == rcodeNoError && answerCount(b) > 0 {
+            ttl = records.filter { $0.section == 1 }.map { u32(b, $0.record.ttlOffset) }.min()
+            negative = false
+        } else if rc == rcodeNoError || rc == rcodeNXDomain {
+            let soa = records.first { $0.section == 2 && $0.record.type == typeSOA }?.record
+            ttl = soa.flatMap { soa in
+                soa.rdata.count >= 4 ? min(u32(b, soa.ttlOffset), u32(b, soa.rdata.upperBound - 4)) : nil
+            }
+            negative = true
+        } else {
+            return nil
+        }
+        guard let ttl, ttl > 0 else {
+            return nil
+        }
+        return (min(ttl, maxTTL), negative)
+    }
+
+    /// Lowers every record's TTL by `age` seconds, stopping at zero. The OPT
+    /// pseudo-record's TTL field holds flags and is left alone.
+    static func age(_ b: inout [UInt8], questionEnd: Int, by age: UInt32) {
+        guard age > 0, let records = records(in: b, after: questionEnd) else {
+            return
+        }
+        for (_, record) in records where record.type != typeOPT {
+            let ttl = u32(b, record.ttlOffset)
+            put32(&b, record.ttlOffset, ttl > age ? ttl - age : 0)
+        }
+    }
+
+    /// A response to `query` carrying `answers`, each owned by the question
+    /// name. Any EDNS record in the query is not echoed.
+    static func response(
+        to query: [UInt8],
+        questionEnd: Int,
+        rcode: UInt8,
+        answers: [(type: UInt16, qclass: UInt16, ttl: UInt32, rdata: [UInt8])] = []
+    ) -> [UInt8] {
+        var b = Array(query[0..<questionEnd])
+        // QR, keep opcode and RD, set AA and RA.
+        b[2] = 0x80 | (query[2] & 0x79) | 0x04
+        b[3] = 0x80 | rcode
+        put16(&b, 6, UInt16(answers.count))
+        put16(&b, 8, 0)
+        put16(&b, 10, 0)
+        for answer in answers {
+            // A pointer to the question name at the end of the header.
+            b += [0xc0, UInt8(headerSize)]
+            b += [UInt8(answer.type >> 8), UInt8(truncatingIfNeeded: answer.type)]
+            b += [UInt8(answer.qclass >> 8), UInt8(truncatingIfNeeded: answer.qclass)]
+            b += [UInt8(answer.ttl >> 24), UInt8(truncatingIfNeeded: answer.ttl >> 16)]
+            b += [UInt8(truncatingIfNeeded: answer.ttl >> 8), UInt8(truncatingIfNeeded: answer.ttl)]
+            b += [UInt8(answer.rdata.count >> 8), UInt8(truncatingIfNeeded: answer.rdata.count)]
+            b += answer.rdata
+        }
+        return b
+    }
+
+    /// The header and question of `response` with TC set, telling the client
+    /// the full answer doesn't fit in a classic UDP message.
+    static func truncated(_ response: [UInt8], questionEnd: Int) -> [UInt8] {
+        var b = Array(response[0..<questionEnd])
+        b[2] |= 0x02
+        put16(&b, 6, 0)
+        put16(&b, 8, 0)
+        put16(&b, 10, 0)
+        return b
+    }
+
+    /// A TXT record's rdata holding one character-string.
+    static func txt(_ text: String) -> [UInt8] {
+        let bytes = Array(text.utf8.prefix(255))
+        return [UInt8(bytes.count)] + bytes
+    }
+}
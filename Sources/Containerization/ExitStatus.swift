@@ -14,6 +14,7 @@
 // limitations under the License.
 //===----------------------------------------------------------------------===//
 
+import ContainerizationOS
 import Foundation
 
 /// ExitStatus contains the exit code for a given container process,
@@ -23,14 +24,18 @@ public struct ExitStatus: Sendable {
     public var exitCode: Int32
     /// The timestamp when the process exited.
     public var exitedAt: Date
+    /// CPU, memory, fault and I/O counters captured when the guest reaped
+    /// the process. Nil when the guest didn't report them.
+    public var usage: ResourceUsage?
 
     public init(exitCode: Int32) {
         self.exitCode = exitCode
         self.exitedAt = .now
     }
 
-    public init(exitCode: Int32, exitedAt: Date) {
+    public init(exitCode: Int32, exitedAt: Date, usage: ResourceUsage? = nil) {
         self.exitCode = exitCode
         self.exitedAt = exitedAt
+        self.usage = usage
     }
 }
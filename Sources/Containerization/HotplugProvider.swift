@@ -33,6 +33,10 @@ public protocol HotplugProvider: Sendable {
     ///   - additionalMounts: Additional mounts to register
     func registerMounts(id: String, rootfs: AttachedFilesystem, additionalMounts: [Mount]) throws
 
+    /// Remove every mount registered for a container.
+    /// - Parameter id: The container ID
+    func unregisterMounts(id: String)
+
     /// Release a hotplug device.
     /// - Parameter id: The container ID who should be released
     func releaseHotplug(id: String) async throws
@@ -52,5 +56,7 @@ public protocol HotplugProvider: Sendable {
 }
 
 extension HotplugProvider {
+    public func unregisterMounts(id: String) {}
+
     public func cleanup() {}
 }
@@ -20,9 +20,9 @@ import ContainerizationOS
 import Foundation
 
 /// Thin idempotent wrappers around the `iptables` CLI for use by
-/// `BridgeManager`. We don't program nftables directly; modern distros
-/// ship the `iptables` binary as a shim over nftables and it's universally
-/// available.
+/// `BridgeManager` when nftables can't be programmed over netlink (kernel
+/// without `nf_tables`, or a bridge whose rules an earlier version already
+/// wrote through iptables).
 enum IptablesRules {
     /// Add a rule unless it already exists. `args` is the rule body
     /// excluding the leading action (`-A`/`-C`/`-D`).
@@ -40,22 +40,43 @@ public struct LinuxBridgedNetwork: Network {
     public let bridge: String?
     /// MTU applied to every TAP this network creates.
     public let mtu: UInt32
+    /// RX/TX queue pairs for every TAP this network creates, or nil for a
+    /// single-queue TAP.
+    public let queuePairs: Int?
 
     private var allocator: Allocator
     private var taps: [String: TAPDevice]
 
+    /// Where `BridgeManager` keeps bridge state, and the conventional
+    /// `ipamDirectory` for networks on a managed bridge.
+    public static let defaultIPAMDirectory = URL(fileURLWithPath: BridgeManager.stateDir)
+
     /// Per-id rotating IPv4 allocator. Mirrors `VmnetNetwork.Allocator`
     /// verbatim: lower bound = `subnet.lower + 2` (gateway = `lower + 1`,
     /// network = `lower`), size = `upper - lower - 3` (broadcast = `upper`,
     /// also reserved).
+    ///
+    /// With a journal, every operation first folds in what other processes
+    /// on the bridge logged, then logs its own change before returning.
     struct Allocator: Sendable {
-        private let addressAllocator: any AddressAllocator<UInt32>
+        private var addressAllocator: any AddressAllocator<UInt32>
         private let cidr: CIDRv4
         private var allocations: [String: UInt32]
+        private let journal: BridgeIPAMJournal?
 
-        init(cidr: CIDRv4) throws {
+        init(cidr: CIDRv4, journal: BridgeIPAMJournal? = nil) throws {
             self.cidr = cidr
             self.allocations = [:]
+            self.journal = journal
+            self.addressAllocator = try Self.makeAddressAllocator(cidr: cidr)
+            if let journal {
+                try journal.transaction { changes, _ in
+                    try self.apply(changes)
+                }
+            }
+        }
+
+        private static func makeAddressAllocator(cidr: CIDRv4) throws -> any AddressAllocator<UInt32> {
             let span = cidr.upper.value - cidr.lower.value
             guard span >= 4 else {
                 throw ContainerizationError(
@@ -64,13 +85,36 @@ public struct LinuxBridgedNetwork: Network {
                 )
             }
             let size = Int(span - 3)
-            self.addressAllocator = try UInt32.rotatingAllocator(
+            return try UInt32.rotatingAllocator(
                 lower: cidr.lower.value + 2,
                 size: UInt32(size)
             )
         }
 
         mutating func allocate(_ id: String) throws -> CIDRv4 {
+            guard let journal else {
+                return try allocateLocked(id, commit: { _ in })
+            }
+            return try journal.transaction { changes, commit in
+                try self.apply(changes)
+                return try self.allocateLocked(id, commit: commit)
+            }
+        }
+
+        mutating func release(_ id: String) throws {
+            guard let journal else {
+                return try releaseLocked(id, commit: { _ in })
+            }
+            try journal.transaction { changes, commit in
+                try self.apply(changes)
+                try self.releaseLocked(id, commit: commit)
+            }
+        }
+
+        private mutating func allocateLocked(
+            _ id: String,
+            commit: (BridgeIPAMJournal.Entry) throws -> Void
+        ) throws -> CIDRv4 {
             if allocations[id] != nil {
                 throw ContainerizationError(
                     .exists,
@@ -78,16 +122,54 @@ public struct LinuxBridgedNetwork: Network {
                 )
             }
             let index = try addressAllocator.allocate()
+            do {
+                try commit(.allocate(id: id, address: index))
+            } catch {
+                try? addressAllocator.release(index)
+                throw error
+            }
             allocations[id] = index
             return try CIDRv4(IPv4Address(index), prefix: cidr.prefix)
         }
 
-        mutating func release(_ id: String) throws {
+        private mutating func releaseLocked(
+            _ id: String,
+            commit: (BridgeIPAMJournal.Entry) throws -> Void
+        ) throws {
             if let index = allocations[id] {
+                try commit(.release(id: id, address: index))
                 try addressAllocator.release(index)
                 allocations.removeValue(forKey: id)
             }
         }
+
+        /// Fold journal changes from other processes (or a reload) into the
+        /// in-memory allocator. Addresses outside this subnet are ignored.
+        private mutating func apply(_ changes: BridgeIPAMJournal.Changes) throws {
+            switch changes {
+            case .reload(let live):
+                addressAllocator = try Self.makeAddressAllocator(cidr: cidr)
+                allocations = [:]
+                for (id, address) in live {
+                    if (try? addressAllocator.reserve(address)) != nil {
+                        allocations[id] = address
+                    }
+                }
+            case .entries(let entries):
+                for entry in entries {
+                    switch entry {
+                    case .allocate(let id, let address):
+                        if (try? addressAllocator.reserve(address)) != nil {
+                            allocations[id] = address
+                        }
+                    case .release(let id, let address):
+                        if allocations.removeValue(forKey: id) != nil {
+                            try? addressAllocator.release(address)
+                        }
+                    }
+                }
+            }
+        }
     }
 
     /// Create a Linux bridged network.
@@ -99,19 +181,45 @@ public struct LinuxBridgedNetwork: Network {
     ///   - bridge: Existing bridge name to enslave each TAP to, or nil for
     ///     standalone TAPs. Validated at init time via netlink.
     ///   - mtu: MTU applied to every created TAP (default 1500).
+    ///   - queuePairs: RX/TX queue pairs per TAP, typically the sandbox's
+    ///     vCPU count. Values above 1 create multi-queue TAPs and configure
+    ///     cloud-hypervisor with the same count.
+    ///   - ipamDirectory: Directory for a persistent IPAM journal of
+    ///     `bridge`'s assignments, typically
+    ///     ``LinuxBridgedNetwork/defaultIPAMDirectory``. Assignments then
+    ///     survive process restarts and are shared with every other network
+    ///     using the same bridge and directory. Requires `bridge`. When nil,
+    ///     assignments are kept in memory only.
     public init(
         subnet: CIDRv4,
         gateway: IPv4Address? = nil,
         bridge: String? = nil,
-        mtu: UInt32 = 1500
+        mtu: UInt32 = 1500,
+        queuePairs: Int? = nil,
+        ipamDirectory: URL? = nil
     ) throws {
+        if let queuePairs, queuePairs < 1 {
+            throw ContainerizationError(.invalidArgument, message: "invalid queuePairs: \(queuePairs)")
+        }
         self.subnet = subnet
         self.ipv4Gateway = gateway ?? subnet.gateway
         self.bridge = bridge
         self.mtu = mtu
-        self.allocator = try Allocator(cidr: subnet)
+        self.queuePairs = queuePairs
         self.taps = [:]
 
+        var journal: BridgeIPAMJournal?
+        if let ipamDirectory {
+            guard let bridge else {
+                throw ContainerizationError(
+                    .invalidArgument,
+                    message: "a persistent IPAM journal requires a bridge"
+                )
+            }
+            journal = try BridgeIPAMJournal(directory: ipamDirectory, bridge: bridge)
+        }
+        self.allocator = try Allocator(cidr: subnet, journal: journal)
+
         if let bridge {
             // Validate via the public linkGet — empty result or netlink error
             // means the bridge does not exist or is unreachable.
@@ -145,7 +253,8 @@ public struct LinuxBridgedNetwork: Network {
                 name: tapName,
                 bridge: bridge,
                 mtu: mtu,
-                macAddress: nil
+                macAddress: nil,
+                queuePairs: queuePairs ?? 1
             )
         } catch {
             // Roll back the allocator so the IP isn't leaked.
@@ -159,7 +268,8 @@ public struct LinuxBridgedNetwork: Network {
             ipv4Address: cidr,
             ipv4Gateway: ipv4Gateway,
             macAddress: nil,
-            mtu: mtu
+            mtu: mtu,
+            queuePairs: queuePairs
         )
     }
 
@@ -170,6 +280,21 @@ public struct LinuxBridgedNetwork: Network {
         try allocator.release(id)
     }
 
+    /// Release the address `id` holds only if the process that allocated it
+    /// is gone. TAP devices aren't persistent, so a live holder still has
+    /// `id`'s TAP open; a holder that was killed before releasing left only
+    /// its address behind. Returns false if `id` is still in use.
+    @discardableResult
+    public mutating func releaseOrphanedInterface(_ id: String) throws -> Bool {
+        guard taps[id] == nil,
+            !FileManager.default.fileExists(atPath: "/sys/class/net/\(Self.derivedTAPName(forID: id))")
+        else {
+            return false
+        }
+        try allocator.release(id)
+        return true
+    }
+
     /// Derive a deterministic, IFNAMSIZ-compliant TAP name from a container id.
     /// Format: `czt-<10 hex chars>` (14 chars total; IFNAMSIZ-1 = 15).
     static func derivedTAPName(forID id: String) -> String {
@@ -65,6 +65,9 @@ public final class LinuxContainer: Container, Sendable {
         public var interfaces: [any Interface] = []
         /// The Unix domain socket relays to setup for the container.
         public var sockets: [UnixSocketConfiguration] = []
+        /// The host TCP/UDP ports to forward to ports on the container's
+        /// loopback address.
+        public var portForwards: [PortForwardConfiguration] = []
         /// The mounts for the container.
         public var mounts: [Mount] = LinuxContainer.defaultMounts()
         /// Paths inside the container that vmexec hides from the workload.
@@ -85,6 +88,13 @@ public final class LinuxContainer: Container, Sendable {
         public var virtualization: Bool = false
         /// Optional destination for serial boot logs.
         public var bootLog: BootLog?
+        /// Optional recorder for boot-phase latency spans. When set,
+        /// ``LinuxContainer/bootTrace()`` returns the host, VMM and guest
+        /// timeline for this container.
+        public var bootTrace: BootTraceRecorder?
+        /// Host backing for the virtual machine's memory. VMMs that can't
+        /// provide hugepages fall back to standard pages.
+        public var memoryBacking: MemoryBacking = .standard
         /// EXPERIMENTAL: Path in the root filesystem for the virtual
         /// machine where the OCI runtime used to spawn the container lives.
         public var ociRuntimePath: String?
@@ -506,6 +516,15 @@ public final class LinuxContainer: Container, Sendable {
         ]
     }
 
+    /// Run `body`, recording it as a span on the container lane when boot
+    /// tracing is enabled.
+    private func traced<T>(_ name: String, _ body: () async throws -> T) async rethrows -> T {
+        guard let trace = self.config.bootTrace else {
+            return try await body()
+        }
+        return try await trace.span(name, lane: .container, body)
+    }
+
     private static func guestRootfsPath(_ id: String) -> String {
         "/run/container/\(id)/rootfs"
     }
@@ -604,6 +623,9 @@ extension LinuxContainer {
         try await self.state.withLock { state in
             try state.validateForCreate()
 
+            let createStart = BootTraceRecorder.now()
+            defer { self.config.bootTrace?.record("create", lane: .container, start: createStart) }
+
             // This is a bit of an annoyance, but because the type we use for the rootfs is simply
             // the same Mount type we use for non-rootfs mounts, it's possible someone passed 'ro'
             // in the options (which should be perfectly valid). However, the problem is when we go to
@@ -629,7 +651,7 @@ extension LinuxContainer {
                 containerMounts.insert(writableLayer, at: 1)
             }
 
-            let vmConfig = VMConfiguration(
+            var vmConfig = VMConfiguration(
                 cpus: vmCpus,
                 memoryInBytes: vmMemory,
                 interfaces: self.interfaces,
@@ -637,15 +659,17 @@ extension LinuxContainer {
                 bootLog: self.config.bootLog,
                 nestedVirtualization: self.config.virtualization
             )
+            vmConfig.bootTrace = self.config.bootTrace
+            vmConfig.memoryBacking = self.config.memoryBacking
             let creationConfig = StandardVMConfig(configuration: vmConfig)
-            let vm = try await self.vmm.create(config: creationConfig)
+            let vm = try await self.traced("vm.create") { try await self.vmm.create(config: creationConfig) }
             let relayManager = UnixSocketRelayManager(vm: vm, log: self.logger)
 
-            try await vm.start()
+            try await self.traced("vm.start") { try await vm.start() }
             do {
                 let mountsForAgent = containerMounts
                 try await vm.withAgent { agent in
-                    try await agent.standardSetup()
+                    try await self.traced("agent.standardSetup") { try await agent.standardSetup() }
 
                     // Mount the unified virtiofs share at /run/virtiofs only
                     // when at least one of the container's mounts is virtiofs
@@ -699,7 +723,9 @@ extension LinuxContainer {
                         throw ContainerizationError(.notFound, message: "rootfs mount not found")
                     }
                     let rootfsPath = Self.guestRootfsPath(self.id)
-                    try await self.mountRootfs(attachments: attachments, rootfsPath: rootfsPath, agent: agent)
+                    try await self.traced("agent.mountRootfs") {
+                        try await self.mountRootfs(attachments: attachments, rootfsPath: rootfsPath, agent: agent)
+                    }
 
                     // Mount file mount holding directories under /run.
                     if fileMountContext.hasFileMounts {
@@ -721,20 +747,30 @@ extension LinuxContainer {
                         )
                     }
 
+                    for forward in self.config.portForwards {
+                        try await self.forwardPort(
+                            forward,
+                            relayManager: relayManager,
+                            agent: agent
+                        )
+                    }
+
                     // For every interface asked for:
                     // 1. Add the address requested
                     // 2. Online the adapter
                     // 3. For the first interface, add the default route
-                    var defaultRouteSet = false
-                    for (index, i) in self.interfaces.enumerated() {
-                        let name = "eth\(index)"
-                        try await agent.setupInterface(
-                            i,
-                            name: name,
-                            setDefaultRoute: !defaultRouteSet,
-                            logger: self.logger
-                        )
-                        defaultRouteSet = true
+                    try await self.traced("agent.setupInterfaces") {
+                        var defaultRouteSet = false
+                        for (index, i) in self.interfaces.enumerated() {
+                            let name = "eth\(index)"
+                            try await agent.setupInterface(
+                                i,
+                                name: name,
+                                setDefaultRoute: !defaultRouteSet,
+                                logger: self.logger
+                            )
+                            defaultRouteSet = true
+                        }
                     }
 
                     // Setup /etc/resolv.conf and /etc/hosts if asked for.
@@ -761,6 +797,9 @@ extension LinuxContainer {
         try await self.state.withLock { state in
             let createdState = try state.createdState("start")
 
+            let startStart = BootTraceRecorder.now()
+            defer { self.config.bootTrace?.record("start", lane: .container, start: startStart) }
+
             let agent = try await createdState.vm.dialAgent()
             do {
                 var spec = self.generateRuntimeSpec()
@@ -832,7 +871,7 @@ extension LinuxContainer {
                     vm: createdState.vm,
                     logger: self.logger
                 )
-                try await process.start()
+                try await self.traced("process.start") { try await process.start() }
 
                 state = .started(.init(createdState, process: process))
             } catch {
@@ -1126,6 +1165,47 @@ extension LinuxContainer {
         }
     }
 
+    /// Traffic counters and accept latency for each of the container's port
+    /// forwards.
+    public func portForwardStatistics() async throws -> [PortForwardStatistics] {
+        let relayManager = try await self.state.withLock {
+            try $0.startedState("portForwardStatistics").relayManager
+        }
+        return await relayManager.forwardStatistics()
+    }
+
+    /// The boot-latency timeline for this container: host setup, VMM start
+    /// phases and vminitd's own boot, with guest timestamps shifted onto the
+    /// host clock. Requires ``Configuration/bootTrace`` to have been set
+    /// before `create()`.
+    public func bootTrace() async throws -> BootTrace {
+        guard let recorder = self.config.bootTrace else {
+            throw ContainerizationError(.invalidState, message: "boot tracing is not enabled for container \(self.id)")
+        }
+
+        return try await self.state.withLock {
+            let state = try $0.startedState("bootTrace")
+            return try await state.vm.withAgent { agent in
+                guard let vminitd = agent as? Vminitd else {
+                    throw ContainerizationError(.unsupported, message: "bootTrace requires Vminitd agent")
+                }
+
+                var host = recorder.trace
+                let sent = BootTraceRecorder.now()
+                let guest = try await vminitd.bootTrace(containerID: self.id)
+                host.traceEvents.append(
+                    .init(
+                        name: BootTrace.clockAnchorEvent,
+                        lane: .container,
+                        kind: .complete,
+                        timestamp: sent,
+                        duration: BootTraceRecorder.now() - sent
+                    ))
+                return host.merging(guest: guest)
+            }
+        }
+    }
+
     // Perform filesystem operations in the container.
     public func filesystemOperation(operation: FilesystemOperation, path: String) async throws {
         try await self.state.withLock {
@@ -1168,6 +1248,25 @@ extension LinuxContainer {
         try await relayAgent.relaySocket(port: port, configuration: socket)
     }
 
+    private func forwardPort(
+        _ forward: PortForwardConfiguration,
+        relayManager: UnixSocketRelayManager,
+        agent: any VirtualMachineAgent
+    ) async throws {
+        guard let relayAgent = agent as? SocketRelayAgent else {
+            throw ContainerizationError(
+                .unsupported,
+                message: "VirtualMachineAgent does not support port forwarding"
+            )
+        }
+
+        // The guest listens first so the host never accepts a connection it
+        // cannot carry.
+        let port = self.guestVsockPorts.wrappingAdd(1, ordering: .relaxed).oldValue
+        try await relayAgent.forwardPort(port: port, configuration: forward)
+        try await relayManager.startForward(port: port, configuration: forward)
+    }
+
     /// Default chunk size for file transfers (1MiB).
     public static let defaultCopyChunkSize = 1024 * 1024
 
@@ -49,6 +49,9 @@ public final class LinuxPod: Sendable {
         public var virtualization: Bool = false
         /// Optional file path to store serial boot logs.
         public var bootLog: BootLog?
+        /// Host backing for the virtual machine's memory. VMMs that can't
+        /// provide hugepages fall back to standard pages.
+        public var memoryBacking: MemoryBacking = .standard
         /// Whether containers in the pod should share a PID namespace.
         /// When enabled, all containers can see each other's processes.
         public var shareProcessNamespace: Bool = false
@@ -361,6 +364,42 @@ extension LinuxPod {
         config.interfaces
     }
 
+    /// A container to add with ``addContainers(_:)``.
+    public struct ContainerRequest: Sendable {
+        /// The identifier of the container.
+        public var id: String
+        /// The root filesystem of the container.
+        public var rootfs: Mount
+        /// Configures the container.
+        public var configuration: @Sendable (inout ContainerConfiguration) throws -> Void
+
+        public init(
+            id: String,
+            rootfs: Mount,
+            configuration: @Sendable @escaping (inout ContainerConfiguration) throws -> Void
+        ) {
+            self.id = id
+            self.rootfs = rootfs
+            self.configuration = configuration
+        }
+    }
+
+    /// A container whose configuration has been evaluated, ready to be
+    /// registered or hotplugged.
+    private struct PreparedContainer: Sendable {
+        let id: String
+        let rootfs: Mount
+        let config: ContainerConfiguration
+        let fileMountContext: FileMountContext
+
+        var virtioFSMounts: [Mount] {
+            fileMountContext.transformedMounts.filter {
+                if case .virtiofs(_) = $0.runtimeOptions { return true }
+                return false
+            }
+        }
+    }
+
     /// Add a container to the pod.
     ///
     /// When called before `create()`, the container is registered for setup during VM creation.
@@ -371,179 +410,302 @@ extension LinuxPod {
         rootfs: Mount,
         configuration: @Sendable @escaping (inout ContainerConfiguration) throws -> Void
     ) async throws {
-        guard id.count <= Self.maxIDLength else {
-            throw ContainerizationError(
-                .invalidArgument,
-                message: "container id length \(id.count) exceeds maximum of \(Self.maxIDLength) characters"
-            )
-        }
-        try await self.state.withLock { state in
-            guard state.containers[id] == nil else {
+        try await addContainers([ContainerRequest(id: id, rootfs: rootfs, configuration: configuration)])
+    }
+
+    /// Add several containers to the pod at once.
+    ///
+    /// Behaves like calling ``addContainer(_:rootfs:configuration:)`` for each
+    /// container, but after `create()` their devices are hotplugged as one
+    /// batch: the VMM attaches all root filesystems without waiting on the
+    /// guest in between, and the guest discovers the new devices together and
+    /// mounts them concurrently. Either every container is added or none is:
+    /// a failure detaches the batch's devices and undoes its guest mounts,
+    /// mount registrations and socket relays.
+    public func addContainers(_ containers: [ContainerRequest]) async throws {
+        var seen: Set<String> = []
+        for container in containers {
+            guard container.id.count <= Self.maxIDLength else {
+                throw ContainerizationError(
+                    .invalidArgument,
+                    message: "container id length \(container.id.count) exceeds maximum of \(Self.maxIDLength) characters"
+                )
+            }
+            guard seen.insert(container.id).inserted else {
                 throw ContainerizationError(
                     .invalidArgument,
-                    message: "container with id \(id) already exists in pod"
+                    message: "container with id \(container.id) specified more than once"
                 )
             }
+        }
+        try await self.state.withLock { state in
+            var prepared: [PreparedContainer] = []
+            for container in containers {
+                guard state.containers[container.id] == nil else {
+                    throw ContainerizationError(
+                        .invalidArgument,
+                        message: "container with id \(container.id) already exists in pod"
+                    )
+                }
 
-            var config = ContainerConfiguration()
-            try configuration(&config)
+                var config = ContainerConfiguration()
+                try container.configuration(&config)
 
-            let fileMountContext = try FileMountContext.prepare(mounts: config.mounts)
+                prepared.append(
+                    PreparedContainer(
+                        id: container.id,
+                        rootfs: container.rootfs,
+                        config: config,
+                        fileMountContext: try FileMountContext.prepare(mounts: config.mounts)
+                    ))
+            }
 
             switch state.phase {
             case .initialized:
-                state.containers[id] = PodContainer(
-                    id: id,
-                    rootfs: rootfs,
-                    config: config,
-                    state: .registered,
-                    process: nil,
-                    fileMountContext: fileMountContext
-                )
+                for container in prepared {
+                    state.containers[container.id] = PodContainer(
+                        id: container.id,
+                        rootfs: container.rootfs,
+                        config: container.config,
+                        state: .registered,
+                        process: nil,
+                        fileMountContext: container.fileMountContext
+                    )
+                }
 
             case .created(let createdState):
-                let vm = createdState.vm
+                let added = try await self.hotplugContainers(prepared, createdState: createdState)
+                for container in added {
+                    state.containers[container.id] = container
+                }
 
-                var modifiedRootfs = rootfs
-                modifiedRootfs.options.removeAll(where: { $0 == "ro" })
+            case .errored(let err):
+                throw err
+            }
+        }
+    }
 
-                let attachment = try await vm.hotplug(modifiedRootfs, id: id)
+    /// What `setupHotplugged` has done for a batch so far, so a failure
+    /// later in the batch can undo it.
+    private struct HotplugUndo {
+        /// Containers whose mounts are in the VM's mount registry.
+        var registered: [String] = []
+        /// virtiofs shares mounted in the guest for the batch, in order.
+        var guestMounts: [String] = []
+        /// Socket relays started for the batch.
+        var relays: [UnixSocketConfiguration] = []
+    }
 
-                var updatedFileMountContext = fileMountContext
-                do {
-                    let virtioFSMounts = fileMountContext.transformedMounts.filter {
-                        if case .virtiofs(_) = $0.runtimeOptions { return true }
-                        return false
-                    }
-                    if !virtioFSMounts.isEmpty {
-                        try await vm.hotplugVirtioFS(virtioFSMounts, id: id)
-                    }
+    /// Hotplug `containers` into the running VM and set up their runtime
+    /// environment. On failure everything done for the batch is undone and
+    /// every device attached for it is released.
+    private func hotplugContainers(
+        _ containers: [PreparedContainer],
+        createdState: Phase.CreatedState
+    ) async throws -> [PodContainer] {
+        let vm = createdState.vm
+
+        var rootfs: [String: Mount] = [:]
+        for container in containers {
+            var modifiedRootfs = container.rootfs
+            modifiedRootfs.options.removeAll(where: { $0 == "ro" })
+            rootfs[container.id] = modifiedRootfs
+        }
+        let attachments = try await vm.hotplug(rootfs)
+
+        var added: [PodContainer] = []
+        var undo = HotplugUndo()
+        do {
+            for container in containers {
+                let virtioFSMounts = container.virtioFSMounts
+                if !virtioFSMounts.isEmpty {
+                    try await vm.hotplugVirtioFS(virtioFSMounts, id: container.id)
+                }
+            }
 
-                    let agent = try await vm.dialAgent()
-                    do {
-                        var mount = attachment.to
-                        mount.destination = Self.guestRootfsPath(id)
-                        try await agent.mount(mount)
-
-                        // Filter out shared mounts — those are handled separately as
-                        // pod volume bind mounts. Without it here, a container added to an
-                        // already-created would add a duplicated mount into the shared VM.
-                        let nonSharedMounts = fileMountContext.transformedMounts.filter {
-                            if case .shared = $0.runtimeOptions { return false }
-                            return true
-                        }
-                        try vm.registerMounts(
-                            id: id,
-                            rootfs: attachment,
-                            additionalMounts: nonSharedMounts
+            let agent = try await vm.dialAgent()
+            do {
+                // One round trip for every rootfs: the guest waits for all the
+                // new devices together and mounts them concurrently.
+                var rootfsMounts: [ContainerizationOCI.Mount] = []
+                for container in containers {
+                    guard let attachment = attachments[container.id] else {
+                        throw ContainerizationError(
+                            .internalError,
+                            message: "no hotplug attachment for container \(container.id)"
                         )
+                    }
+                    var mount = attachment.to
+                    mount.destination = Self.guestRootfsPath(container.id)
+                    rootfsMounts.append(mount)
+                }
+                try await agent.mount(rootfsMounts)
 
-                        // Mount this container's additional virtiofs shares in the
-                        // guest. create() does this for boot-time containers (the
-                        // /run/virtiofs loop); the hotplug path must do the same or
-                        // the container's bind mounts from /run/virtiofs/<tag> fail
-                        // with ENOENT.
-                        //
-                        // Derive the tags from the additional mounts directly rather
-                        // than from vm.mounts[id], so this is independent of the
-                        // rootfs (which may be virtiofs or virtio-blk) and of mount
-                        // ordering. The rootfs is mounted at /run/container/<id>/rootfs
-                        // and is never consumed from /run/virtiofs.
-                        let newVirtiofsTags = try virtioFSMounts.map { try hashFilePath(path: $0.source) }
-                        if !newVirtiofsTags.isEmpty {
-                            // Tags already mounted in the guest at boot or by a
-                            // prior hotplug (i.e. present on another container).
-                            let alreadyMounted = Set(
-                                vm.mounts
-                                    .filter { $0.key != id }
-                                    .values.flatMap { $0 }
-                                    .filter { $0.type == "virtiofs" }
-                                    .map { $0.source }
-                            )
-                            try await agent.mkdir(path: "/run/virtiofs", all: true, perms: 0o755)
-                            if vm.virtiofsLayout == .perTag {
-                                var seen: Set<String> = []
-                                for tag in newVirtiofsTags
-                                where !alreadyMounted.contains(tag) && seen.insert(tag).inserted {
-                                    let dest = "/run/virtiofs/\(tag)"
-                                    try await agent.mkdir(path: dest, all: true, perms: 0o755)
-                                    try await agent.mount(
-                                        ContainerizationOCI.Mount(
-                                            type: "virtiofs",
-                                            source: tag,
-                                            destination: dest,
-                                            options: []
-                                        ))
-                                }
-                            } else if alreadyMounted.isEmpty {
-                                // Unified layout: one /run/virtiofs mount, needed
-                                // only if nothing mounted it at boot / earlier.
-                                try await agent.mount(
-                                    ContainerizationOCI.Mount(
-                                        type: "virtiofs",
-                                        source: "virtiofs",
-                                        destination: "/run/virtiofs",
-                                        options: []
-                                    ))
-                            }
-                        }
-
-                        if fileMountContext.hasFileMounts {
-                            let containerMounts = vm.mounts[id] ?? []
-                            try await updatedFileMountContext.mountHoldingDirectories(
-                                vmMounts: containerMounts,
-                                agent: agent
-                            )
-                        }
+                for container in containers {
+                    guard let attachment = attachments[container.id] else {
+                        continue
+                    }
+                    added.append(
+                        try await self.setupHotplugged(
+                            container,
+                            attachment: attachment,
+                            createdState: createdState,
+                            agent: agent,
+                            undo: &undo
+                        ))
+                }
 
-                        if let dns = config.dns ?? self.config.dns {
-                            try await agent.configureDNS(
-                                config: dns,
-                                location: Self.guestRootfsPath(id)
-                            )
-                        }
+                try await agent.close()
+            } catch {
+                // Relays first: a live guest relay keeps the rootfs busy.
+                for socket in undo.relays.reversed() {
+                    try? await (agent as? SocketRelayAgent)?.stopSocketRelay(configuration: socket)
+                    try? await createdState.relayManager.stop(socket: socket)
+                }
+                for path in undo.guestMounts.reversed() {
+                    try? await agent.umount(path: path, flags: 0)
+                }
+                for container in containers {
+                    try? await agent.umount(path: Self.guestRootfsPath(container.id), flags: 0)
+                }
+                try? await agent.close()
+                throw error
+            }
+        } catch {
+            for id in undo.registered {
+                vm.unregisterMounts(id: id)
+            }
+            for container in containers {
+                try? await vm.releaseHotplug(id: container.id)
+                try? await vm.releaseVirtioFS(id: container.id)
+            }
+            throw error
+        }
+        return added
+    }
 
-                        if let hosts = config.hosts ?? self.config.hosts {
-                            try await agent.configureHosts(
-                                config: hosts,
-                                location: Self.guestRootfsPath(id)
-                            )
-                        }
+    /// Finish setting up a hotplugged container whose rootfs is already
+    /// mounted in the guest.
+    private func setupHotplugged(
+        _ container: PreparedContainer,
+        attachment: AttachedFilesystem,
+        createdState: Phase.CreatedState,
+        agent: any VirtualMachineAgent,
+        undo: inout HotplugUndo
+    ) async throws -> PodContainer {
+        let vm = createdState.vm
+        let id = container.id
+        let config = container.config
+        let fileMountContext = container.fileMountContext
+        var updatedFileMountContext = fileMountContext
+
+        // Filter out shared mounts — those are handled separately as
+        // pod volume bind mounts. Without it here, a container added to an
+        // already-created would add a duplicated mount into the shared VM.
+        let nonSharedMounts = fileMountContext.transformedMounts.filter {
+            if case .shared = $0.runtimeOptions { return false }
+            return true
+        }
+        try vm.registerMounts(
+            id: id,
+            rootfs: attachment,
+            additionalMounts: nonSharedMounts
+        )
+        undo.registered.append(id)
+
+        // Mount this container's additional virtiofs shares in the
+        // guest. create() does this for boot-time containers (the
+        // /run/virtiofs loop); the hotplug path must do the same or
+        // the container's bind mounts from /run/virtiofs/<tag> fail
+        // with ENOENT.
+        //
+        // Derive the tags from the additional mounts directly rather
+        // than from vm.mounts[id], so this is independent of the
+        // rootfs (which may be virtiofs or virtio-blk) and of mount
+        // ordering. The rootfs is mounted at /run/container/<id>/rootfs
+        // and is never consumed from /run/virtiofs.
+        let newVirtiofsTags = try container.virtioFSMounts.map { try hashFilePath(path: $0.source) }
+        if !newVirtiofsTags.isEmpty {
+            // Tags already mounted in the guest at boot or by a
+            // prior hotplug (i.e. present on another container).
+            let alreadyMounted = Set(
+                vm.mounts
+                    .filter { $0.key != id }
+                    .values.flatMap { $0 }
+                    .filter { $0.type == "virtiofs" }
+                    .map { $0.source }
+            )
+            try await agent.mkdir(path: "/run/virtiofs", all: true, perms: 0o755)
+            if vm.virtiofsLayout == .perTag {
+                var seen: Set<String> = []
+                for tag in newVirtiofsTags
+                where !alreadyMounted.contains(tag) && seen.insert(tag).inserted {
+                    let dest = "/run/virtiofs/\(tag)"
+                    try await agent.mkdir(path: dest, all: true, perms: 0o755)
+                    try await agent.mount(
+                        ContainerizationOCI.Mount(
+                            type: "virtiofs",
+                            source: tag,
+                            destination: dest,
+                            options: []
+                        ))
+                    undo.guestMounts.append(dest)
+                }
+            } else if alreadyMounted.isEmpty {
+                // Unified layout: one /run/virtiofs mount, needed
+                // only if nothing mounted it at boot / earlier.
+                try await agent.mount(
+                    ContainerizationOCI.Mount(
+                        type: "virtiofs",
+                        source: "virtiofs",
+                        destination: "/run/virtiofs",
+                        options: []
+                    ))
+                undo.guestMounts.append("/run/virtiofs")
+            }
+        }
 
-                        for socket in config.sockets {
-                            try await self.relayUnixSocket(
-                                socket: socket,
-                                containerID: id,
-                                relayManager: createdState.relayManager,
-                                agent: agent
-                            )
-                        }
+        if fileMountContext.hasFileMounts {
+            let containerMounts = vm.mounts[id] ?? []
+            try await updatedFileMountContext.mountHoldingDirectories(
+                vmMounts: containerMounts,
+                agent: agent
+            )
+        }
 
-                        try await agent.close()
-                    } catch {
-                        try? await agent.umount(path: Self.guestRootfsPath(id), flags: 0)
-                        try? await agent.close()
-                        throw error
-                    }
+        if let dns = config.dns ?? self.config.dns {
+            try await agent.configureDNS(
+                config: dns,
+                location: Self.guestRootfsPath(id)
+            )
+        }
 
-                    state.containers[id] = PodContainer(
-                        id: id,
-                        rootfs: rootfs,
-                        config: config,
-                        state: .created,
-                        process: nil,
-                        fileMountContext: updatedFileMountContext
-                    )
-                } catch {
-                    try? await vm.releaseHotplug(id: id)
-                    try? await vm.releaseVirtioFS(id: id)
-                    throw error
-                }
+        if let hosts = config.hosts ?? self.config.hosts {
+            try await agent.configureHosts(
+                config: hosts,
+                location: Self.guestRootfsPath(id)
+            )
+        }
 
-            case .errored(let err):
-                throw err
-            }
+        for socket in config.sockets {
+            // Recorded first: a relay can be half started when this throws.
+            undo.relays.append(socket)
+            try await self.relayUnixSocket(
+                socket: socket,
+                containerID: id,
+                relayManager: createdState.relayManager,
+                agent: agent
+            )
         }
+
+        return PodContainer(
+            id: id,
+            rootfs: container.rootfs,
+            config: config,
+            state: .created,
+            process: nil,
+            fileMountContext: updatedFileMountContext
+        )
     }
 
     /// Create and start the underlying pod's virtual machine and set up
@@ -620,6 +782,7 @@ extension LinuxPod {
                 nestedVirtualization: self.config.virtualization
             )
             vmConfig.extensions = self.config.extensions
+            vmConfig.memoryBacking = self.config.memoryBacking
             let creationConfig = StandardVMConfig(configuration: vmConfig)
             let vm = try await self.vmm.create(config: creationConfig)
             let relayManager = UnixSocketRelayManager(vm: vm)
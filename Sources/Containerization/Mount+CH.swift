@@ -15,6 +15,7 @@
 //===----------------------------------------------------------------------===//
 
 import CloudHypervisor
+import ContainerizationError
 import Foundation
 
 extension Mount {
@@ -26,15 +27,117 @@ extension Mount {
     /// the guest.
     ///
     /// `imageType` defaults to `.raw` because Containerization mounts are
-    /// always raw block files (ext4 produced by the EXT4 unpacker, NBD URLs,
-    /// etc.). When cloud-hypervisor doesn't see an `image_type` it falls
-    /// back to `Unknown` and silently rejects all writes — see CH's
-    /// `virtio-devices/src/block.rs` "Attempting to write to sector 0 on a
-    /// disk without specifying image_type" warning.
+    /// raw block files unless stated otherwise (ext4 produced by the EXT4
+    /// unpacker, NBD URLs, etc.). When cloud-hypervisor doesn't see an
+    /// `image_type` it falls back to `Unknown` and silently rejects all
+    /// writes — see CH's `virtio-devices/src/block.rs` "Attempting to write
+    /// to sector 0 on a disk without specifying image_type" warning.
+    ///
+    /// The device gets one virtio queue per vCPU (`cpus`) so the guest's
+    /// blk-mq layer can submit from every CPU without contending on a single
+    /// ring. The mount's runtime options can override that:
+    ///
+    /// - `chNumQueues=<n>`: number of virtio queues.
+    /// - `chQueueSize=<n>`: depth of each queue; a power of two.
+    /// - `chDirect=true|false`: open the backing file with `O_DIRECT`,
+    ///   bypassing the host page cache.
+    /// - `chImageType=raw|qcow2`: on-disk format of the source. A qcow2
+    ///   source may reference a backing file (see `qcow2Overlay(to:)`).
+    ///
+    /// Options for other VMMs (`vz*`) are ignored; unknown or malformed
+    /// `ch*` options throw.
+    public func chDiskConfig(id: String, cpus: Int) throws -> CloudHypervisor.DiskConfig? {
+        guard case .virtioblk(let runtimeOptions) = self.runtimeOptions else {
+            return nil
+        }
+
+        var numQueues = max(cpus, 1)
+        var queueSize: Int?
+        var direct: Bool?
+        var imageType: CloudHypervisor.ImageType = .raw
+        for option in runtimeOptions {
+            let split = option.split(separator: "=")
+            if split.count != 2 {
+                continue
+            }
+
+            let key = String(split[0])
+            let value = String(split[1])
+
+            switch key {
+            case "chNumQueues":
+                guard let n = Int(value), n > 0 else {
+                    throw ContainerizationError(
+                        .invalidArgument,
+                        message: "invalid chNumQueues value for virtio block device: \(value)"
+                    )
+                }
+                numQueues = n
+            case "chQueueSize":
+                guard let n = Int(value), n > 0, n & (n - 1) == 0 else {
+                    throw ContainerizationError(
+                        .invalidArgument,
+                        message: "invalid chQueueSize value for virtio block device: \(value) (must be a power of two)"
+                    )
+                }
+                queueSize = n
+            case "chDirect":
+                guard let d = Bool(value) else {
+                    throw ContainerizationError(
+                        .invalidArgument,
+                        message: "invalid chDirect value for virtio block device: \(value)"
+                    )
+                }
+                direct = d
+            case "chImageType":
+                switch value {
+                case "raw":
+                    imageType = .raw
+                case "qcow2":
+                    imageType = .qcow2
+                default:
+                    throw ContainerizationError(
+                        .invalidArgument,
+                        message: "invalid chImageType value for virtio block device: \(value)"
+                    )
+                }
+            default:
+                if key.hasPrefix("vz") {
+                    continue
+                }
+                throw ContainerizationError(
+                    .invalidArgument,
+                    message: "unknown vmm option encountered: \(key)"
+                )
+            }
+        }
+
+        return CloudHypervisor.DiskConfig(
+            path: self.source,
+            readonly: self.options.contains("ro"),
+            direct: direct,
+            iommu: nil,
+            id: id,
+            pciSegment: nil,
+            imageType: imageType,
+            numQueues: numQueues,
+            queueSize: queueSize,
+            backingFiles: imageType == .qcow2 ? true : nil
+        )
+    }
+
+    /// Single-queue form of ``chDiskConfig(id:cpus:)`` that does not throw,
+    /// kept for callers written before runtime options were validated. If
+    /// the options don't parse, they are ignored and the raw, single-queue
+    /// device earlier releases produced is returned.
+    @available(*, deprecated, message: "Use chDiskConfig(id:cpus:), which validates ch* runtime options.")
     public func chDiskConfig(id: String) -> CloudHypervisor.DiskConfig? {
         guard case .virtioblk = self.runtimeOptions else {
             return nil
         }
+        if let config = try? chDiskConfig(id: id, cpus: 1) {
+            return config
+        }
         return CloudHypervisor.DiskConfig(
             path: self.source,
             readonly: self.options.contains("ro"),
@@ -51,20 +154,164 @@ extension Mount {
     /// not a virtiofs share.
     ///
     /// `tag` is the guest-side mount tag and `socketPath` is the UDS path the
-    /// virtiofsd subprocess publishes. Both are owned by the caller.
+    /// virtiofsd subprocess publishes. Both are owned by the caller. Queue
+    /// settings come from the mount's `chVirtiofsProfile()`; if its runtime
+    /// options don't parse they are left to cloud-hypervisor's defaults. Use
+    /// ``chTunedFsConfig(tag:socketPath:id:)`` to have them rejected instead.
     public func chFsConfig(tag: String, socketPath: String, id: String) -> CloudHypervisor.FsConfig? {
         guard case .virtiofs = self.runtimeOptions else {
             return nil
         }
+        if let config = try? chTunedFsConfig(tag: tag, socketPath: socketPath, id: id) {
+            return config
+        }
+        return CloudHypervisor.FsConfig(
+            tag: tag,
+            socket: socketPath,
+            id: id,
+            pciSegment: nil
+        )
+    }
+
+    /// Like ``chFsConfig(tag:socketPath:id:)``, but throws if the mount's
+    /// `ch*` runtime options are unknown or malformed.
+    public func chTunedFsConfig(tag: String, socketPath: String, id: String) throws -> CloudHypervisor.FsConfig? {
+        guard let profile = try self.chVirtiofsProfile() else {
+            return nil
+        }
         return CloudHypervisor.FsConfig(
             tag: tag,
             socket: socketPath,
-            numQueues: nil,
-            queueSize: nil,
+            numQueues: profile.numQueues,
+            queueSize: profile.queueSize,
             id: id,
             pciSegment: nil
         )
     }
+
+    /// Returns the virtiofsd tuning requested by this mount's runtime options,
+    /// or `nil` if the mount is not a virtiofs share.
+    ///
+    /// - `chCache=auto|always|never|metadata`: virtiofsd's `--cache` policy.
+    ///   `always` lets the guest keep file data and metadata cached
+    ///   indefinitely, which suits read-heavy trees that the host doesn't
+    ///   modify underneath the guest.
+    /// - `chWriteback=true|false`: enable the guest writeback cache.
+    /// - `chThreadPoolSize=<n>`: virtiofsd worker threads; `0` handles
+    ///   requests on the queue thread.
+    /// - `chNumQueues=<n>`: number of request queues.
+    /// - `chQueueSize=<n>`: depth of each queue; a power of two.
+    ///
+    /// Options for other VMMs (`vz*`) are ignored.
+    func chVirtiofsProfile() throws -> VirtiofsProfile? {
+        guard case .virtiofs(let runtimeOptions) = self.runtimeOptions else {
+            return nil
+        }
+
+        var profile = VirtiofsProfile()
+        for option in runtimeOptions {
+            let split = option.split(separator: "=")
+            if split.count != 2 {
+                continue
+            }
+
+            let key = String(split[0])
+            let value = String(split[1])
+
+            switch key {
+            case "chCache":
+                guard let cache = VirtiofsProfile.CacheMode(rawValue: value) else {
+                    throw ContainerizationError(
+                        .invalidArgument,
+                        message: "invalid chCache value for virtiofs share: \(value)"
+                    )
+                }
+                profile.cache = cache
+            case "chWriteback":
+                guard let writeback = Bool(value) else {
+                    throw ContainerizationError(
+                        .invalidArgument,
+                        message: "invalid chWriteback value for virtiofs share: \(value)"
+                    )
+                }
+                profile.writeback = writeback
+            case "chThreadPoolSize":
+                guard let n = Int(value), n >= 0 else {
+                    throw ContainerizationError(
+                        .invalidArgument,
+                        message: "invalid chThreadPoolSize value for virtiofs share: \(value)"
+                    )
+                }
+                profile.threadPoolSize = n
+            case "chNumQueues":
+                guard let n = Int(value), n > 0 else {
+                    throw ContainerizationError(
+                        .invalidArgument,
+                        message: "invalid chNumQueues value for virtiofs share: \(value)"
+                    )
+                }
+                profile.numQueues = n
+            case "chQueueSize":
+                guard let n = Int(value), n > 0, n & (n - 1) == 0 else {
+                    throw ContainerizationError(
+                        .invalidArgument,
+                        message: "invalid chQueueSize value for virtiofs share: \(value) (must be a power of two)"
+                    )
+                }
+                profile.queueSize = n
+            default:
+                if key.hasPrefix("vz") {
+                    continue
+                }
+                throw ContainerizationError(
+                    .invalidArgument,
+                    message: "unknown vmm option encountered: \(key)"
+                )
+            }
+        }
+        return profile
+    }
+}
+
+/// Tuning for a virtio-fs share, split between the `virtiofsd` that serves
+/// it and the cloud-hypervisor device that connects to it. All mounts that
+/// share a source directory share one virtiofsd, so they must agree on it.
+struct VirtiofsProfile: Sendable, Equatable {
+    /// virtiofsd `--cache` policies.
+    enum CacheMode: String, Sendable {
+        case auto
+        case always
+        case never
+        case metadata
+    }
+
+    /// Cache policy; virtiofsd's default (`auto`) when `nil`.
+    var cache: CacheMode?
+    /// Enable the guest writeback cache.
+    var writeback: Bool = false
+    /// Worker thread count; virtiofsd's default when `nil`.
+    var threadPoolSize: Int?
+    /// Number of request queues; cloud-hypervisor's default when `nil`.
+    var numQueues: Int?
+    /// Size of each request queue; cloud-hypervisor's default when `nil`.
+    var queueSize: Int?
+
+    /// Returns the single profile shared by `mounts`, throwing if any two of
+    /// them disagree.
+    static func shared(by mounts: [Mount]) throws -> VirtiofsProfile {
+        var result: VirtiofsProfile?
+        for mount in mounts {
+            let profile = try mount.chVirtiofsProfile() ?? VirtiofsProfile()
+            if let result, result != profile {
+                throw ContainerizationError(
+                    .invalidArgument,
+                    message: "virtiofs mounts of \(mount.source) request conflicting ch* options"
+                )
+            }
+            result = profile
+        }
+        return result ?? VirtiofsProfile()
+    }
 }
 
 /// Build the host-side UDS path for a virtiofsd ↔ cloud-hypervisor socket.
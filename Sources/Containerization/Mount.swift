@@ -361,6 +361,10 @@ extension VZDiskImageStorageDeviceAttachment {
                     )
                 }
             default:
+                // Options for other VMMs (e.g. cloud-hypervisor's `ch*`).
+                if key.hasPrefix("ch") {
+                    continue
+                }
                 throw ContainerizationError(
                     .invalidArgument,
                     message: "unknown vmm option encountered: \(key)"
@@ -419,6 +423,10 @@ extension VZNetworkBlockDeviceStorageDeviceAttachment {
                     )
                 }
             default:
+                // Options for other VMMs (e.g. cloud-hypervisor's `ch*`).
+                if key.hasPrefix("ch") {
+                    continue
+                }
                 throw ContainerizationError(
                     .invalidArgument,
                     message: "unknown vmm option encountered: \(key)"
@@ -0,0 +1,65 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+import Foundation
+
+/// A port on the host forwarded to a port on the container/guest's loopback
+/// address. Connections (TCP) or flows (UDP) accepted on the host are carried
+/// into the guest over vsock.
+public struct PortForwardConfiguration: Sendable {
+    /// The unique identifier for this forward.
+    public var id: String {
+        _id
+    }
+
+    private let _id = UUID().uuidString
+
+    /// The transport protocol to forward.
+    public var proto: TransportProtocol
+
+    /// The numeric IPv4 or IPv6 address on the host to listen on.
+    public var hostAddress: String
+
+    /// The port on the host to listen on.
+    public var hostPort: UInt16
+
+    /// The port on the guest's loopback address to forward to.
+    public var guestPort: UInt16
+
+    /// How long a UDP flow, identified by its client address, may go without
+    /// traffic before its guest channel is closed.
+    public var udpIdleTimeout: Duration
+
+    /// Transport protocols that can be forwarded.
+    public enum TransportProtocol: String, Sendable {
+        case tcp
+        case udp
+    }
+
+    public init(
+        proto: TransportProtocol = .tcp,
+        hostAddress: String = "127.0.0.1",
+        hostPort: UInt16,
+        guestPort: UInt16,
+        udpIdleTimeout: Duration = .seconds(60)
+    ) {
+        self.proto = proto
+        self.hostAddress = hostAddress
+        self.hostPort = hostPort
+        self.guestPort = guestPort
+        self.udpIdleTimeout = udpIdleTimeout
+    }
+}
@@ -0,0 +1,102 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+/// Traffic and latency counters for one port forward.
+public struct PortForwardStatistics: Sendable {
+    /// Counters for a single TCP connection or UDP flow.
+    public struct Flow: Sendable {
+        /// The client's address and port, or "closed" for the totals of
+        /// flows that have ended.
+        public var client: String
+        public var bytesToGuest: UInt64 = 0
+        public var bytesFromGuest: UInt64 = 0
+        /// Datagrams relayed. Always zero for TCP, whose segmentation is not
+        /// visible to the forwarder.
+        public var packetsToGuest: UInt64 = 0
+        public var packetsFromGuest: UInt64 = 0
+        /// Datagrams dropped because the guest channel was still opening or
+        /// could not keep up. Always zero for TCP.
+        public var packetsDropped: UInt64 = 0
+
+        public init(client: String) {
+            self.client = client
+        }
+
+        mutating func add(_ other: Flow) {
+            bytesToGuest += other.bytesToGuest
+            bytesFromGuest += other.bytesFromGuest
+            packetsToGuest += other.packetsToGuest
+            packetsFromGuest += other.packetsFromGuest
+            packetsDropped += other.packetsDropped
+        }
+    }
+
+    public var id: String
+    public var proto: PortForwardConfiguration.TransportProtocol
+    public var hostPort: UInt16
+    public var guestPort: UInt16
+    /// Flows that are currently open.
+    public var activeFlows: [Flow]
+    /// Number of flows that have ended.
+    public var closedFlows: UInt64
+    /// Counters summed over every flow that has ended.
+    public var closedTotals: Flow
+    /// Time from accepting a connection, or receiving a new client's first
+    /// datagram, to its guest channel being open.
+    public var acceptLatency: LatencyHistogram
+}
+
+/// A histogram of durations in power-of-two microsecond buckets.
+public struct LatencyHistogram: Sendable {
+    /// The upper bound, in microseconds, of each bucket but the last, which
+    /// holds everything slower: 16µs, 32µs, ... about 8.4s.
+    public static let bucketBounds: [UInt64] = (4..<24).map { 1 << $0 }
+
+    /// Samples per bucket; `counts[i]` pairs with `bucketBounds[i]`, and the
+    /// final element counts samples above the largest bound.
+    public private(set) var counts = [UInt64](repeating: 0, count: bucketBounds.count + 1)
+    public private(set) var count: UInt64 = 0
+    public private(set) var sum: Duration = .zero
+
+    public init() {}
+
+    public mutating func record(_ duration: Duration) {
+        let micros = UInt64(max(duration.components.seconds, 0)) * 1_000_000
+            + UInt64(max(duration.components.attoseconds, 0) / 1_000_000_000_000)
+        let bucket = Self.bucketBounds.firstIndex { micros <= $0 } ?? Self.bucketBounds.count
+        counts[bucket] += 1
+        count += 1
+        sum += duration
+    }
+
+    /// The upper bound of the bucket holding the `p`th percentile sample,
+    /// for `p` in 0...1, or nil if nothing was recorded or the sample is in
+    /// the open-ended bucket.
+    public func percentile(_ p: Double) -> Duration? {
+        guard count > 0 else {
+            return nil
+        }
+        let rank = max(UInt64((Double(count) * p).rounded(.up)), 1)
+        var seen: UInt64 = 0
+        for (i, n) in counts.enumerated() {
+            seen += n
+            if seen >= rank {
+                return i < Self.bucketBounds.count ? .microseconds(Self.bucketBounds[i]) : nil
+            }
+        }
+        return nil
+    }
+}
@@ -0,0 +1,506 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+import ContainerizationError
+import ContainerizationOS
+import Foundation
+import Logging
+import Synchronization
+
+#if canImport(Musl)
+import Musl
+private let _SOCK_DGRAM = SOCK_DGRAM
+#elseif canImport(Glibc)
+import Glibc
+private let _SOCK_DGRAM = Int32(SOCK_DGRAM.rawValue)
+#elseif canImport(Darwin)
+import Darwin
+private let _SOCK_DGRAM = SOCK_DGRAM
+#endif
+
+/// Forwards a host TCP or UDP port into the guest.
+///
+/// TCP connections are accepted on the host and each one is paired with a
+/// freshly dialed vsock connection through a `BidirectionalRelay`; in the
+/// guest, vminitd's vsock proxy connects it to the guest port.
+///
+/// UDP has no connections, so the forwarder keys flows by client address.
+/// Each flow gets its own vsock channel carrying length-prefixed datagrams
+/// (see `DatagramFraming`), and is closed after `udpIdleTimeout` without
+/// traffic. UDP I/O runs on one serial queue per forward.
+package final class PortForwarder: Sendable {
+    private let port: UInt32
+    private let configuration: PortForwardConfiguration
+    private let vm: any VirtualMachineInstance
+    private let log: Logger?
+    private let state: Mutex<State>
+    private let queue: DispatchQueue
+
+    // Queue-owned UDP state; see `UDPFlow`.
+    private nonisolated(unsafe) let udp = UDPState()
+
+    private struct State {
+        var listener: Socket?
+        var acceptTask: Task<(), Never>?
+        var tcpFlows: [UInt64: TCPFlow] = [:]
+        var nextFlowID: UInt64 = 0
+        var closedFlows: UInt64 = 0
+        var closedTotals = PortForwardStatistics.Flow(client: "closed")
+        var acceptLatency = LatencyHistogram()
+        var stopped = false
+    }
+
+    private struct TCPFlow {
+        let client: String
+        let relay: BidirectionalRelay
+    }
+
+    /// One UDP client. All fields are owned by the forwarder's queue.
+    private final class UDPFlow: @unchecked Sendable {
+        let client: InetType
+        let opened = ContinuousClock.now
+        var fd: Int32 = -1
+        /// Datagrams received while the guest channel is still being dialed.
+        var waiting: [[UInt8]] = []
+        var encoder = DatagramFraming.Encoder()
+        var decoder = DatagramFraming.Decoder()
+        var readSource: DispatchSourceRead?
+        var writeSource: DispatchSourceWrite?
+        /// Dispatch sources on `fd` whose cancel handler has not run yet. The
+        /// fd is closed only once this drops to zero after the flow closes.
+        var openSources = 0
+        var lastActive = ContinuousClock.now
+        var stats: PortForwardStatistics.Flow
+        var closed = false
+
+        init(client: InetType) {
+            self.client = client
+            self.stats = .init(client: client.description)
+        }
+    }
+
+    /// The host UDP socket and its flows. Owned by the forwarder's queue.
+    private final class UDPState {
+        var fd: Int32 = -1
+        var source: DispatchSourceRead?
+        var timer: DispatchSourceTimer?
+        var flows: [String: UDPFlow] = [:]
+        var buffer = [UInt8](repeating: 0, count: DatagramFraming.maxDatagramSize)
+    }
+
+    /// Datagrams held per UDP flow while its guest channel is being dialed.
+    private static let maxWaitingDatagrams = 64
+
+    init(
+        port: UInt32,
+        configuration: PortForwardConfiguration,
+        vm: any VirtualMachineInstance,
+        log: Logger? = nil
+    ) {
+        self.port = port
+        self.configuration = configuration
+        self.vm = vm
+        self.log = log
+        self.state = Mutex(State())
+        self.queue = DispatchQueue(label: "com.apple.containerization.port-forward.\(configuration.hostPort)")
+    }
+}
+
+extension PortForwarder {
+    func start() throws {
+        switch configuration.proto {
+        case .tcp:
+            try startTCP()
+        case .udp:
+            try queue.sync { try startUDP() }
+        }
+        log?.info(
+            "forwarding host port",
+            metadata: [
+                "proto": "\(configuration.proto)",
+                "host": "\(configuration.hostAddress):\(configuration.hostPort)",
+                "guestPort": "\(configuration.guestPort)",
+                "vport": "\(port)",
+            ])
+    }
+
+    func stop() throws {
+        let (listener, relays) = state.withLock { state -> (Socket?, [BidirectionalRelay]) in
+            state.stopped = true
+            state.acceptTask?.cancel()
+            state.acceptTask = nil
+            defer { state.listener = nil }
+            return (state.listener, state.tcpFlows.values.map(\.relay))
+        }
+        for relay in relays {
+            relay.stop()
+        }
+        try listener?.close()
+        queue.sync {
+            udp.timer?.cancel()
+            udp.timer = nil
+            udp.source?.cancel()
+            udp.source = nil
+            for flow in Array(udp.flows.values) {
+                closeFlow(flow)
+            }
+        }
+    }
+
+    func statistics() -> PortForwardStatistics {
+        let udpFlows = queue.sync { udp.flows.values.map(\.stats) }
+        return state.withLock { state in
+            let tcpFlows = state.tcpFlows.values.map { flow -> PortForwardStatistics.Flow in
+                let (toGuest, fromGuest) = flow.relay.bytesTransferred
+                var stats = PortForwardStatistics.Flow(client: flow.client)
+                stats.bytesToGuest = toGuest
+                stats.bytesFromGuest = fromGuest
+                return stats
+            }
+            return PortForwardStatistics(
+                id: configuration.id,
+                proto: configuration.proto,
+                hostPort: configuration.hostPort,
+                guestPort: configuration.guestPort,
+                activeFlows: tcpFlows + udpFlows,
+                closedFlows: state.closedFlows,
+                closedTotals: state.closedTotals,
+                acceptLatency: state.acceptLatency
+            )
+        }
+    }
+}
+
+// MARK: - TCP
+
+extension PortForwarder {
+    private func startTCP() throws {
+        let type = try InetType(address: configuration.hostAddress, port: configuration.hostPort)
+        let listener = try Socket(type: type, closeOnDeinit: false)
+        try listener.listen()
+        let connections = try listener.acceptStream(closeOnDeinit: false)
+
+        state.withLock {
+            $0.listener = listener
+            $0.acceptTask = Task {
+                do {
+                    for try await connection in connections {
+                        let accepted = ContinuousClock.now
+                        // Don't hold up the accept loop on the guest dial.
+                        Task { await self.forwardTCP(connection, accepted: accepted) }
+                    }
+                } catch {
+                    self.log?.error("failed in port forward accept loop: \(error)")
+                }
+            }
+        }
+    }
+
+    private func forwardTCP(_ connection: Socket, accepted: ContinuousClock.Instant) async {
+        let clientFd = connection.fileDescriptor
+        var one: Int32 = 1
+        _ = setsockopt(clientFd, Int32(IPPROTO_TCP), TCP_NODELAY, &one, socklen_t(MemoryLayout<Int32>.size))
+        let client = Self.peerName(clientFd)
+
+        let guestConn: FileHandle
+        do {
+            guestConn = try await vm.dial(port)
+        } catch {
+            log?.error("failed to dial guest for port forward", metadata: ["client": "\(client)", "error": "\(error)"])
+            try? connection.close()
+            return
+        }
+
+        let relay = BidirectionalRelay(fd1: clientFd, fd2: guestConn.fileDescriptor, log: log)
+        let flowID = state.withLock { state -> UInt64? in
+            guard !state.stopped else {
+                return nil
+            }
+            state.acceptLatency.record(.now - accepted)
+            let id = state.nextFlowID
+            state.nextFlowID += 1
+            state.tcpFlows[id] = TCPFlow(client: client, relay: relay)
+            return id
+        }
+        guard let flowID else {
+            try? connection.close()
+            try? guestConn.close()
+            return
+        }
+
+        do {
+            try relay.start()
+        } catch {
+            log?.error("failed to start port forward relay", metadata: ["client": "\(client)", "error": "\(error)"])
+            state.withLock { _ = $0.tcpFlows.removeValue(forKey: flowID) }
+            try? connection.close()
+            try? guestConn.close()
+            return
+        }
+
+        await relay.waitForCompletion()
+        let (toGuest, fromGuest) = relay.bytesTransferred
+        state.withLock { state in
+            state.tcpFlows[flowID] = nil
+            state.closedFlows += 1
+            state.closedTotals.bytesToGuest += toGuest
+            state.closedTotals.bytesFromGuest += fromGuest
+        }
+    }
+
+    private static func peerName(_ fd: Int32) -> String {
+        var addr = sockaddr_storage()
+        var len = socklen_t(MemoryLayout<sockaddr_storage>.size)
+        let rc = withUnsafeMutablePointer(to: &addr) {
+            $0.withMemoryRebound(to: sockaddr.self, capacity: 1) { getpeername(fd, $0, &len) }
+        }
+        guard rc == 0, let peer = InetType(sockaddr: addr) else {
+            return "unknown"
+        }
+        return peer.description
+    }
+}
+
+// MARK: - UDP
+
+extension PortForwarder {
+    private func startUDP() throws {
+        let address = try InetType(address: configuration.hostAddress, port: configuration.hostPort)
+        let fd = socket(address.domain, _SOCK_DGRAM, 0)
+        guard fd >= 0 else {
+            throw ContainerizationError(.internalError, message: "failed to create UDP socket: errno \(errno)")
+        }
+        do {
+            try address.beforeBind(fd: fd)
+            var rc: Int32 = 0
+            try address.withSockAddr { ptr, len in
+                rc = bind(fd, ptr, socklen_t(len))
+            }
+            guard rc == 0 else {
+                throw ContainerizationError(.internalError, message: "failed to bind UDP \(address): errno \(errno)")
+            }
+            try Self.prepare(fd)
+        } catch {
+            close(fd)
+            throw error
+        }
+
+        let source = DispatchSource.makeReadSource(fileDescriptor: fd, queue: queue)
+        source.setEventHandler { [self] in receiveFromClients() }
+        source.setCancelHandler { close(fd) }
+        udp.fd = fd
+        udp.source = source
+
+        let interval = max(configuration.udpIdleTimeout / 2, .milliseconds(100))
+        let nanos = Int(interval.components.seconds) * 1_000_000_000 + Int(interval.components.attoseconds / 1_000_000_000)
+        let timer = DispatchSource.makeTimerSource(queue: queue)
+        timer.schedule(deadline: .now() + .nanoseconds(nanos), repeating: .nanoseconds(nanos))
+        timer.setEventHandler { [self] in closeIdleFlows() }
+        udp.timer = timer
+
+        source.activate()
+        timer.activate()
+    }
+
+    private static func prepare(_ fd: Int32) throws {
+        let flags = fcntl(fd, F_GETFL)
+        guard flags != -1, fcntl(fd, F_SETFL, flags | O_NONBLOCK) != -1 else {
+            throw ContainerizationError(.internalError, message: "failed to make fd \(fd) non-blocking: errno \(errno)")
+        }
+        _ = fcntl(fd, F_SETFD, FD_CLOEXEC)
+    }
+
+    /// Drains the host UDP socket, routing each datagram to its client's flow.
+    private func receiveFromClients() {
+        while true {
+            var addr = sockaddr_storage()
+            var len = socklen_t(MemoryLayout<sockaddr_storage>.size)
+            let n = udp.buffer.withUnsafeMutableBytes { buf in
+                withUnsafeMutablePointer(to: &addr) {
+                    $0.withMemoryRebound(to: sockaddr.self, capacity: 1) {
+                        recvfrom(udp.fd, buf.baseAddress, buf.count, 0, $0, &len)
+                    }
+                }
+            }
+            if n < 0 {
+                if errno == EINTR { continue }
+                // EAGAIN, or a transient error such as ICMP feedback; wait for the next event.
+                return
+            }
+            guard let client = InetType(sockaddr: addr) else {
+                continue
+            }
+
+            let key = client.description
+            let flow = udp.flows[key] ?? openFlow(client)
+            flow.lastActive = .now
+            if flow.fd < 0 {
+                guard flow.waiting.count < Self.maxWaitingDatagrams else {
+                    flow.stats.packetsDropped += 1
+                    continue
+                }
+                flow.waiting.append(Array(udp.buffer[0..<n]))
+            } else {
+                let queued = udp.buffer.withUnsafeBytes {
+                    flow.encoder.enqueue(UnsafeRawBufferPointer(rebasing: $0[0..<n]))
+                }
+                guard queued else {
+                    flow.stats.packetsDropped += 1
+                    continue
+                }
+                flushToGuest(flow)
+            }
+            flow.stats.packetsToGuest += 1
+            flow.stats.bytesToGuest += UInt64(n)
+        }
+    }
+
+    private func openFlow(_ client: InetType) -> UDPFlow {
+        let flow = UDPFlow(client: client)
+        udp.flows[client.description] = flow
+        Task {
+            do {
+                let conn = try await vm.dial(port)
+                queue.async { [self] in attach(flow, fd: conn.fileDescriptor) }
+            } catch {
+                log?.error("failed to dial guest for UDP flow", metadata: ["client": "\(client)", "error": "\(error)"])
+                queue.async { [self] in closeFlow(flow) }
+            }
+        }
+        return flow
+    }
+
+    private func attach(_ flow: UDPFlow, fd: Int32) {
+        guard !flow.closed else {
+            close(fd)
+            return
+        }
+        do {
+            try Self.prepare(fd)
+        } catch {
+            close(fd)
+            closeFlow(flow)
+            return
+        }
+        flow.fd = fd
+        state.withLock { $0.acceptLatency.record(.now - flow.opened) }
+
+        for datagram in flow.waiting {
+            let queued = datagram.withUnsafeBytes { flow.encoder.enqueue($0) }
+            if !queued {
+                flow.stats.packetsDropped += 1
+            }
+        }
+        flow.waiting = []
+
+        let source = DispatchSource.makeReadSource(fileDescriptor: fd, queue: queue)
+        source.setEventHandler { [self] in receiveFromGuest(flow) }
+        source.setCancelHandler { Self.sourceCancelled(flow) }
+        flow.openSources += 1
+        flow.readSource = source
+        source.activate()
+        flushToGuest(flow)
+    }
+
+    private func flushToGuest(_ flow: UDPFlow) {
+        guard flow.encoder.flush(to: flow.fd) else {
+            log?.debug("UDP flow write failed", metadata: ["client": "\(flow.client)", "errno": "\(errno)"])
+            closeFlow(flow)
+            return
+        }
+        if flow.encoder.pending == 0 {
+            flow.writeSource?.cancel()
+            flow.writeSource = nil
+        } else if flow.writeSource == nil {
+            let source = DispatchSource.makeWriteSource(fileDescriptor: flow.fd, queue: queue)
+            source.setEventHandler { [self] in flushToGuest(flow) }
+            source.setCancelHandler { Self.sourceCancelled(flow) }
+            flow.openSources += 1
+            flow.writeSource = source
+            source.activate()
+        }
+    }
+
+    /// Reads framed replies from the guest and sends each to the client.
+    private func receiveFromGuest(_ flow: UDPFlow) {
+        while !flow.closed {
+            let n = udp.buffer.withUnsafeMutableBytes { read(flow.fd, $0.baseAddress, $0.count) }
+            if n < 0 && errno == EINTR {
+                continue
+            }
+            if n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK) {
+                return
+            }
+            guard n > 0 else {
+                closeFlow(flow)
+                return
+            }
+            udp.buffer.withUnsafeBytes { flow.decoder.append(UnsafeRawBufferPointer(rebasing: $0[0..<n])) }
+            while let datagram = flow.decoder.next() {
+                let sent = datagram.withUnsafeBytes { payload in
+                    var sent = -1
+                    try? flow.client.withSockAddr { addr, len in
+                        sent = sendto(udp.fd, payload.baseAddress, payload.count, 0, addr, socklen_t(len))
+                    }
+                    return sent
+                }
+                // Like any UDP hop, drop what the host socket won't take.
+                if sent < 0 {
+                    flow.stats.packetsDropped += 1
+                    continue
+                }
+                flow.stats.packetsFromGuest += 1
+                flow.stats.bytesFromGuest += UInt64(datagram.count)
+            }
+            flow.lastActive = .now
+        }
+    }
+
+    private func closeIdleFlows() {
+        let now = ContinuousClock.now
+        for flow in Array(udp.flows.values) where now - flow.lastActive > configuration.udpIdleTimeout {
+            closeFlow(flow)
+        }
+    }
+
+    private func closeFlow(_ flow: UDPFlow) {
+        guard !flow.closed else {
+            return
+        }
+        flow.closed = true
+        udp.flows[flow.client.description] = nil
+        flow.writeSource?.cancel()
+        flow.writeSource = nil
+        flow.readSource?.cancel()
+        flow.readSource = nil
+        if flow.openSources == 0 && flow.fd >= 0 {
+            close(flow.fd)
+        }
+        let stats = flow.stats
+        state.withLock {
+            $0.closedFlows += 1
+            $0.closedTotals.add(stats)
+        }
+    }
+
+    /// Closes a closed flow's fd after Dispatch has let go of it.
+    private static func sourceCancelled(_ flow: UDPFlow) {
+        flow.openSources -= 1
+        if flow.closed && flow.openSources == 0 {
+            close(flow.fd)
+        }
+    }
+}
@@ -0,0 +1,232 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+import ContainerizationError
+import Foundation
+
+/// Minimal writer for qcow2 (version 3) copy-on-write overlays.
+///
+/// An overlay is a thin qcow2 file whose unallocated clusters read through to
+/// a raw backing file. Creating one writes only metadata — a header, one
+/// refcount table/block and an all-zero L1 table — so its cost is independent
+/// of the size of the backing image. Cloud Hypervisor allocates data clusters
+/// in the overlay on first write, leaving the backing file untouched; that
+/// lets any number of containers share a single read-only base image.
+///
+/// The layout written is:
+///
+///     cluster 0       header, header extensions, backing file name
+///     cluster 1       refcount table
+///     cluster 2       refcount block 0
+///     cluster 3...    L1 table
+public enum QCOW2 {
+    /// `QFI\xfb`.
+    static let magic: UInt32 = 0x5146_49fb
+    static let version: UInt32 = 3
+    /// 64 KiB clusters; the qemu-img default.
+    static let clusterBits: UInt32 = 16
+    static let clusterSize = 1 << Int(clusterBits)
+    /// 16-bit refcounts; the only width every qcow2 consumer supports.
+    static let refcountOrder: UInt32 = 4
+    /// Length of the version 3 header, excluding extensions.
+    static let headerLength: UInt32 = 104
+
+    static let backingFormatExtension: UInt32 = 0xe279_2aca
+    static let endOfExtensions: UInt32 = 0
+
+    static let refcountTableCluster = 1
+    static let refcountBlockCluster = 2
+    static let l1TableCluster = 3
+
+    /// Returns the number of L1 entries needed to map `virtualSize` bytes.
+    /// Each L1 entry points at an L2 table, which maps `clusterSize / 8`
+    /// clusters.
+    static func l1Size(virtualSize: UInt64) -> Int {
+        let bytesPerL2 = UInt64(clusterSize / 8) * UInt64(clusterSize)
+        return Int((virtualSize + bytesPerL2 - 1) / bytesPerL2)
+    }
+
+    /// Creates a qcow2 overlay at `path` backed by the raw image at
+    /// `backingFile`.
+    ///
+    /// - Parameters:
+    ///   - path: Where to write the overlay. The file must not exist.
+    ///   - backingFile: Absolute path of the raw backing image. It is recorded
+    ///     verbatim in the overlay and must stay in place (and unmodified)
+    ///     for the overlay's lifetime.
+    ///   - virtualSize: Size of the virtual disk in bytes. Defaults to the
+    ///     size of `backingFile`.
+    public static func createOverlay(
+        at path: URL,
+        backingFile: String,
+        virtualSize: UInt64? = nil
+    ) throws {
+        guard backingFile.hasPrefix("/") else {
+            throw ContainerizationError(
+                .invalidArgument,
+                message: "qcow2 backing file must be an absolute path: \(backingFile)"
+            )
+        }
+        let size: UInt64
+        if let virtualSize {
+            size = virtualSize
+        } else {
+            let attrs = try FileManager.default.attributesOfItem(atPath: backingFile)
+            guard let backingSize = attrs[.size] as? UInt64 else {
+                throw ContainerizationError(
+                    .internalError,
+                    message: "failed to determine size of qcow2 backing file \(backingFile)"
+                )
+            }
+            size = backingSize
+        }
+        guard size > 0, size % 512 == 0 else {
+            throw ContainerizationError(
+                .invalidArgument,
+                message: "qcow2 virtual size must be a non-zero multiple of 512 bytes: \(size)"
+            )
+        }
+
+        guard !FileManager.default.fileExists(atPath: path.path) else {
+            throw ContainerizationError(.exists, message: "qcow2 overlay already exists at \(path.path)")
+        }
+        let data = try overlayImage(backingFile: backingFile, virtualSize: size)
+        try data.write(to: path, options: .withoutOverwriting)
+    }
+
+    /// Builds the overlay's metadata clusters in memory.
+    static func overlayImage(backingFile: String, virtualSize: UInt64) throws -> Data {
+        let l1Size = l1Size(virtualSize: virtualSize)
+        let l1Clusters = max(1, (l1Size * 8 + clusterSize - 1) / clusterSize)
+        let totalClusters = l1TableCluster + l1Clusters
+        // One refcount block holds clusterSize / 2 entries (16-bit refcounts),
+        // which covers 2 GiB of metadata; far more than any L1 table needs.
+        precondition(totalClusters <= clusterSize / 2)
+
+        // Cluster 0: header, extensions, then the backing file name.
+        var header = Data()
+        header.appendBE(magic)
+        header.appendBE(version)
+        let backingOffsetIndex = header.count
+        header.appendBE(UInt64(0))  // backing_file_offset, patched below
+        let backingName = Data(backingFile.utf8)
+        header.appendBE(UInt32(backingName.count))
+        header.appendBE(clusterBits)
+        header.appendBE(virtualSize)
+        header.appendBE(UInt32(0))  // crypt_method
+        header.appendBE(UInt32(l1Size))
+        header.appendBE(UInt64(l1TableCluster * clusterSize))
+        header.appendBE(UInt64(refcountTableCluster * clusterSize))
+        header.appendBE(UInt32(1))  // refcount_table_clusters
+        header.appendBE(UInt32(0))  // nb_snapshots
+        header.appendBE(UInt64(0))  // snapshots_offset
+        header.appendBE(UInt64(0))  // incompatible_features
+        header.appendBE(UInt64(0))  // compatible_features
+        header.appendBE(UInt64(0))  // autoclear_features
+        header.appendBE(refcountOrder)
+        header.appendBE(headerLength)
+        precondition(header.count == Int(headerLength))
+
+        // The backing format extension pins the base to raw so consumers
+        // never probe (and misinterpret) the ext4 image's contents.
+        let format = Data("raw".utf8)
+        header.appendBE(backingFormatExtension)
+        header.appendBE(UInt32(format.count))
+        header.append(format)
+        header.append(Data(count: (8 - format.count % 8) % 8))
+        header.appendBE(endOfExtensions)
+        header.appendBE(UInt32(0))
+
+        let backingOffset = header.count
+        header.append(backingName)
+        guard header.count <= clusterSize else {
+            throw ContainerizationError(
+                .invalidArgument,
+                message: "qcow2 backing file path is too long: \(backingFile)"
+            )
+        }
+        header.replaceSubrange(
+            backingOffsetIndex..<backingOffsetIndex + 8,
+            with: Data(bigEndian: UInt64(backingOffset))
+        )
+
+        var image = Data(count: totalClusters * clusterSize)
+        image.replaceSubrange(0..<header.count, with: header)
+
+        // Refcount table: a single entry pointing at refcount block 0.
+        let tableOffset = refcountTableCluster * clusterSize
+        image.replaceSubrange(
+            tableOffset..<tableOffset + 8,
+            with: Data(bigEndian: UInt64(refcountBlockCluster * clusterSize))
+        )
+
+        // Refcount block 0: every metadata cluster is referenced once.
+        let blockOffset = refcountBlockCluster * clusterSize
+        for cluster in 0..<totalClusters {
+            let at = blockOffset + cluster * 2
+            image.replaceSubrange(at..<at + 2, with: Data(bigEndian: UInt16(1)))
+        }
+
+        // The L1 table stays zero: no L2 tables, so every read falls through
+        // to the backing file.
+        return image
+    }
+}
+
+extension Mount {
+    /// Creates a qcow2 overlay at `to` backed by this mount's source and
+    /// returns a mount that attaches the overlay in its place.
+    ///
+    /// This is the copy-on-write counterpart to `clone(to:)`: it is O(1) in
+    /// the size of the image and leaves the source untouched, so one base
+    /// image can back any number of containers. The source must be a raw
+    /// block image and must not be modified while overlays reference it.
+    ///
+    /// The returned mount carries `chImageType=qcow2`, so it can only be
+    /// attached by the Cloud Hypervisor backend.
+    public func qcow2Overlay(to: String) throws -> Self {
+        guard case .virtioblk(var runtimeOptions) = self.runtimeOptions else {
+            throw ContainerizationError(
+                .invalidArgument,
+                message: "qcow2 overlays are only supported for block mounts"
+            )
+        }
+        try QCOW2.createOverlay(
+            at: URL(fileURLWithPath: to),
+            backingFile: URL(fileURLWithPath: self.source).standardizedFileURL.path
+        )
+        runtimeOptions.removeAll { $0.hasPrefix("chImageType=") }
+        runtimeOptions.append("chImageType=qcow2")
+        return .init(
+            type: self.type,
+            source: to,
+            destination: self.destination,
+            options: self.options,
+            runtimeOptions: .virtioblk(runtimeOptions)
+        )
+    }
+}
+
+extension Data {
+    fileprivate init<T: FixedWidthInteger>(bigEndian value: T) {
+        self.init()
+        self.appendBE(value)
+    }
+
+    fileprivate mutating func appendBE<T: FixedWidthInteger>(_ value: T) {
+        Swift.withUnsafeBytes(of: value.bigEndian) { self.append(contentsOf: $0) }
+    }
+}
@@ -0,0 +1,102 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+import ContainerizationError
+import ContainerizationOCI
+import Foundation
+
+/// Produces per-container root filesystems as thin qcow2 overlays on top of
+/// a shared, read-only ext4 base image.
+///
+/// Each image platform manifest is unpacked once into
+/// `<root>/<digest>-<capacity>.ext4`; every container then gets its own
+/// qcow2 overlay (see `Mount.qcow2Overlay(to:)`) whose writes land in the
+/// overlay and never touch the base. Creating a container's rootfs is
+/// therefore O(1) after the first unpack, and identical images share their
+/// storage automatically.
+///
+/// Overlays are attached as qcow2 disks, which only the Cloud Hypervisor
+/// backend supports. Bases must outlive every overlay that references them;
+/// removing them is left to the caller.
+public struct RootfsOverlayStore: Sendable {
+    /// Directory holding the base images.
+    public let root: URL
+    /// Capacity of each base image, and thus the virtual size of its overlays.
+    public let capacityInBytes: UInt64
+
+    public init(root: URL, capacityInBytes: UInt64) throws {
+        self.root = root
+        self.capacityInBytes = capacityInBytes
+        try FileManager.default.createDirectory(at: root, withIntermediateDirectories: true)
+    }
+
+    /// Returns the shared base image for `image` on `platform`, unpacking it
+    /// if this is the first request for it.
+    ///
+    /// Concurrent callers may each unpack the image; the first to finish
+    /// publishes its copy and the rest discard theirs.
+    public func base(for image: Image, platform: Platform) async throws -> Mount {
+        let descriptor = try await image.descriptor(for: platform)
+        let basePath = self.basePath(digest: descriptor.digest)
+        if !FileManager.default.fileExists(atPath: basePath.path) {
+            let tmpPath = root.appendingPathComponent(".\(basePath.lastPathComponent).\(UUID().uuidString)")
+            defer { try? FileManager.default.removeItem(at: tmpPath) }
+
+            let unpacker = EXT4Unpacker(capacityInBytes: capacityInBytes)
+            _ = try await unpacker.unpack(image, for: platform, at: tmpPath)
+            try FileManager.default.setAttributes([.posixPermissions: 0o444], ofItemAtPath: tmpPath.path)
+            do {
+                try FileManager.default.moveItem(at: tmpPath, to: basePath)
+            } catch {
+                // Lost the race to another unpack of the same image.
+                guard FileManager.default.fileExists(atPath: basePath.path) else {
+                    throw error
+                }
+            }
+        }
+        return .block(
+            format: "ext4",
+            source: basePath.path,
+            destination: "/",
+            options: ["ro"]
+        )
+    }
+
+    /// Creates a qcow2 overlay for `image` on `platform` at `path` and
+    /// returns a writable root filesystem mount for it.
+    ///
+    /// If an overlay already exists at `path` it is reused as-is, preserving
+    /// whatever the container previously wrote.
+    public func overlay(for image: Image, platform: Platform, at path: URL) async throws -> Mount {
+        if FileManager.default.fileExists(atPath: path.path) {
+            return .block(
+                format: "ext4",
+                source: path.path,
+                destination: "/",
+                options: [],
+                runtimeOptions: ["chImageType=qcow2"]
+            )
+        }
+        var base = try await self.base(for: image, platform: platform)
+        base.options = []
+        return try base.qcow2Overlay(to: path.path)
+    }
+
+    func basePath(digest: String) -> URL {
+        let name = digest.replacingOccurrences(of: ":", with: "-")
+        return root.appendingPathComponent("\(name)-\(capacityInBytes).ext4")
+    }
+}
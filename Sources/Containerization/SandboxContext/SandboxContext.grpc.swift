@@ -49,6 +49,19 @@ public enum Com_Apple_Containerization_Sandbox_V3_SandboxContext: Sendable {
                 type: .unary
             )
         }
+        /// Namespace for "MountBatch" metadata.
+        public enum MountBatch: Sendable {
+            /// Request type for "MountBatch".
+            public typealias Input = Com_Apple_Containerization_Sandbox_V3_MountBatchRequest
+            /// Response type for "MountBatch".
+            public typealias Output = Com_Apple_Containerization_Sandbox_V3_MountBatchResponse
+            /// Descriptor for "MountBatch".
+            public static let descriptor = GRPCCore.MethodDescriptor(
+                service: GRPCCore.ServiceDescriptor(fullyQualifiedService: "com.apple.containerization.sandbox.v3.SandboxContext"),
+                method: "MountBatch",
+                type: .unary
+            )
+        }
         /// Namespace for "Umount" metadata.
         public enum Umount: Sendable {
             /// Request type for "Umount".
@@ -400,6 +413,32 @@ public enum Com_Apple_Containerization_Sandbox_V3_SandboxContext: Sendable {
                 type: .unary
             )
         }
+        /// Namespace for "BootTrace" metadata.
+        public enum BootTrace: Sendable {
+            /// Request type for "BootTrace".
+            public typealias Input = Com_Apple_Containerization_Sandbox_V3_BootTraceRequest
+            /// Response type for "BootTrace".
+            public typealias Output = Com_Apple_Containerization_Sandbox_V3_BootTraceResponse
+            /// Descriptor for "BootTrace".
+            public static let descriptor = GRPCCore.MethodDescriptor(
+                service: GRPCCore.ServiceDescriptor(fullyQualifiedService: "com.apple.containerization.sandbox.v3.SandboxContext"),
+                method: "BootTrace",
+                type: .unary
+            )
+        }
+        /// Namespace for "Reseed" metadata.
+        public enum Reseed: Sendable {
+            /// Request type for "Reseed".
+            public typealias Input = Com_Apple_Containerization_Sandbox_V3_ReseedRequest
+            /// Response type for "Reseed".
+            public typealias Output = Com_Apple_Containerization_Sandbox_V3_ReseedResponse
+            /// Descriptor for "Reseed".
+            public static let descriptor = GRPCCore.MethodDescriptor(
+                service: GRPCCore.ServiceDescriptor(fullyQualifiedService: "com.apple.containerization.sandbox.v3.SandboxContext"),
+                method: "Reseed",
+                type: .unary
+            )
+        }
         /// Namespace for "Sync" metadata.
         public enum Sync: Sendable {
             /// Request type for "Sync".
@@ -429,6 +468,7 @@ public enum Com_Apple_Containerization_Sandbox_V3_SandboxContext: Sendable {
         /// Descriptors for all methods in the "com.apple.containerization.sandbox.v3.SandboxContext" service.
         public static let descriptors: [GRPCCore.MethodDescriptor] = [
             Mount.descriptor,
+            MountBatch.descriptor,
             Umount.descriptor,
             Setenv.descriptor,
             Getenv.descriptor,
@@ -456,6 +496,8 @@ public enum Com_Apple_Containerization_Sandbox_V3_SandboxContext: Sendable {
             IpRouteAddDefault.descriptor,
             ConfigureDns.descriptor,
             ConfigureHosts.descriptor,
+            BootTrace.descriptor,
+            Reseed.descriptor,
             Sync.descriptor,
             Kill.descriptor
         ]
@@ -505,6 +547,25 @@ extension Com_Apple_Containerization_Sandbox_V3_SandboxContext {
             context: GRPCCore.ServerContext
         ) async throws -> GRPCCore.StreamingServerResponse<Com_Apple_Containerization_Sandbox_V3_MountResponse>
 
+        /// Handle the "MountBatch" method.
+        ///
+        /// > Source IDL Documentation:
+        /// >
+        /// > Mount several filesystems at once. Hot-plugged block devices are awaited
+        /// > together, then all mounts are performed concurrently.
+        ///
+        /// - Parameters:
+        ///   - request: A streaming request of `Com_Apple_Containerization_Sandbox_V3_MountBatchRequest` messages.
+        ///   - context: Context providing information about the RPC.
+        /// - Throws: Any error which occurred during the processing of the request. Thrown errors
+        ///     of type `RPCError` are mapped to appropriate statuses. All other errors are converted
+        ///     to an internal error.
+        /// - Returns: A streaming response of `Com_Apple_Containerization_Sandbox_V3_MountBatchResponse` messages.
+        func mountBatch(
+            request: GRPCCore.StreamingServerRequest<Com_Apple_Containerization_Sandbox_V3_MountBatchRequest>,
+            context: GRPCCore.ServerContext
+        ) async throws -> GRPCCore.StreamingServerResponse<Com_Apple_Containerization_Sandbox_V3_MountBatchResponse>
+
         /// Handle the "Umount" method.
         ///
         /// > Source IDL Documentation:
@@ -994,6 +1055,42 @@ extension Com_Apple_Containerization_Sandbox_V3_SandboxContext {
             context: GRPCCore.ServerContext
         ) async throws -> GRPCCore.StreamingServerResponse<Com_Apple_Containerization_Sandbox_V3_ConfigureHostsResponse>
 
+        /// Handle the "BootTrace" method.
+        ///
+        /// > Source IDL Documentation:
+        /// >
+        /// > Return the guest-side boot trace recorded by the agent.
+        ///
+        /// - Parameters:
+        ///   - request: A streaming request of `Com_Apple_Containerization_Sandbox_V3_BootTraceRequest` messages.
+        ///   - context: Context providing information about the RPC.
+        /// - Throws: Any error which occurred during the processing of the request. Thrown errors
+        ///     of type `RPCError` are mapped to appropriate statuses. All other errors are converted
+        ///     to an internal error.
+        /// - Returns: A streaming response of `Com_Apple_Containerization_Sandbox_V3_BootTraceResponse` messages.
+        func bootTrace(
+            request: GRPCCore.StreamingServerRequest<Com_Apple_Containerization_Sandbox_V3_BootTraceRequest>,
+            context: GRPCCore.ServerContext
+        ) async throws -> GRPCCore.StreamingServerResponse<Com_Apple_Containerization_Sandbox_V3_BootTraceResponse>
+
+        /// Handle the "Reseed" method.
+        ///
+        /// > Source IDL Documentation:
+        /// >
+        /// > Mix host entropy into the guest RNG and force a reseed.
+        ///
+        /// - Parameters:
+        ///   - request: A streaming request of `Com_Apple_Containerization_Sandbox_V3_ReseedRequest` messages.
+        ///   - context: Context providing information about the RPC.
+        /// - Throws: Any error which occurred during the processing of the request. Thrown errors
+        ///     of type `RPCError` are mapped to appropriate statuses. All other errors are converted
+        ///     to an internal error.
+        /// - Returns: A streaming response of `Com_Apple_Containerization_Sandbox_V3_ReseedResponse` messages.
+        func reseed(
+            request: GRPCCore.StreamingServerRequest<Com_Apple_Containerization_Sandbox_V3_ReseedRequest>,
+            context: GRPCCore.ServerContext
+        ) async throws -> GRPCCore.StreamingServerResponse<Com_Apple_Containerization_Sandbox_V3_ReseedResponse>
+
         /// Handle the "Sync" method.
         ///
         /// > Source IDL Documentation:
@@ -1061,6 +1158,25 @@ extension Com_Apple_Containerization_Sandbox_V3_SandboxContext {
             context: GRPCCore.ServerContext
         ) async throws -> GRPCCore.ServerResponse<Com_Apple_Containerization_Sandbox_V3_MountResponse>
 
+        /// Handle the "MountBatch" method.
+        ///
+        /// > Source IDL Documentation:
+        /// >
+        /// > Mount several filesystems at once. Hot-plugged block devices are awaited
+        /// > together, then all mounts are performed concurrently.
+        ///
+        /// - Parameters:
+        ///   - request: A request containing a single `Com_Apple_Containerization_Sandbox_V3_MountBatchRequest` message.
+        ///   - context: Context providing information about the RPC.
+        /// - Throws: Any error which occurred during the processing of the request. Thrown errors
+        ///     of type `RPCError` are mapped to appropriate statuses. All other errors are converted
+        ///     to an internal error.
+        /// - Returns: A response containing a single `Com_Apple_Containerization_Sandbox_V3_MountBatchResponse` message.
+        func mountBatch(
+            request: GRPCCore.ServerRequest<Com_Apple_Containerization_Sandbox_V3_MountBatchRequest>,
+            context: GRPCCore.ServerContext
+        ) async throws -> GRPCCore.ServerResponse<Com_Apple_Containerization_Sandbox_V3_MountBatchResponse>
+
         /// Handle the "Umount" method.
         ///
         /// > Source IDL Documentation:
@@ -1550,6 +1666,42 @@ extension Com_Apple_Containerization_Sandbox_V3_SandboxContext {
             context: GRPCCore.ServerContext
         ) async throws -> GRPCCore.ServerResponse<Com_Apple_Containerization_Sandbox_V3_ConfigureHostsResponse>
 
+        /// Handle the "BootTrace" method.
+        ///
+        /// > Source IDL Documentation:
+        /// >
+        /// > Return the guest-side boot trace recorded by the agent.
+        ///
+        /// - Parameters:
+        ///   - request: A request containing a single `Com_Apple_Containerization_Sandbox_V3_BootTraceRequest` message.
+        ///   - context: Context providing information about the RPC.
+        /// - Throws: Any error which occurred during the processing of the request. Thrown errors
+        ///     of type `RPCError` are mapped to appropriate statuses. All other errors are converted
+        ///     to an internal error.
+        /// - Returns: A response containing a single `Com_Apple_Containerization_Sandbox_V3_BootTraceResponse` message.
+        func bootTrace(
+            request: GRPCCore.ServerRequest<Com_Apple_Containerization_Sandbox_V3_BootTraceRequest>,
+            context: GRPCCore.ServerContext
+        ) async throws -> GRPCCore.ServerResponse<Com_Apple_Containerization_Sandbox_V3_BootTraceResponse>
+
+        /// Handle the "Reseed" method.
+        ///
+        /// > Source IDL Documentation:
+        /// >
+        /// > Mix host entropy into the guest RNG and force a reseed.
+        ///
+        /// - Parameters:
+        ///   - request: A request containing a single `Com_Apple_Containerization_Sandbox_V3_ReseedRequest` message.
+        ///   - context: Context providing information about the RPC.
+        /// - Throws: Any error which occurred during the processing of the request. Thrown errors
+        ///     of type `RPCError` are mapped to appropriate statuses. All other errors are converted
+        ///     to an internal error.
+        /// - Returns: A response containing a single `Com_Apple_Containerization_Sandbox_V3_ReseedResponse` message.
+        func reseed(
+            request: GRPCCore.ServerRequest<Com_Apple_Containerization_Sandbox_V3_ReseedRequest>,
+            context: GRPCCore.ServerContext
+        ) async throws -> GRPCCore.ServerResponse<Com_Apple_Containerization_Sandbox_V3_ReseedResponse>
+
         /// Handle the "Sync" method.
         ///
         /// > Source IDL Documentation:
@@ -1615,6 +1767,25 @@ extension Com_Apple_Containerization_Sandbox_V3_SandboxContext {
             context: GRPCCore.ServerContext
         ) async throws -> Com_Apple_Containerization_Sandbox_V3_MountResponse
 
+        /// Handle the "MountBatch" method.
+        ///
+        /// > Source IDL Documentation:
+        /// >
+        /// > Mount several filesystems at once. Hot-plugged block devices are awaited
+        /// > together, then all mounts are performed concurrently.
+        ///
+        /// - Parameters:
+        ///   - request: A `Com_Apple_Containerization_Sandbox_V3_MountBatchRequest` message.
+        ///   - context: Context providing information about the RPC.
+        /// - Throws: Any error which occurred during the processing of the request. Thrown errors
+        ///     of type `RPCError` are mapped to appropriate statuses. All other errors are converted
+        ///     to an internal error.
+        /// - Returns: A `Com_Apple_Containerization_Sandbox_V3_MountBatchResponse` to respond with.
+        func mountBatch(
+            request: Com_Apple_Containerization_Sandbox_V3_MountBatchRequest,
+            context: GRPCCore.ServerContext
+        ) async throws -> Com_Apple_Containerization_Sandbox_V3_MountBatchResponse
+
         /// Handle the "Umount" method.
         ///
         /// > Source IDL Documentation:
@@ -2105,6 +2276,42 @@ extension Com_Apple_Containerization_Sandbox_V3_SandboxContext {
             context: GRPCCore.ServerContext
         ) async throws -> Com_Apple_Containerization_Sandbox_V3_ConfigureHostsResponse
 
+        /// Handle the "BootTrace" method.
+        ///
+        /// > Source IDL Documentation:
+        /// >
+        /// > Return the guest-side boot trace recorded by the agent.
+        ///
+        /// - Parameters:
+        ///   - request: A `Com_Apple_Containerization_Sandbox_V3_BootTraceRequest` message.
+        ///   - context: Context providing information about the RPC.
+        /// - Throws: Any error which occurred during the processing of the request. Thrown errors
+        ///     of type `RPCError` are mapped to appropriate statuses. All other errors are converted
+        ///     to an internal error.
+        /// - Returns: A `Com_Apple_Containerization_Sandbox_V3_BootTraceResponse` to respond with.
+        func bootTrace(
+            request: Com_Apple_Containerization_Sandbox_V3_BootTraceRequest,
+            context: GRPCCore.ServerContext
+        ) async throws -> Com_Apple_Containerization_Sandbox_V3_BootTraceResponse
+
+        /// Handle the "Reseed" method.
+        ///
+        /// > Source IDL Documentation:
+        /// >
+        /// > Mix host entropy into the guest RNG and force a reseed.
+        ///
+        /// - Parameters:
+        ///   - request: A `Com_Apple_Containerization_Sandbox_V3_ReseedRequest` message.
+        ///   - context: Context providing information about the RPC.
+        /// - Throws: Any error which occurred during the processing of the request. Thrown errors
+        ///     of type `RPCError` are mapped to appropriate statuses. All other errors are converted
+        ///     to an internal error.
+        /// - Returns: A `Com_Apple_Containerization_Sandbox_V3_ReseedResponse` to respond with.
+        func reseed(
+            request: Com_Apple_Containerization_Sandbox_V3_ReseedRequest,
+            context: GRPCCore.ServerContext
+        ) async throws -> Com_Apple_Containerization_Sandbox_V3_ReseedResponse
+
         /// Handle the "Sync" method.
         ///
         /// > Source IDL Documentation:
@@ -2158,6 +2365,17 @@ extension Com_Apple_Containerization_Sandbox_V3_SandboxContext.StreamingServiceP
                 )
             }
         )
+        router.registerHandler(
+            forMethod: Com_Apple_Containerization_Sandbox_V3_SandboxContext.Method.MountBatch.descriptor,
+            deserializer: GRPCProtobuf.ProtobufDeserializer<Com_Apple_Containerization_Sandbox_V3_MountBatchRequest>(),
+            serializer: GRPCProtobuf.ProtobufSerializer<Com_Apple_Containerization_Sandbox_V3_MountBatchResponse>(),
+            handler: { request, context in
+                try await self.mountBatch(
+                    request: request,
+                    context: context
+                )
+            }
+        )
         router.registerHandler(
             forMethod: Com_Apple_Containerization_Sandbox_V3_SandboxContext.Method.Umount.descriptor,
             deserializer: GRPCProtobuf.ProtobufDeserializer<Com_Apple_Containerization_Sandbox_V3_UmountRequest>(),
@@ -2455,6 +2673,28 @@ extension Com_Apple_Containerization_Sandbox_V3_SandboxContext.StreamingServiceP
                 )
             }
         )
+        router.registerHandler(
+            forMethod: Com_Apple_Containerization_Sandbox_V3_SandboxContext.Method.BootTrace.descriptor,
+            deserializer: GRPCProtobuf.ProtobufDeserializer<Com_Apple_Containerization_Sandbox_V3_BootTraceRequest>(),
+            serializer: GRPCProtobuf.ProtobufSerializer<Com_Apple_Containerization_Sandbox_V3_BootTraceResponse>(),
+            handler: { request, context in
+                try await self.bootTrace(
+                    request: request,
+                    context: context
+                )
+            }
+        )
+        router.registerHandler(
+            forMethod: Com_Apple_Containerization_Sandbox_V3_SandboxContext.Method.Reseed.descriptor,
+            deserializer: GRPCProtobuf.ProtobufDeserializer<Com_Apple_Containerization_Sandbox_V3_ReseedRequest>(),
+            serializer: GRPCProtobuf.ProtobufSerializer<Com_Apple_Containerization_Sandbox_V3_ReseedResponse>(),
+            handler: { request, context in
+                try await self.reseed(
+                    request: request,
+                    context: context
+                )
+            }
+        )
         router.registerHandler(
             forMethod: Com_Apple_Containerization_Sandbox_V3_SandboxContext.Method.Sync.descriptor,
             deserializer: GRPCProtobuf.ProtobufDeserializer<Com_Apple_Containerization_Sandbox_V3_SyncRequest>(),
@@ -2494,6 +2734,17 @@ extension Com_Apple_Containerization_Sandbox_V3_SandboxContext.ServiceProtocol {
         return GRPCCore.StreamingServerResponse(single: response)
     }
 
+    public func mountBatch(
+        request: GRPCCore.StreamingServerRequest<Com_Apple_Containerization_Sandbox_V3_MountBatchRequest>,
+        context: GRPCCore.ServerContext
+    ) async throws -> GRPCCore.StreamingServerResponse<Com_Apple_Containerization_Sandbox_V3_MountBatchResponse> {
+        let response = try await self.mountBatch(
+            request: GRPCCore.ServerRequest(stream: request),
+            context: context
+        )
+        return GRPCCore.StreamingServerResponse(single: response)
+    }
+
     public func umount(
         request: GRPCCore.StreamingServerRequest<Com_Apple_Containerization_Sandbox_V3_UmountRequest>,
         context: GRPCCore.ServerContext
@@ -2791,6 +3042,28 @@ extension Com_Apple_Containerization_Sandbox_V3_SandboxContext.ServiceProtocol {
         return GRPCCore.StreamingServerResponse(single: response)
     }
 
+    public func bootTrace(
+        request: GRPCCore.StreamingServerRequest<Com_Apple_Containerization_Sandbox_V3_BootTraceRequest>,
+        context: GRPCCore.ServerContext
+    ) async throws -> GRPCCore.StreamingServerResponse<Com_Apple_Containerization_Sandbox_V3_BootTraceResponse> {
+        let response = try await self.bootTrace(
+            request: GRPCCore.ServerRequest(stream: request),
+            context: context
+        )
+        return GRPCCore.StreamingServerResponse(single: response)
+    }
+
+    public func reseed(
+        request: GRPCCore.StreamingServerRequest<Com_Apple_Containerization_Sandbox_V3_ReseedRequest>,
+        context: GRPCCore.ServerContext
+    ) async throws -> GRPCCore.StreamingServerResponse<Com_Apple_Containerization_Sandbox_V3_ReseedResponse> {
+        let response = try await self.reseed(
+            request: GRPCCore.ServerRequest(stream: request),
+            context: context
+        )
+        return GRPCCore.StreamingServerResponse(single: response)
+    }
+
     public func sync(
         request: GRPCCore.StreamingServerRequest<Com_Apple_Containerization_Sandbox_V3_SyncRequest>,
         context: GRPCCore.ServerContext
@@ -2830,6 +3103,19 @@ extension Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServiceProt
         )
     }
 
+    public func mountBatch(
+        request: GRPCCore.ServerRequest<Com_Apple_Containerization_Sandbox_V3_MountBatchRequest>,
+        context: GRPCCore.ServerContext
+    ) async throws -> GRPCCore.ServerResponse<Com_Apple_Containerization_Sandbox_V3_MountBatchResponse> {
+        return GRPCCore.ServerResponse<Com_Apple_Containerization_Sandbox_V3_MountBatchResponse>(
+            message: try await self.mountBatch(
+                request: request.message,
+                context: context
+            ),
+            metadata: [:]
+        )
+    }
+
     public func umount(
         request: GRPCCore.ServerRequest<Com_Apple_Containerization_Sandbox_V3_UmountRequest>,
         context: GRPCCore.ServerContext
@@ -3185,6 +3471,32 @@ extension Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServiceProt
         )
     }
 
+    public func bootTrace(
+        request: GRPCCore.ServerRequest<Com_Apple_Containerization_Sandbox_V3_BootTraceRequest>,
+        context: GRPCCore.ServerContext
+    ) async throws -> GRPCCore.ServerResponse<Com_Apple_Containerization_Sandbox_V3_BootTraceResponse> {
+        return GRPCCore.ServerResponse<Com_Apple_Containerization_Sandbox_V3_BootTraceResponse>(
+            message: try await self.bootTrace(
+                request: request.message,
+                context: context
+            ),
+            metadata: [:]
+        )
+    }
+
+    public func reseed(
+        request: GRPCCore.ServerRequest<Com_Apple_Containerization_Sandbox_V3_ReseedRequest>,
+        context: GRPCCore.ServerContext
+    ) async throws -> GRPCCore.ServerResponse<Com_Apple_Containerization_Sandbox_V3_ReseedResponse> {
+        return GRPCCore.ServerResponse<Com_Apple_Containerization_Sandbox_V3_ReseedResponse>(
+            message: try await self.reseed(
+                request: request.message,
+                context: context
+            ),
+            metadata: [:]
+        )
+    }
+
     public func sync(
         request: GRPCCore.ServerRequest<Com_Apple_Containerization_Sandbox_V3_SyncRequest>,
         context: GRPCCore.ServerContext
@@ -3248,6 +3560,30 @@ extension Com_Apple_Containerization_Sandbox_V3_SandboxContext {
             onResponse handleResponse: @Sendable @escaping (GRPCCore.ClientResponse<Com_Apple_Containerization_Sandbox_V3_MountResponse>) async throws -> Result
         ) async throws -> Result where Result: Sendable
 
+        /// Call the "MountBatch" method.
+        ///
+        /// > Source IDL Documentation:
+        /// >
+        /// > Mount several filesystems at once. Hot-plugged block devices are awaited
+        /// > together, then all mounts are performed concurrently.
+        ///
+        /// - Parameters:
+        ///   - request: A request containing a single `Com_Apple_Containerization_Sandbox_V3_MountBatchRequest` message.
+        ///   - serializer: A serializer for `Com_Apple_Containerization_Sandbox_V3_MountBatchRequest` messages.
+        ///   - deserializer: A deserializer for `Com_Apple_Containerization_Sandbox_V3_MountBatchResponse` messages.
+        ///   - options: Options to apply to this RPC.
+        ///   - handleResponse: A closure which handles the response, the result of which is
+        ///       returned to the caller. Returning from the closure will cancel the RPC if it
+        ///       hasn't already finished.
+        /// - Returns: The result of `handleResponse`.
+        func mountBatch<Result>(
+            request: GRPCCore.ClientRequest<Com_Apple_Containerization_Sandbox_V3_MountBatchRequest>,
+            serializer: some GRPCCore.MessageSerializer<Com_Apple_Containerization_Sandbox_V3_MountBatchRequest>,
+            deserializer: some GRPCCore.MessageDeserializer<Com_Apple_Containerization_Sandbox_V3_MountBatchResponse>,
+            options: GRPCCore.CallOptions,
+            onResponse handleResponse: @Sendable @escaping (GRPCCore.ClientResponse<Com_Apple_Containerization_Sandbox_V3_MountBatchResponse>) async throws -> Result
+        ) async throws -> Result where Result: Sendable
+
         /// Call the "Umount" method.
         ///
         /// > Source IDL Documentation:
@@ -3872,6 +4208,52 @@ extension Com_Apple_Containerization_Sandbox_V3_SandboxContext {
             onResponse handleResponse: @Sendable @escaping (GRPCCore.ClientResponse<Com_Apple_Containerization_Sandbox_V3_ConfigureHostsResponse>) async throws -> Result
         ) async throws -> Result where Result: Sendable
 
+        /// Call the "BootTrace" method.
+        ///
+        /// > Source IDL Documentation:
+        /// >
+        /// > Return the guest-side boot trace recorded by the agent.
+        ///
+        /// - Parameters:
+        ///   - request: A request containing a single `Com_Apple_Containerization_Sandbox_V3_BootTraceRequest` message.
+        ///   - serializer: A serializer for `Com_Apple_Containerization_Sandbox_V3_BootTraceRequest` messages.
+        ///   - deserializer: A deserializer for `Com_Apple_Containerization_Sandbox_V3_BootTraceResponse` messages.
+        ///   - options: Options to apply to this RPC.
+        ///   - handleResponse: A closure which handles the response, the result of which is
+        ///       returned to the caller. Returning from the closure will cancel the RPC if it
+        ///       hasn't already finished.
+        /// - Returns: The result of `handleResponse`.
+        func bootTrace<Result>(
+            request: GRPCCore.ClientRequest<Com_Apple_Containerization_Sandbox_V3_BootTraceRequest>,
+            serializer: some GRPCCore.MessageSerializer<Com_Apple_Containerization_Sandbox_V3_BootTraceRequest>,
+            deserializer: some GRPCCore.MessageDeserializer<Com_Apple_Containerization_Sandbox_V3_BootTraceResponse>,
+            options: GRPCCore.CallOptions,
+            onResponse handleResponse: @Sendable @escaping (GRPCCore.ClientResponse<Com_Apple_Containerization_Sandbox_V3_BootTraceResponse>) async throws -> Result
+        ) async throws -> Result where Result: Sendable
+
+        /// Call the "Reseed" method.
+        ///
+        /// > Source IDL Documentation:
+        /// >
+        /// > Mix host entropy into the guest RNG and force a reseed.
+        ///
+        /// - Parameters:
+        ///   - request: A request containing a single `Com_Apple_Containerization_Sandbox_V3_ReseedRequest` message.
+        ///   - serializer: A serializer for `Com_Apple_Containerization_Sandbox_V3_ReseedRequest` messages.
+        ///   - deserializer: A deserializer for `Com_Apple_Containerization_Sandbox_V3_ReseedResponse` messages.
+        ///   - options: Options to apply to this RPC.
+        ///   - handleResponse: A closure which handles the response, the result of which is
+        ///       returned to the caller. Returning from the closure will cancel the RPC if it
+        ///       hasn't already finished.
+        /// - Returns: The result of `handleResponse`.
+        func reseed<Result>(
+            request: GRPCCore.ClientRequest<Com_Apple_Containerization_Sandbox_V3_ReseedRequest>,
+            serializer: some GRPCCore.MessageSerializer<Com_Apple_Containerization_Sandbox_V3_ReseedRequest>,
+            deserializer: some GRPCCore.MessageDeserializer<Com_Apple_Containerization_Sandbox_V3_ReseedResponse>,
+            options: GRPCCore.CallOptions,
+            onResponse handleResponse: @Sendable @escaping (GRPCCore.ClientResponse<Com_Apple_Containerization_Sandbox_V3_ReseedResponse>) async throws -> Result
+        ) async throws -> Result where Result: Sendable
+
         /// Call the "Sync" method.
         ///
         /// > Source IDL Documentation:
@@ -3973,6 +4355,41 @@ extension Com_Apple_Containerization_Sandbox_V3_SandboxContext {
             )
         }
 
+        /// Call the "MountBatch" method.
+        ///
+        /// > Source IDL Documentation:
+        /// >
+        /// > Mount several filesystems at once. Hot-plugged block devices are awaited
+        /// > together, then all mounts are performed concurrently.
+        ///
+        /// - Parameters:
+        ///   - request: A request containing a single `Com_Apple_Containerization_Sandbox_V3_MountBatchRequest` message.
+        ///   - serializer: A serializer for `Com_Apple_Containerization_Sandbox_V3_MountBatchRequest` messages.
+        ///   - deserializer: A deserializer for `Com_Apple_Containerization_Sandbox_V3_MountBatchResponse` messages.
+        ///   - options: Options to apply to this RPC.
+        ///   - handleResponse: A closure which handles the response, the result of which is
+        ///       returned to the caller. Returning from the closure will cancel the RPC if it
+        ///       hasn't already finished.
+        /// - Returns: The result of `handleResponse`.
+        public func mountBatch<Result>(
+            request: GRPCCore.ClientRequest<Com_Apple_Containerization_Sandbox_V3_MountBatchRequest>,
+            serializer: some GRPCCore.MessageSerializer<Com_Apple_Containerization_Sandbox_V3_MountBatchRequest>,
+            deserializer: some GRPCCore.MessageDeserializer<Com_Apple_Containerization_Sandbox_V3_MountBatchResponse>,
+            options: GRPCCore.CallOptions = .defaults,
+            onResponse handleResponse: @Sendable @escaping (GRPCCore.ClientResponse<Com_Apple_Containerization_Sandbox_V3_MountBatchResponse>) async throws -> Result = { response in
+                try response.message
+            }
+        ) async throws -> Result where Result: Sendable {
+            try await self.client.unary(
+                request: request,
+                descriptor: Com_Apple_Containerization_Sandbox_V3_SandboxContext.Method.MountBatch.descriptor,
+                serializer: serializer,
+                deserializer: deserializer,
+                options: options,
+                onResponse: handleResponse
+            )
+        }
+
         /// Call the "Umount" method.
         ///
         /// > Source IDL Documentation:
@@ -4892,6 +5309,74 @@ extension Com_Apple_Containerization_Sandbox_V3_SandboxContext {
             )
         }
 
+        /// Call the "BootTrace" method.
+        ///
+        /// > Source IDL Documentation:
+        /// >
+        /// > Return the guest-side boot trace recorded by the agent.
+        ///
+        /// - Parameters:
+        ///   - request: A request containing a single `Com_Apple_Containerization_Sandbox_V3_BootTraceRequest` message.
+        ///   - serializer: A serializer for `Com_Apple_Containerization_Sandbox_V3_BootTraceRequest` messages.
+        ///   - deserializer: A deserializer for `Com_Apple_Containerization_Sandbox_V3_BootTraceResponse` messages.
+        ///   - options: Options to apply to this RPC.
+        ///   - handleResponse: A closure which handles the response, the result of which is
+        ///       returned to the caller. Returning from the closure will cancel the RPC if it
+        ///       hasn't already finished.
+        /// - Returns: The result of `handleResponse`.
+        public func bootTrace<Result>(
+            request: GRPCCore.ClientRequest<Com_Apple_Containerization_Sandbox_V3_BootTraceRequest>,
+            serializer: some GRPCCore.MessageSerializer<Com_Apple_Containerization_Sandbox_V3_BootTraceRequest>,
+            deserializer: some GRPCCore.MessageDeserializer<Com_Apple_Containerization_Sandbox_V3_BootTraceResponse>,
+            options: GRPCCore.CallOptions = .defaults,
+            onResponse handleResponse: @Sendable @escaping (GRPCCore.ClientResponse<Com_Apple_Containerization_Sandbox_V3_BootTraceResponse>) async throws -> Result = { response in
+                try response.message
+            }
+        ) async throws -> Result where Result: Sendable {
+            try await self.client.unary(
+                request: request,
+                descriptor: Com_Apple_Containerization_Sandbox_V3_SandboxContext.Method.BootTrace.descriptor,
+                serializer: serializer,
+                deserializer: deserializer,
+                options: options,
+                onResponse: handleResponse
+            )
+        }
+
+        /// Call the "Reseed" method.
+        ///
+        /// > Source IDL Documentation:
+        /// >
+        /// > Mix host entropy into the guest RNG and force a reseed.
+        ///
+        /// - Parameters:
+        ///   - request: A request containing a single `Com_Apple_Containerization_Sandbox_V3_ReseedRequest` message.
+        ///   - serializer: A serializer for `Com_Apple_Containerization_Sandbox_V3_ReseedRequest` messages.
+        ///   - deserializer: A deserializer for `Com_Apple_Containerization_Sandbox_V3_ReseedResponse` messages.
+        ///   - options: Options to apply to this RPC.
+        ///   - handleResponse: A closure which handles the response, the result of which is
+        ///       returned to the caller. Returning from the closure will cancel the RPC if it
+        ///       hasn't already finished.
+        /// - Returns: The result of `handleResponse`.
+        public func reseed<Result>(
+            request: GRPCCore.ClientRequest<Com_Apple_Containerization_Sandbox_V3_ReseedRequest>,
+            serializer: some GRPCCore.MessageSerializer<Com_Apple_Containerization_Sandbox_V3_ReseedRequest>,
+            deserializer: some GRPCCore.MessageDeserializer<Com_Apple_Containerization_Sandbox_V3_ReseedResponse>,
+            options: GRPCCore.CallOptions = .defaults,
+            onResponse handleResponse: @Sendable @escaping (GRPCCore.ClientResponse<Com_Apple_Containerization_Sandbox_V3_ReseedResponse>) async throws -> Result = { response in
+                try response.message
+            }
+        ) async throws -> Result where Result: Sendable {
+            try await self.client.unary(
+                request: request,
+                descriptor: Com_Apple_Containerization_Sandbox_V3_SandboxContext.Method.Reseed.descriptor,
+                serializer: serializer,
+                deserializer: deserializer,
+                options: options,
+                onResponse: handleResponse
+            )
+        }
+
         /// Call the "Sync" method.
         ///
         /// > Source IDL Documentation:
@@ -4994,6 +5479,36 @@ extension Com_Apple_Containerization_Sandbox_V3_SandboxContext.ClientProtocol {
         )
     }
 
+    /// Call the "MountBatch" method.
+    ///
+    /// > Source IDL Documentation:
+    /// >
+    /// > Mount several filesystems at once. Hot-plugged block devices are awaited
+    /// > together, then all mounts are performed concurrently.
+    ///
+    /// - Parameters:
+    ///   - request: A request containing a single `Com_Apple_Containerization_Sandbox_V3_MountBatchRequest` message.
+    ///   - options: Options to apply to this RPC.
+    ///   - handleResponse: A closure which handles the response, the result of which is
+    ///       returned to the caller. Returning from the closure will cancel the RPC if it
+    ///       hasn't already finished.
+    /// - Returns: The result of `handleResponse`.
+    public func mountBatch<Result>(
+        request: GRPCCore.ClientRequest<Com_Apple_Containerization_Sandbox_V3_MountBatchRequest>,
+        options: GRPCCore.CallOptions = .defaults,
+        onResponse handleResponse: @Sendable @escaping (GRPCCore.ClientResponse<Com_Apple_Containerization_Sandbox_V3_MountBatchResponse>) async throws -> Result = { response in
+            try response.message
+        }
+    ) async throws -> Result where Result: Sendable {
+        try await self.mountBatch(
+            request: request,
+            serializer: GRPCProtobuf.ProtobufSerializer<Com_Apple_Containerization_Sandbox_V3_MountBatchRequest>(),
+            deserializer: GRPCProtobuf.ProtobufDeserializer<Com_Apple_Containerization_Sandbox_V3_MountBatchResponse>(),
+            options: options,
+            onResponse: handleResponse
+        )
+    }
+
     /// Call the "Umount" method.
     ///
     /// > Source IDL Documentation:
@@ -5778,6 +6293,64 @@ extension Com_Apple_Containerization_Sandbox_V3_SandboxContext.ClientProtocol {
         )
     }
 
+    /// Call the "BootTrace" method.
+    ///
+    /// > Source IDL Documentation:
+    /// >
+    /// > Return the guest-side boot trace recorded by the agent.
+    ///
+    /// - Parameters:
+    ///   - request: A request containing a single `Com_Apple_Containerization_Sandbox_V3_BootTraceRequest` message.
+    ///   - options: Options to apply to this RPC.
+    ///   - handleResponse: A closure which handles the response, the result of which is
+    ///       returned to the caller. Returning from the closure will cancel the RPC if it
+    ///       hasn't already finished.
+    /// - Returns: The result of `handleResponse`.
+    public func bootTrace<Result>(
+        request: GRPCCore.ClientRequest<Com_Apple_Containerization_Sandbox_V3_BootTraceRequest>,
+        options: GRPCCore.CallOptions = .defaults,
+        onResponse handleResponse: @Sendable @escaping (GRPCCore.ClientResponse<Com_Apple_Containerization_Sandbox_V3_BootTraceResponse>) async throws -> Result = { response in
+            try response.message
+        }
+    ) async throws -> Result where Result: Sendable {
+        try await self.bootTrace(
+            request: request,
+            serializer: GRPCProtobuf.ProtobufSerializer<Com_Apple_Containerization_Sandbox_V3_BootTraceRequest>(),
+            deserializer: GRPCProtobuf.ProtobufDeserializer<Com_Apple_Containerization_Sandbox_V3_BootTraceResponse>(),
+            options: options,
+            onResponse: handleResponse
+        )
+    }
+
+    /// Call the "Reseed" method.
+    ///
+    /// > Source IDL Documentation:
+    /// >
+    /// > Mix host entropy into the guest RNG and force a reseed.
+    ///
+    /// - Parameters:
+    ///   - request: A request containing a single `Com_Apple_Containerization_Sandbox_V3_ReseedRequest` message.
+    ///   - options: Options to apply to this RPC.
+    ///   - handleResponse: A closure which handles the response, the result of which is
+    ///       returned to the caller. Returning from the closure will cancel the RPC if it
+    ///       hasn't already finished.
+    /// - Returns: The result of `handleResponse`.
+    public func reseed<Result>(
+        request: GRPCCore.ClientRequest<Com_Apple_Containerization_Sandbox_V3_ReseedRequest>,
+        options: GRPCCore.CallOptions = .defaults,
+        onResponse handleResponse: @Sendable @escaping (GRPCCore.ClientResponse<Com_Apple_Containerization_Sandbox_V3_ReseedResponse>) async throws -> Result = { response in
+            try response.message
+        }
+    ) async throws -> Result where Result: Sendable {
+        try await self.reseed(
+            request: request,
+            serializer: GRPCProtobuf.ProtobufSerializer<Com_Apple_Containerization_Sandbox_V3_ReseedRequest>(),
+            deserializer: GRPCProtobuf.ProtobufDeserializer<Com_Apple_Containerization_Sandbox_V3_ReseedResponse>(),
+            options: options,
+            onResponse: handleResponse
+        )
+    }
+
     /// Call the "Sync" method.
     ///
     /// > Source IDL Documentation:
@@ -5873,6 +6446,40 @@ extension Com_Apple_Containerization_Sandbox_V3_SandboxContext.ClientProtocol {
         )
     }
 
+    /// Call the "MountBatch" method.
+    ///
+    /// > Source IDL Documentation:
+    /// >
+    /// > Mount several filesystems at once. Hot-plugged block devices are awaited
+    /// > together, then all mounts are performed concurrently.
+    ///
+    /// - Parameters:
+    ///   - message: request message to send.
+    ///   - metadata: Additional metadata to send, defaults to empty.
+    ///   - options: Options to apply to this RPC, defaults to `.defaults`.
+    ///   - handleResponse: A closure which handles the response, the result of which is
+    ///       returned to the caller. Returning from the closure will cancel the RPC if it
+    ///       hasn't already finished.
+    /// - Returns: The result of `handleResponse`.
+    public func mountBatch<Result>(
+        _ message: Com_Apple_Containerization_Sandbox_V3_MountBatchRequest,
+        metadata: GRPCCore.Metadata = [:],
+        options: GRPCCore.CallOptions = .defaults,
+        onResponse handleResponse: @Sendable @escaping (GRPCCore.ClientResponse<Com_Apple_Containerization_Sandbox_V3_MountBatchResponse>) async throws -> Result = { response in
+            try response.message
+        }
+    ) async throws -> Result where Result: Sendable {
+        let request = GRPCCore.ClientRequest<Com_Apple_Containerization_Sandbox_V3_MountBatchRequest>(
+            message: message,
+            metadata: metadata
+        )
+        return try await self.mountBatch(
+            request: request,
+            options: options,
+            onResponse: handleResponse
+        )
+    }
+
     /// Call the "Umount" method.
     ///
     /// > Source IDL Documentation:
@@ -6765,6 +7372,72 @@ extension Com_Apple_Containerization_Sandbox_V3_SandboxContext.ClientProtocol {
         )
     }
 
+    /// Call the "BootTrace" method.
+    ///
+    /// > Source IDL Documentation:
+    /// >
+    /// > Return the guest-side boot trace recorded by the agent.
+    ///
+    /// - Parameters:
+    ///   - message: request message to send.
+    ///   - metadata: Additional metadata to send, defaults to empty.
+    ///   - options: Options to apply to this RPC, defaults to `.defaults`.
+    ///   - handleResponse: A closure which handles the response, the result of which is
+    ///       returned to the caller. Returning from the closure will cancel the RPC if it
+    ///       hasn't already finished.
+    /// - Returns: The result of `handleResponse`.
+    public func bootTrace<Result>(
+        _ message: Com_Apple_Containerization_Sandbox_V3_BootTraceRequest,
+        metadata: GRPCCore.Metadata = [:],
+        options: GRPCCore.CallOptions = .defaults,
+        onResponse handleResponse: @Sendable @escaping (GRPCCore.ClientResponse<Com_Apple_Containerization_Sandbox_V3_BootTraceResponse>) async throws -> Result = { response in
+            try response.message
+        }
+    ) async throws -> Result where Result: Sendable {
+        let request = GRPCCore.ClientRequest<Com_Apple_Containerization_Sandbox_V3_BootTraceRequest>(
+            message: message,
+            metadata: metadata
+        )
+        return try await self.bootTrace(
+            request: request,
+            options: options,
+            onResponse: handleResponse
+        )
+    }
+
+    /// Call the "Reseed" method.
+    ///
+    /// > Source IDL Documentation:
+    /// >
+    /// > Mix host entropy into the guest RNG and force a reseed.
+    ///
+    /// - Parameters:
+    ///   - message: request message to send.
+    ///   - metadata: Additional metadata to send, defaults to empty.
+    ///   - options: Options to apply to this RPC, defaults to `.defaults`.
+    ///   - handleResponse: A closure which handles the response, the result of which is
+    ///       returned to the caller. Returning from the closure will cancel the RPC if it
+    ///       hasn't already finished.
+    /// - Returns: The result of `handleResponse`.
+    public func reseed<Result>(
+        _ message: Com_Apple_Containerization_Sandbox_V3_ReseedRequest,
+        metadata: GRPCCore.Metadata = [:],
+        options: GRPCCore.CallOptions = .defaults,
+        onResponse handleResponse: @Sendable @escaping (GRPCCore.ClientResponse<Com_Apple_Containerization_Sandbox_V3_ReseedResponse>) async throws -> Result = { response in
+            try response.message
+        }
+    ) async throws -> Result where Result: Sendable {
+        let request = GRPCCore.ClientRequest<Com_Apple_Containerization_Sandbox_V3_ReseedRequest>(
+            message: message,
+            metadata: metadata
+        )
+        return try await self.reseed(
+            request: request,
+            options: options,
+            onResponse: handleResponse
+        )
+    }
+
     /// Call the "Sync" method.
     ///
     /// > Source IDL Documentation:
@@ -239,6 +239,12 @@ public nonisolated struct Com_Apple_Containerization_Sandbox_V3_ProxyVsockReques
 
   public var action: Com_Apple_Containerization_Sandbox_V3_ProxyVsockRequest.Action = .into
 
+  /// For TCP and UDP the guest end is guestPort on the guest loopback
+  /// address instead of the socket at guestPath.
+  public var transport: Com_Apple_Containerization_Sandbox_V3_ProxyVsockRequest.Transport = .unix
+
+  public var guestPort: UInt32 = 0
+
   public var unknownFields = SwiftProtobuf.UnknownStorage()
 
   public nonisolated enum Action: SwiftProtobuf.Enum, Swift.CaseIterable {
@@ -275,6 +281,44 @@ public nonisolated struct Com_Apple_Containerization_Sandbox_V3_ProxyVsockReques
 
   }
 
+  public nonisolated enum Transport: SwiftProtobuf.Enum, Swift.CaseIterable {
+    public typealias RawValue = Int
+    case unix // = 0
+    case tcp // = 1
+    case udp // = 2
+    case UNRECOGNIZED(Int)
+
+    public init() {
+      self = .unix
+    }
+
+    public init?(rawValue: Int) {
+      switch rawValue {
+      case 0: self = .unix
+      case 1: self = .tcp
+      case 2: self = .udp
+      default: self = .UNRECOGNIZED(rawValue)
+      }
+    }
+
+    public var rawValue: Int {
+      switch self {
+      case .unix: return 0
+      case .tcp: return 1
+      case .udp: return 2
+      case .UNRECOGNIZED(let i): return i
+      }
+    }
+
+    // The compiler won't synthesize support with the UNRECOGNIZED case.
+    public static let allCases: [Com_Apple_Containerization_Sandbox_V3_ProxyVsockRequest.Transport] = [
+      .unix,
+      .tcp,
+      .udp,
+    ]
+
+  }
+
   public init() {}
 
   fileprivate var _guestSocketPermissions: UInt32? = nil
@@ -340,6 +384,28 @@ public nonisolated struct Com_Apple_Containerization_Sandbox_V3_MountResponse: S
   public init() {}
 }
 
+public nonisolated struct Com_Apple_Containerization_Sandbox_V3_MountBatchRequest: Sendable {
+  // SwiftProtobuf.Message conformance is added in an extension below. See the
+  // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
+  // methods supported on all messages.
+
+  public var mounts: [Com_Apple_Containerization_Sandbox_V3_MountRequest] = []
+
+  public var unknownFields = SwiftProtobuf.UnknownStorage()
+
+  public init() {}
+}
+
+public nonisolated struct Com_Apple_Containerization_Sandbox_V3_MountBatchResponse: Sendable {
+  // SwiftProtobuf.Message conformance is added in an extension below. See the
+  // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
+  // methods supported on all messages.
+
+  public var unknownFields = SwiftProtobuf.UnknownStorage()
+
+  public init() {}
+}
+
 public nonisolated struct Com_Apple_Containerization_Sandbox_V3_UmountRequest: Sendable {
   // SwiftProtobuf.Message conformance is added in an extension below. See the
   // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
@@ -554,11 +620,53 @@ public nonisolated struct Com_Apple_Containerization_Sandbox_V3_WaitProcessRespo
   /// Clears the value of `exitedAt`. Subsequent reads from it will return its default value.
   public mutating func clearExitedAt() {self._exitedAt = nil}
 
+  /// Resource usage of the reaped process; unset if it wasn't reaped by the
+  /// guest agent.
+  public var usage: Com_Apple_Containerization_Sandbox_V3_ResourceUsage {
+    get {_usage ?? Com_Apple_Containerization_Sandbox_V3_ResourceUsage()}
+    set {_usage = newValue}
+  }
+  /// Returns true if `usage` has been explicitly set.
+  public var hasUsage: Bool {self._usage != nil}
+  /// Clears the value of `usage`. Subsequent reads from it will return its default value.
+  public mutating func clearUsage() {self._usage = nil}
+
   public var unknownFields = SwiftProtobuf.UnknownStorage()
 
   public init() {}
 
   fileprivate var _exitedAt: SwiftProtobuf.Google_Protobuf_Timestamp? = nil
+  fileprivate var _usage: Com_Apple_Containerization_Sandbox_V3_ResourceUsage? = nil
+}
+
+/// Resource usage of a reaped process and its waited-for children, as
+/// reported by wait4(2).
+public nonisolated struct Com_Apple_Containerization_Sandbox_V3_ResourceUsage: Sendable {
+  // SwiftProtobuf.Message conformance is added in an extension below. See the
+  // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
+  // methods supported on all messages.
+
+  public var userTimeUsec: UInt64 = 0
+
+  public var systemTimeUsec: UInt64 = 0
+
+  public var maxRssBytes: UInt64 = 0
+
+  public var minorPageFaults: UInt64 = 0
+
+  public var majorPageFaults: UInt64 = 0
+
+  public var voluntaryContextSwitches: UInt64 = 0
+
+  public var involuntaryContextSwitches: UInt64 = 0
+
+  public var blockInputOps: UInt64 = 0
+
+  public var blockOutputOps: UInt64 = 0
+
+  public var unknownFields = SwiftProtobuf.UnknownStorage()
+
+  public init() {}
 }
 
 public nonisolated struct Com_Apple_Containerization_Sandbox_V3_ResizeProcessRequest: Sendable {
@@ -1365,6 +1473,10 @@ public nonisolated struct Com_Apple_Containerization_Sandbox_V3_ConfigureDnsRequ
 
   public var options: [String] = []
 
+  /// Point resolv.conf at a caching stub resolver run by the agent, which
+  /// forwards to nameservers.
+  public var localCache: Bool = false
+
   public var unknownFields = SwiftProtobuf.UnknownStorage()
 
   public init() {}
@@ -1442,6 +1554,58 @@ public nonisolated struct Com_Apple_Containerization_Sandbox_V3_ConfigureHostsRe
   public init() {}
 }
 
+public nonisolated struct Com_Apple_Containerization_Sandbox_V3_BootTraceRequest: Sendable {
+  // SwiftProtobuf.Message conformance is added in an extension below. See the
+  // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
+  // methods supported on all messages.
+
+  /// Include this container's spans along with the agent's own.
+  public var containerID: String = String()
+
+  /// Discard everything recorded so far instead of returning it.
+  public var reset: Bool = false
+
+  public var unknownFields = SwiftProtobuf.UnknownStorage()
+
+  public init() {}
+}
+
+public nonisolated struct Com_Apple_Containerization_Sandbox_V3_BootTraceResponse: Sendable {
+  // SwiftProtobuf.Message conformance is added in an extension below. See the
+  // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
+  // methods supported on all messages.
+
+  /// Chrome trace event JSON, timestamps in guest CLOCK_MONOTONIC microseconds.
+  public var trace: Data = Data()
+
+  public var unknownFields = SwiftProtobuf.UnknownStorage()
+
+  public init() {}
+}
+
+public nonisolated struct Com_Apple_Containerization_Sandbox_V3_ReseedRequest: Sendable {
+  // SwiftProtobuf.Message conformance is added in an extension below. See the
+  // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
+  // methods supported on all messages.
+
+  /// Random bytes from the host, credited in full to the guest RNG.
+  public var entropy: Data = Data()
+
+  public var unknownFields = SwiftProtobuf.UnknownStorage()
+
+  public init() {}
+}
+
+public nonisolated struct Com_Apple_Containerization_Sandbox_V3_ReseedResponse: Sendable {
+  // SwiftProtobuf.Message conformance is added in an extension below. See the
+  // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
+  // methods supported on all messages.
+
+  public var unknownFields = SwiftProtobuf.UnknownStorage()
+
+  public init() {}
+}
+
 public nonisolated struct Com_Apple_Containerization_Sandbox_V3_SyncRequest: Sendable {
   // SwiftProtobuf.Message conformance is added in an extension below. See the
   // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
@@ -1985,7 +2149,7 @@ nonisolated extension Com_Apple_Containerization_Sandbox_V3_SysctlResponse: Swif
 
 nonisolated extension Com_Apple_Containerization_Sandbox_V3_ProxyVsockRequest: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
   public static let protoMessageName: String = _protobuf_package + ".ProxyVsockRequest"
-  public static let _protobuf_nameMap = SwiftProtobuf._NameMap(bytecode: "\0\u{1}id\0\u{3}vsock_port\0\u{1}guestPath\0\u{1}guestSocketPermissions\0\u{1}action\0")
+  public static let _protobuf_nameMap = SwiftProtobuf._NameMap(bytecode: "\0\u{1}id\0\u{3}vsock_port\0\u{1}guestPath\0\u{1}guestSocketPermissions\0\u{1}action\0\u{1}transport\0\u{1}guestPort\0")
 
   public mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
     while let fieldNumber = try decoder.nextFieldNumber() {
@@ -1998,6 +2162,8 @@ nonisolated extension Com_Apple_Containerization_Sandbox_V3_ProxyVsockRequest: S
       case 3: try { try decoder.decodeSingularStringField(value: &self.guestPath) }()
       case 4: try { try decoder.decodeSingularUInt32Field(value: &self._guestSocketPermissions) }()
       case 5: try { try decoder.decodeSingularEnumField(value: &self.action) }()
+      case 6: try { try decoder.decodeSingularEnumField(value: &self.transport) }()
+      case 7: try { try decoder.decodeSingularUInt32Field(value: &self.guestPort) }()
       default: break
       }
     }
@@ -2023,6 +2189,12 @@ nonisolated extension Com_Apple_Containerization_Sandbox_V3_ProxyVsockRequest: S
     if self.action != .into {
       try visitor.visitSingularEnumField(value: self.action, fieldNumber: 5)
     }
+    if self.transport != .unix {
+      try visitor.visitSingularEnumField(value: self.transport, fieldNumber: 6)
+    }
+    if self.guestPort != 0 {
+      try visitor.visitSingularUInt32Field(value: self.guestPort, fieldNumber: 7)
+    }
     try unknownFields.traverse(visitor: &visitor)
   }
 
@@ -2032,6 +2204,8 @@ nonisolated extension Com_Apple_Containerization_Sandbox_V3_ProxyVsockRequest: S
     if lhs.guestPath != rhs.guestPath {return false}
     if lhs._guestSocketPermissions != rhs._guestSocketPermissions {return false}
     if lhs.action != rhs.action {return false}
+    if lhs.transport != rhs.transport {return false}
+    if lhs.guestPort != rhs.guestPort {return false}
     if lhs.unknownFields != rhs.unknownFields {return false}
     return true
   }
@@ -2041,6 +2215,10 @@ nonisolated extension Com_Apple_Containerization_Sandbox_V3_ProxyVsockRequest.Ac
   public static let _protobuf_nameMap = SwiftProtobuf._NameMap(bytecode: "\0\u{2}\0INTO\0\u{1}OUT_OF\0")
 }
 
+nonisolated extension Com_Apple_Containerization_Sandbox_V3_ProxyVsockRequest.Transport: SwiftProtobuf._ProtoNameProviding {
+  public static let _protobuf_nameMap = SwiftProtobuf._NameMap(bytecode: "\0\u{2}\0UNIX\0\u{1}TCP\0\u{1}UDP\0")
+}
+
 nonisolated extension Com_Apple_Containerization_Sandbox_V3_ProxyVsockResponse: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
   public static let protoMessageName: String = _protobuf_package + ".ProxyVsockResponse"
   public static let _protobuf_nameMap = SwiftProtobuf._NameMap()
@@ -2173,6 +2351,55 @@ nonisolated extension Com_Apple_Containerization_Sandbox_V3_MountResponse: Swift
   }
 }
 
+nonisolated extension Com_Apple_Containerization_Sandbox_V3_MountBatchRequest: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
+  public static let protoMessageName: String = _protobuf_package + ".MountBatchRequest"
+  public static let _protobuf_nameMap = SwiftProtobuf._NameMap(bytecode: "\0\u{1}mounts\0")
+
+  public mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
+    while let fieldNumber = try decoder.nextFieldNumber() {
+      // The use of inline closures is to circumvent an issue where the compiler
+      // allocates stack space for every case branch when no optimizations are
+      // enabled. https://github.com/apple/swift-protobuf/issues/1034
+      switch fieldNumber {
+      case 1: try { try decoder.decodeRepeatedMessageField(value: &self.mounts) }()
+      default: break
+      }
+    }
+  }
+
+  public func traverse<V: SwiftProtobuf.Visitor>(visitor: inout V) throws {
+    if !self.mounts.isEmpty {
+      try visitor.visitRepeatedMessageField(value: self.mounts, fieldNumber: 1)
+    }
+    try unknownFields.traverse(visitor: &visitor)
+  }
+
+  public static func ==(lhs: Com_Apple_Containerization_Sandbox_V3_MountBatchRequest, rhs: Com_Apple_Containerization_Sandbox_V3_MountBatchRequest) -> Bool {
+    if lhs.mounts != rhs.mounts {return false}
+    if lhs.unknownFields != rhs.unknownFields {return false}
+    return true
+  }
+}
+
+nonisolated extension Com_Apple_Containerization_Sandbox_V3_MountBatchResponse: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
+  public static let protoMessageName: String = _protobuf_package + ".MountBatchResponse"
+  public static let _protobuf_nameMap = SwiftProtobuf._NameMap()
+
+  public mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
+    // Load everything into unknown fields
+    while try decoder.nextFieldNumber() != nil {}
+  }
+
+  public func traverse<V: SwiftProtobuf.Visitor>(visitor: inout V) throws {
+    try unknownFields.traverse(visitor: &visitor)
+  }
+
+  public static func ==(lhs: Com_Apple_Containerization_Sandbox_V3_MountBatchResponse, rhs: Com_Apple_Containerization_Sandbox_V3_MountBatchResponse) -> Bool {
+    if lhs.unknownFields != rhs.unknownFields {return false}
+    return true
+  }
+}
+
 nonisolated extension Com_Apple_Containerization_Sandbox_V3_UmountRequest: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
   public static let protoMessageName: String = _protobuf_package + ".UmountRequest"
   public static let _protobuf_nameMap = SwiftProtobuf._NameMap(bytecode: "\0\u{1}path\0\u{1}flags\0")
@@ -2478,7 +2705,7 @@ nonisolated extension Com_Apple_Containerization_Sandbox_V3_WaitProcessRequest:
 
 nonisolated extension Com_Apple_Containerization_Sandbox_V3_WaitProcessResponse: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
   public static let protoMessageName: String = _protobuf_package + ".WaitProcessResponse"
-  public static let _protobuf_nameMap = SwiftProtobuf._NameMap(bytecode: "\0\u{1}exitCode\0\u{3}exited_at\0")
+  public static let _protobuf_nameMap = SwiftProtobuf._NameMap(bytecode: "\0\u{1}exitCode\0\u{3}exited_at\0\u{1}usage\0")
 
   public mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
     while let fieldNumber = try decoder.nextFieldNumber() {
@@ -2488,6 +2715,7 @@ nonisolated extension Com_Apple_Containerization_Sandbox_V3_WaitProcessResponse:
       switch fieldNumber {
       case 1: try { try decoder.decodeSingularInt32Field(value: &self.exitCode) }()
       case 2: try { try decoder.decodeSingularMessageField(value: &self._exitedAt) }()
+      case 3: try { try decoder.decodeSingularMessageField(value: &self._usage) }()
       default: break
       }
     }
@@ -2504,12 +2732,86 @@ nonisolated extension Com_Apple_Containerization_Sandbox_V3_WaitProcessResponse:
     try { if let v = self._exitedAt {
       try visitor.visitSingularMessageField(value: v, fieldNumber: 2)
     } }()
+    try { if let v = self._usage {
+      try visitor.visitSingularMessageField(value: v, fieldNumber: 3)
+    } }()
     try unknownFields.traverse(visitor: &visitor)
   }
 
   public static func ==(lhs: Com_Apple_Containerization_Sandbox_V3_WaitProcessResponse, rhs: Com_Apple_Containerization_Sandbox_V3_WaitProcessResponse) -> Bool {
     if lhs.exitCode != rhs.exitCode {return false}
     if lhs._exitedAt != rhs._exitedAt {return false}
+    if lhs._usage != rhs._usage {return false}
+    if lhs.unknownFields != rhs.unknownFields {return false}
+    return true
+  }
+}
+
+nonisolated extension Com_Apple_Containerization_Sandbox_V3_ResourceUsage: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
+  public static let protoMessageName: String = _protobuf_package + ".ResourceUsage"
+  public static let _protobuf_nameMap = SwiftProtobuf._NameMap(bytecode: "\0\u{3}user_time_usec\0\u{3}system_time_usec\0\u{3}max_rss_bytes\0\u{3}minor_page_faults\0\u{3}major_page_faults\0\u{3}voluntary_context_switches\0\u{3}involuntary_context_switches\0\u{3}block_input_ops\0\u{3}block_output_ops\0")
+
+  public mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
+    while let fieldNumber = try decoder.nextFieldNumber() {
+      // The use of inline closures is to circumvent an issue where the compiler
+      // allocates stack space for every case branch when no optimizations are
+      // enabled. https://github.com/apple/swift-protobuf/issues/1034
+      switch fieldNumber {
+      case 1: try { try decoder.decodeSingularUInt64Field(value: &self.userTimeUsec) }()
+      case 2: try { try decoder.decodeSingularUInt64Field(value: &self.systemTimeUsec) }()
+      case 3: try { try decoder.decodeSingularUInt64Field(value: &self.maxRssBytes) }()
+      case 4: try { try decoder.decodeSingularUInt64Field(value: &self.minorPageFaults) }()
+      case 5: try { try decoder.decodeSingularUInt64Field(value: &self.majorPageFaults) }()
+      case 6: try { try decoder.decodeSingularUInt64Field(value: &self.voluntaryContextSwitches) }()
+      case 7: try { try decoder.decodeSingularUInt64Field(value: &self.involuntaryContextSwitches) }()
+      case 8: try { try decoder.decodeSingularUInt64Field(value: &self.blockInputOps) }()
+      case 9: try { try decoder.decodeSingularUInt64Field(value: &self.blockOutputOps) }()
+      default: break
+      }
+    }
+  }
+
+  public func traverse<V: SwiftProtobuf.Visitor>(visitor: inout V) throws {
+    if self.userTimeUsec != 0 {
+      try visitor.visitSingularUInt64Field(value: self.userTimeUsec, fieldNumber: 1)
+    }
+    if self.systemTimeUsec != 0 {
+      try visitor.visitSingularUInt64Field(value: self.systemTimeUsec, fieldNumber: 2)
+    }
+    if self.maxRssBytes != 0 {
+      try visitor.visitSingularUInt64Field(value: self.maxRssBytes, fieldNumber: 3)
+    }
+    if self.minorPageFaults != 0 {
+      try visitor.visitSingularUInt64Field(value: self.minorPageFaults, fieldNumber: 4)
+    }
+    if self.majorPageFaults != 0 {
+      try visitor.visitSingularUInt64Field(value: self.majorPageFaults, fieldNumber: 5)
+    }
+    if self.voluntaryContextSwitches != 0 {
+      try visitor.visitSingularUInt64Field(value: self.voluntaryContextSwitches, fieldNumber: 6)
+    }
+    if self.involuntaryContextSwitches != 0 {
+      try visitor.visitSingularUInt64Field(value: self.involuntaryContextSwitches, fieldNumber: 7)
+    }
+    if self.blockInputOps != 0 {
+      try visitor.visitSingularUInt64Field(value: self.blockInputOps, fieldNumber: 8)
+    }
+    if self.blockOutputOps != 0 {
+      try visitor.visitSingularUInt64Field(value: self.blockOutputOps, fieldNumber: 9)
+    }
+    try unknownFields.traverse(visitor: &visitor)
+  }
+
+  public static func ==(lhs: Com_Apple_Containerization_Sandbox_V3_ResourceUsage, rhs: Com_Apple_Containerization_Sandbox_V3_ResourceUsage) -> Bool {
+    if lhs.userTimeUsec != rhs.userTimeUsec {return false}
+    if lhs.systemTimeUsec != rhs.systemTimeUsec {return false}
+    if lhs.maxRssBytes != rhs.maxRssBytes {return false}
+    if lhs.minorPageFaults != rhs.minorPageFaults {return false}
+    if lhs.majorPageFaults != rhs.majorPageFaults {return false}
+    if lhs.voluntaryContextSwitches != rhs.voluntaryContextSwitches {return false}
+    if lhs.involuntaryContextSwitches != rhs.involuntaryContextSwitches {return false}
+    if lhs.blockInputOps != rhs.blockInputOps {return false}
+    if lhs.blockOutputOps != rhs.blockOutputOps {return false}
     if lhs.unknownFields != rhs.unknownFields {return false}
     return true
   }
@@ -3850,7 +4152,7 @@ nonisolated extension Com_Apple_Containerization_Sandbox_V3_IpRouteAddDefaultRes
 
 nonisolated extension Com_Apple_Containerization_Sandbox_V3_ConfigureDnsRequest: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
   public static let protoMessageName: String = _protobuf_package + ".ConfigureDnsRequest"
-  public static let _protobuf_nameMap = SwiftProtobuf._NameMap(bytecode: "\0\u{1}location\0\u{1}nameservers\0\u{1}domain\0\u{1}searchDomains\0\u{1}options\0")
+  public static let _protobuf_nameMap = SwiftProtobuf._NameMap(bytecode: "\0\u{1}location\0\u{1}nameservers\0\u{1}domain\0\u{1}searchDomains\0\u{1}options\0\u{1}localCache\0")
 
   public mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
     while let fieldNumber = try decoder.nextFieldNumber() {
@@ -3863,6 +4165,7 @@ nonisolated extension Com_Apple_Containerization_Sandbox_V3_ConfigureDnsRequest:
       case 3: try { try decoder.decodeSingularStringField(value: &self._domain) }()
       case 4: try { try decoder.decodeRepeatedStringField(value: &self.searchDomains) }()
       case 5: try { try decoder.decodeRepeatedStringField(value: &self.options) }()
+      case 6: try { try decoder.decodeSingularBoolField(value: &self.localCache) }()
       default: break
       }
     }
@@ -3888,6 +4191,9 @@ nonisolated extension Com_Apple_Containerization_Sandbox_V3_ConfigureDnsRequest:
     if !self.options.isEmpty {
       try visitor.visitRepeatedStringField(value: self.options, fieldNumber: 5)
     }
+    if self.localCache != false {
+      try visitor.visitSingularBoolField(value: self.localCache, fieldNumber: 6)
+    }
     try unknownFields.traverse(visitor: &visitor)
   }
 
@@ -3897,6 +4203,7 @@ nonisolated extension Com_Apple_Containerization_Sandbox_V3_ConfigureDnsRequest:
     if lhs._domain != rhs._domain {return false}
     if lhs.searchDomains != rhs.searchDomains {return false}
     if lhs.options != rhs.options {return false}
+    if lhs.localCache != rhs.localCache {return false}
     if lhs.unknownFields != rhs.unknownFields {return false}
     return true
   }
@@ -4028,6 +4335,120 @@ nonisolated extension Com_Apple_Containerization_Sandbox_V3_ConfigureHostsRespon
   }
 }
 
+nonisolated extension Com_Apple_Containerization_Sandbox_V3_BootTraceRequest: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
+  public static let protoMessageName: String = _protobuf_package + ".BootTraceRequest"
+  public static let _protobuf_nameMap = SwiftProtobuf._NameMap(bytecode: "\0\u{3}container_id\0\u{1}reset\0")
+
+  public mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
+    while let fieldNumber = try decoder.nextFieldNumber() {
+      // The use of inline closures is to circumvent an issue where the compiler
+      // allocates stack space for every case branch when no optimizations are
+      // enabled. https://github.com/apple/swift-protobuf/issues/1034
+      switch fieldNumber {
+      case 1: try { try decoder.decodeSingularStringField(value: &self.containerID) }()
+      case 2: try { try decoder.decodeSingularBoolField(value: &self.reset) }()
+      default: break
+      }
+    }
+  }
+
+  public func traverse<V: SwiftProtobuf.Visitor>(visitor: inout V) throws {
+    if !self.containerID.isEmpty {
+      try visitor.visitSingularStringField(value: self.containerID, fieldNumber: 1)
+    }
+    if self.reset != false {
+      try visitor.visitSingularBoolField(value: self.reset, fieldNumber: 2)
+    }
+    try unknownFields.traverse(visitor: &visitor)
+  }
+
+  public static func ==(lhs: Com_Apple_Containerization_Sandbox_V3_BootTraceRequest, rhs: Com_Apple_Containerization_Sandbox_V3_BootTraceRequest) -> Bool {
+    if lhs.containerID != rhs.containerID {return false}
+    if lhs.reset != rhs.reset {return false}
+    if lhs.unknownFields != rhs.unknownFields {return false}
+    return true
+  }
+}
+
+nonisolated extension Com_Apple_Containerization_Sandbox_V3_BootTraceResponse: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
+  public static let protoMessageName: String = _protobuf_package + ".BootTraceResponse"
+  public static let _protobuf_nameMap = SwiftProtobuf._NameMap(bytecode: "\0\u{1}trace\0")
+
+  public mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
+    while let fieldNumber = try decoder.nextFieldNumber() {
+      // The use of inline closures is to circumvent an issue where the compiler
+      // allocates stack space for every case branch when no optimizations are
+      // enabled. https://github.com/apple/swift-protobuf/issues/1034
+      switch fieldNumber {
+      case 1: try { try decoder.decodeSingularBytesField(value: &self.trace) }()
+      default: break
+      }
+    }
+  }
+
+  public func traverse<V: SwiftProtobuf.Visitor>(visitor: inout V) throws {
+    if !self.trace.isEmpty {
+      try visitor.visitSingularBytesField(value: self.trace, fieldNumber: 1)
+    }
+    try unknownFields.traverse(visitor: &visitor)
+  }
+
+  public static func ==(lhs: Com_Apple_Containerization_Sandbox_V3_BootTraceResponse, rhs: Com_Apple_Containerization_Sandbox_V3_BootTraceResponse) -> Bool {
+    if lhs.trace != rhs.trace {return false}
+    if lhs.unknownFields != rhs.unknownFields {return false}
+    return true
+  }
+}
+
+nonisolated extension Com_Apple_Containerization_Sandbox_V3_ReseedRequest: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
+  public static let protoMessageName: String = _protobuf_package + ".ReseedRequest"
+  public static let _protobuf_nameMap = SwiftProtobuf._NameMap(bytecode: "\0\u{1}entropy\0")
+
+  public mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
+    while let fieldNumber = try decoder.nextFieldNumber() {
+      // The use of inline closures is to circumvent an issue where the compiler
+      // allocates stack space for every case branch when no optimizations are
+      // enabled. https://github.com/apple/swift-protobuf/issues/1034
+      switch fieldNumber {
+      case 1: try { try decoder.decodeSingularBytesField(value: &self.entropy) }()
+      default: break
+      }
+    }
+  }
+
+  public func traverse<V: SwiftProtobuf.Visitor>(visitor: inout V) throws {
+    if !self.entropy.isEmpty {
+      try visitor.visitSingularBytesField(value: self.entropy, fieldNumber: 1)
+    }
+    try unknownFields.traverse(visitor: &visitor)
+  }
+
+  public static func ==(lhs: Com_Apple_Containerization_Sandbox_V3_ReseedRequest, rhs: Com_Apple_Containerization_Sandbox_V3_ReseedRequest) -> Bool {
+    if lhs.entropy != rhs.entropy {return false}
+    if lhs.unknownFields != rhs.unknownFields {return false}
+    return true
+  }
+}
+
+nonisolated extension Com_Apple_Containerization_Sandbox_V3_ReseedResponse: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
+  public static let protoMessageName: String = _protobuf_package + ".ReseedResponse"
+  public static let _protobuf_nameMap = SwiftProtobuf._NameMap()
+
+  public mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
+    // Load everything into unknown fields
+    while try decoder.nextFieldNumber() != nil {}
+  }
+
+  public func traverse<V: SwiftProtobuf.Visitor>(visitor: inout V) throws {
+    try unknownFields.traverse(visitor: &visitor)
+  }
+
+  public static func ==(lhs: Com_Apple_Containerization_Sandbox_V3_ReseedResponse, rhs: Com_Apple_Containerization_Sandbox_V3_ReseedResponse) -> Bool {
+    if lhs.unknownFields != rhs.unknownFields {return false}
+    return true
+  }
+}
+
 nonisolated extension Com_Apple_Containerization_Sandbox_V3_SyncRequest: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
   public static let protoMessageName: String = _protobuf_package + ".SyncRequest"
   public static let _protobuf_nameMap = SwiftProtobuf._NameMap()
@@ -40,6 +40,11 @@ let osClose = Glibc.close
 /// device automatically. Cloud-hypervisor opens the same TAP **by name**;
 /// the held fd keeps the interface alive across CH's open/close cycle.
 ///
+/// With `queuePairs` > 1 the device is multi-queue with virtio-net headers
+/// and offloads enabled, so cloud-hypervisor can attach one queue per pair
+/// and spread packet processing across vCPUs. The held fd's own queue is
+/// detached and never receives traffic.
+///
 /// Requires `CAP_NET_ADMIN`.
 public final class TAPDevice: Sendable {
     /// The kernel-resolved interface name. May differ from the `name`
@@ -49,6 +54,9 @@ public final class TAPDevice: Sendable {
 
     public let mtu: UInt32
 
+    /// Number of RX/TX queue pairs the device was created for.
+    public let queuePairs: Int
+
     /// The MAC address as set on init, or nil if the kernel auto-assigned one.
     /// Not read back from the kernel.
     public let macAddress: MACAddress?
@@ -63,11 +71,14 @@ public final class TAPDevice: Sendable {
     ///   - bridge: Name of an existing bridge to enslave the TAP to, or nil.
     ///   - mtu: MTU in bytes (default 1500).
     ///   - macAddress: Hardware address to set, or nil to leave kernel default.
+    ///   - queuePairs: Number of RX/TX queue pairs the VMM will open. Must
+    ///     match the VMM's configuration (see `TAPInterface.queuePairs`).
     public init(
         name: String? = nil,
         bridge: String? = nil,
         mtu: UInt32 = 1500,
-        macAddress: MACAddress? = nil
+        macAddress: MACAddress? = nil,
+        queuePairs: Int = 1
     ) throws {
         if let n = name, n.utf8.count >= 16 {
             throw ContainerizationError(
@@ -75,12 +86,18 @@ public final class TAPDevice: Sendable {
                 message: "TAP name too long: \(n) (must be < 16 chars)"
             )
         }
+        guard queuePairs >= 1 else {
+            throw ContainerizationError(
+                .invalidArgument,
+                message: "invalid queuePairs for TAP: \(queuePairs)"
+            )
+        }
 
         // 1. Open + TUNSETIFF via CShim. Returns fd on success, -errno on failure.
         var resolved = [CChar](repeating: 0, count: 16)
         let fd: Int32 = resolved.withUnsafeMutableBufferPointer { buf in
             (name ?? "").withCString { reqPtr in
-                cz_tap_create(reqPtr, buf.baseAddress, 16)
+                cz_tap_create(reqPtr, queuePairs > 1 ? 1 : 0, buf.baseAddress, 16)
             }
         }
         guard fd >= 0 else {
@@ -105,39 +122,47 @@ public final class TAPDevice: Sendable {
             return String(decoding: bytes, as: UTF8.self)
         }
 
-        // 2. Apply MAC and master via netlink (single RTM_NEWLINK).
+        // 2. Apply MAC and master, then bring UP and set MTU, in one netlink
+        // batch.
         let session = try NetlinkSession(socket: DefaultNetlinkSocket())
         do {
-            try session.linkSetAttributes(
-                interface: resolvedName,
-                macAddress: macAddress,
-                master: bridge
-            )
-        } catch {
-            throw ContainerizationError(
-                .internalError,
-                message: "linkSetAttributes failed for \(resolvedName): \(error)"
-            )
-        }
-
-        // 3. Bring UP and set MTU.
-        do {
-            try session.linkSet(interface: resolvedName, up: true, mtu: mtu)
+            try session.batch {
+                try session.linkSetAttributes(
+                    interface: resolvedName,
+                    macAddress: macAddress,
+                    master: bridge
+                )
+                try session.linkSet(interface: resolvedName, up: true, mtu: mtu)
+            }
         } catch {
             throw ContainerizationError(
                 .internalError,
-                message: "linkSet(up:mtu:) failed for \(resolvedName): \(error)"
+                message: "configuring link \(resolvedName) failed: \(error)"
             )
         }
 
-        // 4. Success — store and clear cleanup.
+        // 3. Success — store and clear cleanup.
         self.name = resolvedName
         self.mtu = mtu
+        self.queuePairs = queuePairs
         self.macAddress = macAddress
         self._fd = Mutex(fd)
         fdToClean = nil
     }
 
+    /// Attach one more queue to the device, the way the VMM does when it
+    /// opens the TAP by name. The caller owns the returned fd.
+    func openQueue() throws -> Int32 {
+        let fd = cz_tap_open_queue(name, queuePairs > 1 ? 1 : 0)
+        guard fd >= 0 else {
+            throw ContainerizationError(
+                .internalError,
+                message: "cz_tap_open_queue failed for \(name): errno=\(-fd)"
+            )
+        }
+        return fd
+    }
+
     /// Close the held fd, removing the interface from the kernel. Idempotent.
     public func close() {
         _fd.withLock { fd in
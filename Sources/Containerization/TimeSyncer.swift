@@ -47,15 +47,7 @@ actor TimeSyncer {
                         continue
                     }
 
-                    var timeval = timeval()
-                    guard gettimeofday(&timeval, nil) == 0 else {
-                        throw POSIXError.fromErrno()
-                    }
-
-                    try await context.setTime(
-                        sec: Int64(timeval.tv_sec),
-                        usec: Int32(timeval.tv_usec)
-                    )
+                    try await Self.sync(context)
                 } catch {
                     self.logger?.error("failed to sync time with guest agent: \(error)")
                 }
@@ -63,6 +55,21 @@ actor TimeSyncer {
         }
     }
 
+    /// Push the host's wall-clock time to the guest once. Used by the
+    /// periodic loop, and directly after a snapshot restore where the guest
+    /// clock is frozen at the moment the snapshot was taken.
+    static func sync(_ context: Vminitd) async throws {
+        var timeval = timeval()
+        guard gettimeofday(&timeval, nil) == 0 else {
+            throw POSIXError.fromErrno()
+        }
+
+        try await context.setTime(
+            sec: Int64(timeval.tv_sec),
+            usec: Int32(timeval.tv_usec)
+        )
+    }
+
     func pause() async {
         self.paused = true
     }
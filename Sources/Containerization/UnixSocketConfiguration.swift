@@ -48,6 +48,12 @@ public struct UnixSocketConfiguration: Sendable {
     /// onto your host.
     public var direction: Direction
 
+    /// Number of vsock connections into the guest to keep dialed ahead of time
+    /// for direction .outOf, so a new host connection skips the host to guest
+    /// connection setup. Each idle connection also holds a connection to the
+    /// guest socket. 0 dials on demand.
+    public var poolSize: Int
+
     /// Type that denotes the direction of the unix socket relay.
     public enum Direction: Sendable {
         /// Share the socket into the container/guest.
@@ -60,11 +66,13 @@ public struct UnixSocketConfiguration: Sendable {
         source: URL,
         destination: URL,
         permissions: FilePermissions? = nil,
-        direction: Direction = .into
+        direction: Direction = .into,
+        poolSize: Int = 0
     ) {
         self.source = source
         self.destination = destination
         self.permissions = permissions
         self.direction = direction
+        self.poolSize = poolSize
     }
 }
@@ -26,6 +26,7 @@ package final class UnixSocketRelay: Sendable {
     private let configuration: UnixSocketConfiguration
     private let vm: any VirtualMachineInstance
     private let log: Logger?
+    private let pool: VsockChannelPool?
     private let state: Mutex<State>
 
     private struct State {
@@ -44,6 +45,13 @@ package final class UnixSocketRelay: Sendable {
         self.configuration = socket
         self.vm = vm
         self.log = log
+        if socket.direction == .outOf && socket.poolSize > 0 {
+            self.pool = VsockChannelPool(config: .init(size: socket.poolSize), logger: log) {
+                try await vm.dial(port)
+            }
+        } else {
+            self.pool = nil
+        }
         self.state = Mutex<State>(.init())
     }
 
@@ -86,6 +94,9 @@ extension UnixSocketRelay {
                 try $0.listener?.finish()
             }
         }
+        if let pool {
+            Task { await pool.shutdown() }
+        }
     }
 
     private func setupHostVsockDial() async throws {
@@ -162,7 +173,12 @@ extension UnixSocketRelay {
         log: Logger?
     ) async throws {
         do {
-            let guestConn = try await vm.dial(port)
+            let guestConn: FileHandle
+            if let pooled = await pool?.take() {
+                guestConn = pooled
+            } else {
+                guestConn = try await vm.dial(port)
+            }
             log?.debug(
                 "initiating connection from host to guest",
                 metadata: [
@@ -21,11 +21,13 @@ import Logging
 package actor UnixSocketRelayManager {
     private let vm: any VirtualMachineInstance
     private var relays: [String: UnixSocketRelay]
+    private var forwarders: [String: PortForwarder]
     private let log: Logger?
 
     init(vm: any VirtualMachineInstance, log: Logger? = nil) {
         self.vm = vm
         self.relays = [:]
+        self.forwarders = [:]
         self.log = log
     }
 }
@@ -65,9 +67,44 @@ extension UnixSocketRelayManager {
         try storedRelay.stop()
     }
 
+    func startForward(port: UInt32, configuration: PortForwardConfiguration) throws {
+        guard forwarders[configuration.id] == nil else {
+            throw ContainerizationError(
+                .invalidState,
+                message: "port forward \(configuration.id) already started"
+            )
+        }
+
+        let forwarder = PortForwarder(
+            port: port,
+            configuration: configuration,
+            vm: vm,
+            log: log
+        )
+        try forwarder.start()
+        forwarders[configuration.id] = forwarder
+    }
+
+    func stopForward(configuration: PortForwardConfiguration) throws {
+        guard let forwarder = forwarders.removeValue(forKey: configuration.id) else {
+            throw ContainerizationError(
+                .notFound,
+                message: "failed to stop port forward"
+            )
+        }
+        try forwarder.stop()
+    }
+
+    func forwardStatistics() -> [PortForwardStatistics] {
+        forwarders.values.map { $0.statistics() }
+    }
+
     func stopAll() async throws {
         for (_, relay) in relays {
             try relay.stop()
         }
+        for (_, forwarder) in forwarders {
+            try forwarder.stop()
+        }
     }
 }
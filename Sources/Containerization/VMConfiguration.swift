@@ -48,6 +48,32 @@ public struct BootLog: Sendable {
     }
 }
 
+/// How guest RAM is backed on the host.
+public struct MemoryBacking: Sendable, Equatable {
+    /// Host page sizes usable for hugepage-backed guest memory.
+    public enum HugepageSize: UInt64, Sendable {
+        case twoMiB = 2_097_152
+        case oneGiB = 1_073_741_824
+    }
+
+    /// The hugepage size backing guest RAM, or nil for regular host pages.
+    public var hugepageSize: HugepageSize?
+    /// Populate all guest RAM before the guest starts instead of faulting
+    /// pages in on first touch.
+    public var prefault: Bool
+
+    /// Regular host pages, faulted in on demand.
+    public static let standard = MemoryBacking(hugepageSize: nil, prefault: false)
+
+    /// Back guest RAM with hugepages of `size` from the host's pool. VMMs
+    /// that can't satisfy the request fall back to ``standard``; check the
+    /// instance's ``VirtualMachineInstance/memoryBacking`` for the backing
+    /// actually in use.
+    public static func hugepages(_ size: HugepageSize = .twoMiB, prefault: Bool = false) -> MemoryBacking {
+        MemoryBacking(hugepageSize: size, prefault: prefault)
+    }
+}
+
 /// Protocol for VM creation configuration. Allows VMMs to extend with specific settings
 /// while maintaining a common core configuration.
 public protocol VMCreationConfig: Sendable {
@@ -77,6 +103,11 @@ public struct VMConfiguration: Sendable {
     public var mountsByID: [String: [Mount]]
     /// Optional destination for serial boot logs.
     public var bootLog: BootLog?
+    /// Optional recorder for VMM boot-phase spans. VMMs that don't
+    /// support tracing ignore it.
+    public var bootTrace: BootTraceRecorder?
+    /// Host backing for guest RAM. VMMs without hugepage support ignore it.
+    public var memoryBacking: MemoryBacking = .standard
     /// Enable nested virtualization support. If the VirtualMachineManager
     /// does not support this feature, it MUST return an .unsupported ContainerizationError.
     public var nestedVirtualization: Bool
@@ -329,6 +329,10 @@ extension VZVirtualMachineInstance: VirtualMachineInstance {
         try hotplugProvider.registerMounts(id: id, rootfs: rootfs, additionalMounts: additionalMounts)
     }
 
+    public func unregisterMounts(id: String) {
+        hotplugProvider?.unregisterMounts(id: id)
+    }
+
     public func releaseHotplug(id: String) async throws {
         guard let hotplugProvider else { return }
         try await hotplugProvider.releaseHotplug(id: id)
@@ -40,6 +40,22 @@ final class VirtiofsdProcess: Sendable {
         let socketPath: URL
         let sharedDir: URL
         let readonly: Bool
+        /// `--cache` policy; virtiofsd's default when `nil`.
+        var cache: VirtiofsProfile.CacheMode? = nil
+        /// Pass `--writeback`.
+        var writeback: Bool = false
+        /// `--thread-pool-size`; virtiofsd's default when `nil`.
+        var threadPoolSize: Int? = nil
+
+        init(binary: URL, socketPath: URL, sharedDir: URL, readonly: Bool, profile: VirtiofsProfile = .init()) {
+            self.binary = binary
+            self.socketPath = socketPath
+            self.sharedDir = sharedDir
+            self.readonly = readonly
+            self.cache = profile.cache
+            self.writeback = profile.writeback
+            self.threadPoolSize = profile.threadPoolSize
+        }
     }
 
     private struct State {
@@ -80,6 +96,15 @@ final class VirtiofsdProcess: Sendable {
         if config.readonly {
             arguments.append("--readonly")
         }
+        if let cache = config.cache {
+            arguments.append(contentsOf: ["--cache", cache.rawValue])
+        }
+        if config.writeback {
+            arguments.append("--writeback")
+        }
+        if let threadPoolSize = config.threadPoolSize {
+            arguments.append(contentsOf: ["--thread-pool-size", "\(threadPoolSize)"])
+        }
 
         var command = Command(
             config.binary.path,
@@ -101,7 +126,7 @@ final class VirtiofsdProcess: Sendable {
 
         let exitTask = Task<Void, Never>.detached { [command, logger] in
             do {
-                _ = try command.wait()
+                _ = try await command.waitForExit()
             } catch {
                 logger?.error("virtiofsd wait failed: \(error)")
             }
@@ -15,8 +15,10 @@
 //===----------------------------------------------------------------------===//
 
 /// Protocol to conform to if your agent is capable of relaying unix domain socket
-/// connections.
+/// connections and forwarding TCP/UDP ports over vsock.
 public protocol SocketRelayAgent {
     func relaySocket(port: UInt32, configuration: UnixSocketConfiguration) async throws
     func stopSocketRelay(configuration: UnixSocketConfiguration) async throws
+    func forwardPort(port: UInt32, configuration: PortForwardConfiguration) async throws
+    func stopPortForward(configuration: PortForwardConfiguration) async throws
 }
@@ -47,6 +47,9 @@ public protocol VirtualMachineAgent: Sendable {
     func getenv(key: String) async throws -> String
     func setenv(key: String, value: String) async throws
     func mount(_ mount: ContainerizationOCI.Mount) async throws
+    /// Mount several filesystems, waiting for any hot-plugged devices among
+    /// them together and mounting them concurrently.
+    func mount(_ mounts: [ContainerizationOCI.Mount]) async throws
     func umount(path: String, flags: Int32) async throws
     func mkdir(path: String, all: Bool, perms: UInt32) async throws
     @discardableResult
@@ -107,4 +110,10 @@ extension VirtualMachineAgent {
         throw ContainerizationError(.unsupported, message: "sync")
     }
 
+    public func mount(_ mounts: [ContainerizationOCI.Mount]) async throws {
+        for mount in mounts {
+            try await self.mount(mount)
+        }
+    }
+
 }
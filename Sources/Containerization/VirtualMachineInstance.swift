@@ -49,6 +49,10 @@ public protocol VirtualMachineInstance: Sendable {
     /// How this VMM exposes virtiofs devices to the guest. Defaults to
     /// `.unified` (the VZ-shaped behavior); CH overrides to `.perTag`.
     var virtiofsLayout: VirtiofsLayout { get }
+    /// The host backing of guest RAM actually in use. May differ from the
+    /// requested ``VMConfiguration/memoryBacking`` if the host couldn't
+    /// provide it. Defaults to `.standard`.
+    var memoryBacking: MemoryBacking { get }
     /// Dial the Agent. It's up the VirtualMachineInstance to determine
     /// what port the agent is listening on.
     func dialAgent() async throws -> Agent
@@ -72,6 +76,13 @@ public protocol VirtualMachineInstance: Sendable {
     /// - Returns: AttachedFilesystem with the device path in the guest
     func hotplug(_ block: Mount, id: String) async throws -> AttachedFilesystem
 
+    /// Hotplug the root filesystems of several containers at once.
+    /// VMMs that support it submit the devices concurrently; if any device
+    /// fails, the ones already attached are released before rethrowing.
+    /// - Parameter rootfs: The mount to hotplug for each container ID
+    /// - Returns: The attached filesystem for each container ID
+    func hotplug(_ rootfs: [String: Mount]) async throws -> [String: AttachedFilesystem]
+
     /// Register mounts for a container after hotplug.
     /// This is used to add the rootfs and additional mounts to the VM's mount registry
     /// so they can be found when building the container's OCI spec.
@@ -80,6 +91,11 @@ public protocol VirtualMachineInstance: Sendable {
     /// - Parameter additionalMounts: Additional mounts (like /proc, /sys) to register
     func registerMounts(id: String, rootfs: AttachedFilesystem, additionalMounts: [Mount]) throws
 
+    /// Remove every mount registered for a container, undoing
+    /// `registerMounts` when a hotplugged container fails to set up.
+    /// - Parameter id: The container ID
+    func unregisterMounts(id: String)
+
     /// Release a hotplug device.
     /// This should be called when a hotplugged container is stopped or fails to start.
     /// - Parameter id: The container ID whose hotplug should be released
@@ -97,6 +113,7 @@ public protocol VirtualMachineInstance: Sendable {
 
 extension VirtualMachineInstance {
     public var virtiofsLayout: VirtiofsLayout { .unified }
+    public var memoryBacking: MemoryBacking { .standard }
     public func pause() async throws {
         throw ContainerizationError(.unsupported, message: "pause")
     }
@@ -106,9 +123,27 @@ extension VirtualMachineInstance {
     public func hotplug(_ block: Mount, id: String) async throws -> AttachedFilesystem {
         throw ContainerizationError(.unsupported, message: "hotplug not supported")
     }
+    public func hotplug(_ rootfs: [String: Mount]) async throws -> [String: AttachedFilesystem] {
+        var attached: [String: AttachedFilesystem] = [:]
+        do {
+            for (id, mount) in rootfs {
+                attached[id] = try await self.hotplug(mount, id: id)
+            }
+        } catch {
+            for id in attached.keys {
+                try? await self.releaseHotplug(id: id)
+                try? await self.releaseVirtioFS(id: id)
+            }
+            throw error
+        }
+        return attached
+    }
     public func registerMounts(id: String, rootfs: AttachedFilesystem, additionalMounts: [Mount]) throws {
         // no-op default
     }
+    public func unregisterMounts(id: String) {
+        // no-op default
+    }
     public func releaseHotplug(id: String) async throws {
         // no-op default
     }
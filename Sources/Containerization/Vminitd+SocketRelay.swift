@@ -44,4 +44,30 @@ extension Vminitd: SocketRelayAgent {
         }
         _ = try await client.stopVsockProxy(request)
     }
+
+    /// Has the guest accept vsock connections on `port` and connect each to
+    /// the forward's guest port on the loopback address.
+    public func forwardPort(port: UInt32, configuration: PortForwardConfiguration) async throws {
+        let request = Com_Apple_Containerization_Sandbox_V3_ProxyVsockRequest.with {
+            $0.id = configuration.id
+            $0.vsockPort = port
+            $0.action = .outOf
+            $0.guestPort = UInt32(configuration.guestPort)
+            switch configuration.proto {
+            case .tcp:
+                $0.transport = .tcp
+            case .udp:
+                $0.transport = .udp
+            }
+        }
+        _ = try await client.proxyVsock(request)
+    }
+
+    /// Stops the specified port forward in the guest.
+    public func stopPortForward(configuration: PortForwardConfiguration) async throws {
+        let request = Com_Apple_Containerization_Sandbox_V3_StopVsockProxyRequest.with {
+            $0.id = configuration.id
+        }
+        _ = try await client.stopVsockProxy(request)
+    }
 }
@@ -193,6 +193,23 @@ extension Vminitd: VirtualMachineAgent {
             })
     }
 
+    /// Mount several filesystems in the sandbox's environment in one round
+    /// trip. The guest waits for all hot-plugged devices at once and mounts
+    /// them concurrently.
+    public func mount(_ mounts: [ContainerizationOCI.Mount]) async throws {
+        _ = try await client.mountBatch(
+            .with {
+                $0.mounts = mounts.map { mount in
+                    .with {
+                        $0.type = mount.type
+                        $0.source = mount.source
+                        $0.destination = mount.destination
+                        $0.options = mount.options
+                    }
+                }
+            })
+    }
+
     /// Unmount a filesystem in the sandbox's environment.
     public func umount(path: String, flags: Int32) async throws {
         _ = try await client.umount(
@@ -308,7 +325,11 @@ extension Vminitd: VirtualMachineAgent {
 
         do {
             let resp = try await client.waitProcess(request, options: callOpts)
-            return ExitStatus(exitCode: resp.exitCode, exitedAt: resp.exitedAt.date)
+            return ExitStatus(
+                exitCode: resp.exitCode,
+                exitedAt: resp.exitedAt.date,
+                usage: resp.hasUsage ? ResourceUsage(resp.usage) : nil
+            )
         } catch {
             if let err = error as? RPCError, err.code == .deadlineExceeded {
                 throw ContainerizationError(
@@ -470,6 +491,7 @@ extension Vminitd {
                 }
                 $0.searchDomains = config.searchDomains
                 $0.options = config.options
+                $0.localCache = config.localCache
             })
     }
 
@@ -478,6 +500,37 @@ extension Vminitd {
         _ = try await client.configureHosts(config.toAgentHostsRequest(location: location))
     }
 
+    /// Fetch the agent's own boot trace, plus the spans for `containerID` if
+    /// given. Timestamps are on the guest's monotonic clock; see
+    /// ``BootTrace/merging(guest:)``.
+    public func bootTrace(containerID: String? = nil) async throws -> BootTrace {
+        let response = try await client.bootTrace(
+            .with {
+                $0.containerID = containerID ?? ""
+            })
+        return try JSONDecoder().decode(BootTrace.self, from: response.trace)
+    }
+
+    /// Discard the agent's boot trace. Used when taking over a VM that was
+    /// booted for something else, such as a warm-pool VM or a restored
+    /// snapshot template.
+    public func resetBootTrace() async throws {
+        _ = try await client.bootTrace(
+            .with {
+                $0.reset = true
+            })
+    }
+
+    /// Mix `entropy` into the guest's RNG and force it to reseed. Used after
+    /// a snapshot restore, where every clone would otherwise resume with the
+    /// template's RNG state.
+    public func reseed(entropy: Data) async throws {
+        _ = try await client.reseed(
+            .with {
+                $0.entropy = entropy
+            })
+    }
+
     /// Perform a sync call.
     public func sync() async throws {
         _ = try await client.sync(.init())
@@ -644,3 +697,19 @@ extension FilesystemOperation {
         }
     }
 }
+
+extension ResourceUsage {
+    init(_ proto: Com_Apple_Containerization_Sandbox_V3_ResourceUsage) {
+        self.init(
+            userTime: .microseconds(proto.userTimeUsec),
+            systemTime: .microseconds(proto.systemTimeUsec),
+            maxRSSBytes: proto.maxRssBytes,
+            minorPageFaults: proto.minorPageFaults,
+            majorPageFaults: proto.majorPageFaults,
+            voluntaryContextSwitches: proto.voluntaryContextSwitches,
+            involuntaryContextSwitches: proto.involuntaryContextSwitches,
+            blockInputOps: proto.blockInputOps,
+            blockOutputOps: proto.blockOutputOps
+        )
+    }
+}
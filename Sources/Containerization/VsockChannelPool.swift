@@ -0,0 +1,159 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import Logging
+
+#if canImport(Musl)
+import Musl
+#elseif canImport(Glibc)
+import Glibc
+#elseif canImport(Darwin)
+import Darwin
+#endif
+
+/// A pool of vsock connections into the guest that have already been dialed,
+/// so a relayed Unix socket connection does not pay for a host to guest
+/// connection setup before its first byte moves.
+///
+/// Each pooled channel is handed out once and never returned: the relay owns
+/// and closes it like a freshly dialed connection. Taking a channel schedules
+/// a replacement in the background, so the pool warms up on the first
+/// connection rather than before the guest side is listening. Channels are
+/// checked when they are taken; one whose peer hung up, or that sat idle
+/// longer than `maxIdle`, is closed and the next one is tried.
+///
+/// The guest proxy connects to its Unix socket as soon as it accepts a vsock
+/// connection, so every idle channel also holds an idle connection to the
+/// guest server. Keep `size` small for servers that limit connections.
+actor VsockChannelPool {
+    struct Configuration: Sendable {
+        /// Number of idle channels to keep ready.
+        var size: Int
+        /// How long a channel may sit idle before it is discarded rather than
+        /// handed out. Guards against servers that drop idle clients.
+        var maxIdle: Duration
+
+        init(size: Int, maxIdle: Duration = .seconds(30)) {
+            self.size = size
+            self.maxIdle = maxIdle
+        }
+    }
+
+    typealias Dial = @Sendable () async throws -> FileHandle
+
+    private struct Channel {
+        let handle: FileHandle
+        let since: ContinuousClock.Instant
+    }
+
+    private let config: Configuration
+    private let dial: Dial
+    private let logger: Logger?
+    private var idle: [Channel] = []
+    private var dialing = 0
+    private var closed = false
+
+    init(config: Configuration, logger: Logger?, dial: @escaping Dial) {
+        self.config = config
+        self.dial = dial
+        self.logger = logger
+    }
+
+    /// Number of idle channels currently held.
+    var available: Int {
+        idle.count
+    }
+
+    /// Hand out the oldest pooled channel that is still connected and within
+    /// `maxIdle`, closing any stale ones ahead of it. Returns nil if none is
+    /// left, in which case the caller dials directly. Either way the pool is
+    /// topped back up to `size` in the background.
+    func take() -> FileHandle? {
+        defer { replenish() }
+        let now = ContinuousClock.now
+        while !idle.isEmpty {
+            let channel = idle.removeFirst()
+            if now - channel.since <= config.maxIdle && Self.isHealthy(channel.handle.fileDescriptor) {
+                return channel.handle
+            }
+            logger?.debug("discarding pooled vsock channel", metadata: ["fd": "\(channel.handle.fileDescriptor)"])
+            try? channel.handle.close()
+        }
+        return nil
+    }
+
+    /// Close every idle channel and stop replenishing.
+    func shutdown() {
+        closed = true
+        for channel in idle {
+            try? channel.handle.close()
+        }
+        idle.removeAll()
+    }
+
+    /// Reports whether the connected socket `fd` can still carry a new
+    /// connection: the peer has not hung up and has not sent EOF. Bytes the
+    /// peer already sent, such as a server greeting, are left in place.
+    static func isHealthy(_ fd: Int32) -> Bool {
+        var pfd = pollfd(fd: fd, events: Int16(POLLIN), revents: 0)
+        let rc = poll(&pfd, 1, 0)
+        if rc == 0 {
+            return true
+        }
+        guard rc == 1, pfd.revents & Int16(POLLHUP | POLLERR | POLLNVAL) == 0 else {
+            return false
+        }
+        var byte: UInt8 = 0
+        return recv(fd, &byte, 1, Int32(MSG_PEEK | MSG_DONTWAIT)) > 0
+    }
+
+    /// Start enough background dials to bring idle plus in-flight channels
+    /// back up to `size`.
+    private func replenish() {
+        guard !closed else {
+            return
+        }
+        let deficit = config.size - idle.count - dialing
+        guard deficit > 0 else {
+            return
+        }
+        dialing += deficit
+        for _ in 0..<deficit {
+            Task {
+                await self.dialOne()
+            }
+        }
+    }
+
+    private func dialOne() async {
+        defer { dialing -= 1 }
+        do {
+            let handle = try await dial()
+            if closed {
+                try? handle.close()
+                return
+            }
+            idle.append(Channel(handle: handle, since: .now))
+        } catch {
+            // Leave the slot empty. Dialing fails until the guest proxy is
+            // listening and for good once the VM stops, so retrying here would
+            // just hammer the vsock device; the caller's next connection dials
+            // for itself and calls `take`, which refills the pool.
+            logger?.debug("failed to pre-dial vsock channel: \(error)")
+        }
+    }
+}
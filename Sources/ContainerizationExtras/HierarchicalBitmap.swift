@@ -0,0 +1,101 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+/// A fixed-size bitmap that finds its lowest clear bit in O(log₆₄ n) word
+/// operations.
+///
+/// Level 0 holds one bit per index. Each bit of level `k + 1` is set when
+/// the corresponding 64-bit word of level `k` is full, so a search follows
+/// one find-first-clear per level from the single top word down to the
+/// leaf. Bits past `count` are kept set so they are never handed out and
+/// let the last word of each level report full.
+package struct HierarchicalBitmap: Sendable {
+    private static let wordBits = UInt64.bitWidth
+
+    /// Number of addressable bits.
+    package let count: Int
+    /// `levels[0]` is the leaf level; the last level is a single word.
+    private var levels: [[UInt64]]
+
+    /// Create a bitmap of `count` clear bits.
+    package init(count: Int) {
+        precondition(count > 0, "bitmap must have at least one bit")
+        self.count = count
+
+        var levels: [[UInt64]] = []
+        var bits = count
+        repeat {
+            let words = (bits + Self.wordBits - 1) / Self.wordBits
+            var level = [UInt64](repeating: 0, count: words)
+            let tail = bits % Self.wordBits
+            if tail != 0 {
+                level[words - 1] = ~0 << UInt64(tail)
+            }
+            levels.append(level)
+            bits = words
+        } while bits > 1
+        self.levels = levels
+    }
+
+    /// Whether bit `index` is set.
+    package subscript(index: Int) -> Bool {
+        precondition(index >= 0 && index < count, "bitmap index out of range")
+        let (word, bit) = index.quotientAndRemainder(dividingBy: Self.wordBits)
+        return levels[0][word] & (1 << UInt64(bit)) != 0
+    }
+
+    /// The lowest clear bit, or nil if every bit is set.
+    package func firstClear() -> Int? {
+        var index = 0
+        for level in levels.reversed() {
+            let free = ~level[index]
+            guard free != 0 else {
+                return nil
+            }
+            index = index * Self.wordBits + free.trailingZeroBitCount
+        }
+        return index
+    }
+
+    /// Set bit `index`, marking words full up the hierarchy as needed.
+    package mutating func set(_ index: Int) {
+        precondition(index >= 0 && index < count, "bitmap index out of range")
+        var index = index
+        for level in levels.indices {
+            let (word, bit) = index.quotientAndRemainder(dividingBy: Self.wordBits)
+            levels[level][word] |= 1 << UInt64(bit)
+            guard levels[level][word] == ~0 else {
+                return
+            }
+            index = word
+        }
+    }
+
+    /// Clear bit `index`, un-marking words that were full up the hierarchy.
+    package mutating func clear(_ index: Int) {
+        precondition(index >= 0 && index < count, "bitmap index out of range")
+        var index = index
+        for level in levels.indices {
+            let (word, bit) = index.quotientAndRemainder(dividingBy: Self.wordBits)
+            let wasFull = levels[level][word] == ~0
+            levels[level][word] &= ~(1 << UInt64(bit))
+            guard wasFull else {
+                return
+            }
+            index = word
+        }
+    }
+}
@@ -14,7 +14,6 @@
 // limitations under the License.
 //===----------------------------------------------------------------------===//
 
-import Collections
 import Synchronization
 
 /// Maps a network address to an array index value, or nil in the case of a domain error.
@@ -23,9 +22,12 @@ package typealias AddressToIndexTransform<AddressType> = @Sendable (AddressType)
 /// Maps an array index value to a network address, or nil in the case of a domain error.
 package typealias IndexToAddressTransform<AddressType> = @Sendable (Int) -> AddressType?
 
+/// Hands out the lowest free index first. Allocation searches a
+/// ``HierarchicalBitmap``, so it stays cheap on large, nearly-full ranges.
 package final class IndexedAddressAllocator<AddressType: CustomStringConvertible & Sendable>: AddressAllocator {
     private class State {
-        var allocations: BitArray
+        let size: Int
+        var allocations: HierarchicalBitmap
         var enabled: Bool
         var allocationCount: Int
         let addressToIndex: AddressToIndexTransform<AddressType>
@@ -36,7 +38,10 @@ package final class IndexedAddressAllocator<AddressType: CustomStringConvertible
             addressToIndex: @escaping AddressToIndexTransform<AddressType>,
             indexToAddress: @escaping IndexToAddressTransform<AddressType>
         ) {
-            self.allocations = BitArray.init(repeating: false, count: size)
+            self.size = size
+            // The bitmap needs at least one bit; indices at or past `size`
+            // are never handed out, so an empty allocator is simply full.
+            self.allocations = HierarchicalBitmap(count: max(size, 1))
             self.enabled = true
             self.allocationCount = 0
             self.addressToIndex = addressToIndex
@@ -66,7 +71,7 @@ package final class IndexedAddressAllocator<AddressType: CustomStringConvertible
                 throw AllocatorError.allocatorDisabled
             }
 
-            guard let index = state.allocations.firstIndex(of: false) else {
+            guard let index = state.allocations.firstClear(), index < state.size else {
                 throw AllocatorError.allocatorFull
             }
 
@@ -74,7 +79,7 @@ package final class IndexedAddressAllocator<AddressType: CustomStringConvertible
                 throw AllocatorError.invalidIndex(index)
             }
 
-            state.allocations[index] = true
+            state.allocations.set(index)
             state.allocationCount += 1
             return address
         }
@@ -86,7 +91,7 @@ package final class IndexedAddressAllocator<AddressType: CustomStringConvertible
                 throw AllocatorError.allocatorDisabled
             }
 
-            guard let index = state.addressToIndex(address) else {
+            guard let index = state.addressToIndex(address), index < state.size else {
                 throw AllocatorError.invalidAddress(address.description)
             }
 
@@ -94,7 +99,7 @@ package final class IndexedAddressAllocator<AddressType: CustomStringConvertible
                 throw AllocatorError.alreadyAllocated("\(address.description)")
             }
 
-            state.allocations[index] = true
+            state.allocations.set(index)
             state.allocationCount += 1
         }
 
@@ -102,7 +107,7 @@ package final class IndexedAddressAllocator<AddressType: CustomStringConvertible
 
     package func release(_ address: AddressType) throws {
         try self.state.withLock { state in
-            guard let index = state.addressToIndex(address) else {
+            guard let index = state.addressToIndex(address), index < state.size else {
                 throw AllocatorError.invalidAddress(address.description)
             }
 
@@ -110,7 +115,7 @@ package final class IndexedAddressAllocator<AddressType: CustomStringConvertible
                 throw AllocatorError.notAllocated("\(address.description)")
             }
 
-            state.allocations[index] = false
+            state.allocations.clear(index)
             state.allocationCount -= 1
         }
     }
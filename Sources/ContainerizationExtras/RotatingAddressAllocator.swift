@@ -14,13 +14,33 @@
 // limitations under the License.
 //===----------------------------------------------------------------------===//
 
+import Collections
 import Synchronization
 
+/// Hands out indices in ascending order, then reuses released indices in
+/// the order they were released, so a freed address stays unused for as
+/// long as possible.
+///
+/// Never-used indices are handed out from a cursor rather than stored, and
+/// released ones queue in a ring buffer, so allocation and release are
+/// O(1) and a large range costs one bit per index up front.
 package final class RotatingAddressAllocator: AddressAllocator {
     package typealias AddressType = UInt32
 
     private struct State {
-        var allocations: [AddressType]
+        let size: Int
+        /// Indices currently handed out or reserved.
+        var allocated: HierarchicalBitmap
+        /// Indices below `cursor` have been handed out at least once.
+        var cursor: Int
+        /// Indices at or past `cursor` taken by `reserve`, which the cursor
+        /// must skip.
+        var reservedAhead: Set<Int>
+        /// Released indices, oldest first.
+        var released: Deque<UInt32>
+        /// Count of entries in `released` invalidated by `reserve` that
+        /// `allocate` must discard.
+        var stale: [UInt32: Int]
         var enabled: Bool
         var allocationCount: Int
         let addressToIndex: AddressToIndexTransform<AddressType>
@@ -31,12 +51,36 @@ package final class RotatingAddressAllocator: AddressAllocator {
             addressToIndex: @escaping AddressToIndexTransform<AddressType>,
             indexToAddress: @escaping IndexToAddressTransform<AddressType>
         ) {
-            self.allocations = [UInt32](0..<size)
+            self.size = Int(size)
+            self.allocated = HierarchicalBitmap(count: max(Int(size), 1))
+            self.cursor = 0
+            self.reservedAhead = []
+            self.released = []
+            self.stale = [:]
             self.enabled = true
             self.allocationCount = 0
             self.addressToIndex = addressToIndex
             self.indexToAddress = indexToAddress
         }
+
+        /// Remove and return the next index to hand out, if any.
+        mutating func next() -> Int? {
+            while cursor < size {
+                let index = cursor
+                cursor += 1
+                if reservedAhead.remove(index) == nil {
+                    return index
+                }
+            }
+            while let value = released.popFirst() {
+                if let count = stale[value] {
+                    stale[value] = count > 1 ? count - 1 : nil
+                    continue
+                }
+                return Int(value)
+            }
+            return nil
+        }
     }
 
     private let state: Mutex<State>
@@ -61,16 +105,15 @@ package final class RotatingAddressAllocator: AddressAllocator {
                 throw AllocatorError.allocatorDisabled
             }
 
-            guard state.allocations.count > 0 else {
+            guard let index = state.next() else {
                 throw AllocatorError.allocatorFull
             }
 
-            let value = state.allocations.removeFirst()
-
-            guard let address = state.indexToAddress(Int(value)) else {
-                throw AllocatorError.invalidIndex(Int(value))
+            guard let address = state.indexToAddress(index) else {
+                throw AllocatorError.invalidIndex(index)
             }
 
+            state.allocated.set(index)
             state.allocationCount += 1
             return address
         }
@@ -82,32 +125,38 @@ package final class RotatingAddressAllocator: AddressAllocator {
                 throw AllocatorError.allocatorDisabled
             }
 
-            guard let index = state.addressToIndex(address) else {
+            guard let index = state.addressToIndex(address), index < state.size else {
                 throw AllocatorError.invalidAddress(address.description)
             }
 
-            let i = state.allocations.firstIndex(of: UInt32(index))
-            guard let i else {
+            guard !state.allocated[index] else {
                 throw AllocatorError.alreadyAllocated("\(address.description)")
             }
 
-            _ = state.allocations.remove(at: i)
+            // A free index is either still ahead of the cursor or queued in
+            // `released`; take it out of whichever one will hand it out.
+            if index >= state.cursor && !state.reservedAhead.contains(index) {
+                state.reservedAhead.insert(index)
+            } else {
+                state.stale[UInt32(index), default: 0] += 1
+            }
+            state.allocated.set(index)
             state.allocationCount += 1
         }
     }
 
     package func release(_ address: AddressType) throws {
         try self.state.withLock { state in
-            guard let index = (state.addressToIndex(address)) else {
+            guard let index = state.addressToIndex(address), index < state.size else {
                 throw AllocatorError.invalidAddress(address.description)
             }
-            let value = UInt32(index)
 
-            guard !state.allocations.contains(value) else {
+            guard state.allocated[index] else {
                 throw AllocatorError.notAllocated("\(address.description)")
             }
 
-            state.allocations.append(value)
+            state.allocated.clear(index)
+            state.released.append(UInt32(index))
             state.allocationCount -= 1
         }
     }
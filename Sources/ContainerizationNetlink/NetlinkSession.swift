@@ -20,11 +20,34 @@ import Logging
 
 /// `NetlinkSession` facilitates interacting with netlink via a provided `NetlinkSocket`. This is
 /// the core high-level type offered to perform actions to the netlink surface in the kernel.
+///
+/// A session caches interface indices by name for its lifetime, so a link
+/// that another process deletes and recreates under the same name is not
+/// noticed. Sessions are meant to be short-lived: create one per unit of
+/// configuration work.
 public struct NetlinkSession {
     private static let receiveDataLength = 65536
     private static let mtu: UInt32 = 1280
+    private static let batchBufferCapacity = 4096
     private let socket: any NetlinkSocket
     private let log: Logger
+    private let state: State
+
+    /// Mutable state shared by copies of a session.
+    private final class State {
+        /// Interface indices resolved so far, by name.
+        var interfaceIndices: [String: Int32] = [:]
+        /// Whether requests are being queued by `batch(_:)`.
+        var batching = false
+        /// Queued requests. The storage is kept between batches.
+        var queue: [UInt8] = []
+        var queuedRequests = 0
+        var nextSequence = UInt32.random(in: 0..<(UInt32.max / 2))
+
+        init() {
+            queue.reserveCapacity(NetlinkSession.batchBufferCapacity)
+        }
+    }
 
     /// Creates a new `NetlinkSession`.
     /// - Parameters:
@@ -33,6 +56,7 @@ public struct NetlinkSession {
     public init(socket: any NetlinkSocket, log: Logger? = nil) {
         self.socket = socket
         self.log = log ?? Logger(label: "com.apple.containerization.netlink")
+        self.state = State()
     }
 
     /// Errors that may occur during netlink interaction.
@@ -63,6 +87,43 @@ public struct NetlinkSession {
         }
     }
 
+    /// Sends every link, address and route change made in `body` as one
+    /// multi-message request and waits for all of the acknowledgements
+    /// together, instead of one round trip per change.
+    ///
+    /// Interface names are resolved while `body` runs, so a batch cannot
+    /// refer to a link that an earlier request in the same batch creates.
+    /// Nothing is sent if `body` throws. The kernel applies the requests in
+    /// order and does not roll back on failure: every request is attempted,
+    /// and the first error is thrown once all have been acknowledged.
+    /// Calling `batch` from inside `body` joins the outer batch.
+    ///
+    ///     try session.batch {
+    ///         try session.addressAdd(interface: "eth0", ipv4Address: address)
+    ///         try session.linkSet(interface: "eth0", up: true, mtu: 1500)
+    ///     }
+    public func batch(_ body: () throws -> Void) throws {
+        guard !state.batching else {
+            try body()
+            return
+        }
+
+        state.batching = true
+        state.queue.removeAll(keepingCapacity: true)
+        state.queuedRequests = 0
+        defer {
+            state.batching = false
+            state.queue.removeAll(keepingCapacity: true)
+        }
+
+        try body()
+        guard state.queuedRequests > 0 else {
+            return
+        }
+        try sendRequest(buffer: &state.queue)
+        try receiveAcknowledgements(count: state.queuedRequests)
+    }
+
     /// Performs a link set command on an interface.
     /// - Parameters:
     ///   - interface: The name of the interface.
@@ -111,11 +172,7 @@ public struct NetlinkSession {
             throw Error.unexpectedOffset(offset: requestOffset, size: requestSize)
         }
 
-        try sendRequest(buffer: &requestBuffer)
-        let (infos, _) = try parseResponse(infoType: NetlinkType.RTM_NEWLINK) { InterfaceInfo() }
-        guard infos.count == 0 else {
-            throw Error.unexpectedResultSet(count: infos.count, expected: 0)
-        }
+        try submit(&requestBuffer, infoType: NetlinkType.RTM_NEWLINK) { InterfaceInfo() }
     }
 
     /// Set link attributes (MAC and/or bridge master) on an existing interface.
@@ -213,11 +270,7 @@ public struct NetlinkSession {
             throw Error.unexpectedOffset(offset: requestOffset, size: requestSize)
         }
 
-        try sendRequest(buffer: &requestBuffer)
-        let (infos, _) = try parseResponse(infoType: NetlinkType.RTM_NEWLINK) { InterfaceInfo() }
-        guard infos.count == 0 else {
-            throw Error.unexpectedResultSet(count: infos.count, expected: 0)
-        }
+        try submit(&requestBuffer, infoType: NetlinkType.RTM_NEWLINK) { InterfaceInfo() }
     }
 
     /// Create a Linux bridge link via `RTM_NEWLINK` carrying
@@ -285,11 +338,7 @@ public struct NetlinkSession {
             throw Error.unexpectedOffset(offset: requestOffset, size: requestSize)
         }
 
-        try sendRequest(buffer: &requestBuffer)
-        let (infos, _) = try parseResponse(infoType: NetlinkType.RTM_NEWLINK) { InterfaceInfo() }
-        guard infos.count == 0 else {
-            throw Error.unexpectedResultSet(count: infos.count, expected: 0)
-        }
+        try submit(&requestBuffer, infoType: NetlinkType.RTM_NEWLINK) { InterfaceInfo() }
     }
 
     /// Remove a link by name via `RTM_DELLINK`.
@@ -320,11 +369,8 @@ public struct NetlinkSession {
             throw Error.unexpectedOffset(offset: requestOffset, size: requestSize)
         }
 
-        try sendRequest(buffer: &requestBuffer)
-        let (infos, _) = try parseResponse(infoType: NetlinkType.RTM_DELLINK) { InterfaceInfo() }
-        guard infos.count == 0 else {
-            throw Error.unexpectedResultSet(count: infos.count, expected: 0)
-        }
+        try submit(&requestBuffer, infoType: NetlinkType.RTM_DELLINK) { InterfaceInfo() }
+        state.interfaceIndices[name] = nil
     }
 
     /// Performs a link get command on an interface.
@@ -461,11 +507,7 @@ public struct NetlinkSession {
             throw Error.unexpectedOffset(offset: requestOffset, size: requestSize)
         }
 
-        try sendRequest(buffer: &requestBuffer)
-        let (infos, _) = try parseResponse(infoType: NetlinkType.RTM_NEWADDR) { AddressInfo() }
-        guard infos.count == 0 else {
-            throw Error.unexpectedResultSet(count: infos.count, expected: 0)
-        }
+        try submit(&requestBuffer, infoType: NetlinkType.RTM_NEWADDR) { AddressInfo() }
     }
 
     /// Adds an IPv6 address to an interface.
@@ -508,11 +550,7 @@ public struct NetlinkSession {
             throw Error.unexpectedOffset(offset: requestOffset, size: requestSize)
         }
 
-        try sendRequest(buffer: &requestBuffer)
-        let (infos, _) = try parseResponse(infoType: NetlinkType.RTM_NEWADDR) { AddressInfo() }
-        guard infos.count == 0 else {
-            throw Error.unexpectedResultSet(count: infos.count, expected: 0)
-        }
+        try submit(&requestBuffer, infoType: NetlinkType.RTM_NEWADDR) { AddressInfo() }
     }
 
     /// Adds an IPv4 route to an interface.
@@ -594,11 +632,7 @@ public struct NetlinkSession {
             throw Error.unexpectedOffset(offset: requestOffset, size: requestSize)
         }
 
-        try sendRequest(buffer: &requestBuffer)
-        let (infos, _) = try parseResponse(infoType: NetlinkType.RTM_NEWROUTE) { AddressInfo() }
-        guard infos.count == 0 else {
-            throw Error.unexpectedResultSet(count: infos.count, expected: 0)
-        }
+        try submit(&requestBuffer, infoType: NetlinkType.RTM_NEWROUTE) { AddressInfo() }
     }
 
     /// Adds a default IPv4 route to an interface.
@@ -670,11 +704,7 @@ public struct NetlinkSession {
             throw Error.unexpectedOffset(offset: requestOffset, size: requestSize)
         }
 
-        try sendRequest(buffer: &requestBuffer)
-        let (infos, _) = try parseResponse(infoType: NetlinkType.RTM_NEWROUTE) { AddressInfo() }
-        guard infos.count == 0 else {
-            throw Error.unexpectedResultSet(count: infos.count, expected: 0)
-        }
+        try submit(&requestBuffer, infoType: NetlinkType.RTM_NEWROUTE) { AddressInfo() }
     }
 
     /// Adds an IPv6 route to an interface. Used to install an on-link host
@@ -759,11 +789,7 @@ public struct NetlinkSession {
             throw Error.unexpectedOffset(offset: requestOffset, size: requestSize)
         }
 
-        try sendRequest(buffer: &requestBuffer)
-        let (infos, _) = try parseResponse(infoType: NetlinkType.RTM_NEWROUTE) { AddressInfo() }
-        guard infos.count == 0 else {
-            throw Error.unexpectedResultSet(count: infos.count, expected: 0)
-        }
+        try submit(&requestBuffer, infoType: NetlinkType.RTM_NEWROUTE) { AddressInfo() }
     }
 
     /// Adds a default IPv6 route to an interface.
@@ -824,11 +850,7 @@ public struct NetlinkSession {
             throw Error.unexpectedOffset(offset: requestOffset, size: requestSize)
         }
 
-        try sendRequest(buffer: &requestBuffer)
-        let (infos, _) = try parseResponse(infoType: NetlinkType.RTM_NEWROUTE) { AddressInfo() }
-        guard infos.count == 0 else {
-            throw Error.unexpectedResultSet(count: infos.count, expected: 0)
-        }
+        try submit(&requestBuffer, infoType: NetlinkType.RTM_NEWROUTE) { AddressInfo() }
     }
 
     private func getInterfaceName(_ interface: String) throws -> [UInt8] {
@@ -847,12 +869,84 @@ public struct NetlinkSession {
     }
 
     private func getInterfaceIndex(_ interface: String) throws -> Int32 {
+        if let index = state.interfaceIndices[interface] {
+            return index
+        }
+
         let linkResponses = try linkGet(interface: interface)
         guard linkResponses.count == 1 else {
             throw Error.unexpectedResultSet(count: linkResponses.count, expected: 1)
         }
 
-        return linkResponses[0].interfaceIndex
+        let index = linkResponses[0].interfaceIndex
+        state.interfaceIndices[interface] = index
+        return index
+    }
+
+    /// Sends a request that expects only an acknowledgement, or queues it
+    /// when called inside `batch(_:)`.
+    private func submit<T: Bindable>(
+        _ requestBuffer: inout [UInt8],
+        infoType: UInt16,
+        _ infoProvider: () -> T
+    ) throws {
+        if state.batching {
+            let seq = state.nextSequence
+            state.nextSequence &+= 1
+            guard requestBuffer.copyIn(as: UInt32.self, value: seq, offset: 8) != nil else {
+                throw BindError.sendMarshalFailure(type: "NetlinkMessageHeader", field: "seq")
+            }
+            state.queue.append(contentsOf: requestBuffer)
+            state.queuedRequests += 1
+            return
+        }
+
+        try sendRequest(buffer: &requestBuffer)
+        let (infos, _) = try parseResponse(infoType: infoType, infoProvider)
+        guard infos.count == 0 else {
+            throw Error.unexpectedResultSet(count: infos.count, expected: 0)
+        }
+    }
+
+    /// Collects one `NLMSG_ERROR` acknowledgement per batched request,
+    /// draining all of them before reporting the first failure.
+    private func receiveAcknowledgements(count: Int) throws {
+        var firstError: Int32? = nil
+        var acknowledged = 0
+        while acknowledged < count {
+            var (buffer, size) = try receiveResponse()
+            var offset = 0
+
+            while offset < size {
+                let messageStart = offset
+                var header = NetlinkMessageHeader()
+                offset = try header.bindBuffer(&buffer, offset: offset)
+                guard header.len >= NetlinkMessageHeader.size else {
+                    throw Error.unexpectedOffset(offset: messageStart, size: size)
+                }
+
+                switch header.type {
+                case NetlinkType.NLMSG_ERROR:
+                    let rc: Int32
+                    (rc, offset) = try parseErrorCode(buffer: &buffer, offset: offset)
+                    if rc != 0 && firstError == nil {
+                        log.debug("batched request \(acknowledged) of \(count) failed, rc = \(rc)")
+                        firstError = rc
+                    }
+                    acknowledged += 1
+                case NetlinkType.NLMSG_NOOP:
+                    break
+                default:
+                    throw Error.unexpectedInfo(type: header.type)
+                }
+
+                offset = messageStart + ((Int(header.len) + 3) & ~3)
+            }
+        }
+
+        if let firstError {
+            throw NetlinkDataError.responseError(rc: firstError)
+        }
     }
 
     private func sendRequest(buffer: inout [UInt8]) throws {
@@ -71,10 +71,19 @@ public class DefaultNetlinkSocket: NetlinkSocket {
     /// The process identifier of the process creating this socket.
     public let pid: UInt32
 
-    /// Creates a new instance.
-    public init() throws {
+    /// Creates a new `NETLINK_ROUTE` socket.
+    public convenience init() throws {
+        try self.init(protocol: NetlinkProtocol.NETLINK_ROUTE)
+    }
+
+    /// Creates a `NETLINK_NETFILTER` socket, for use with `NftablesSession`.
+    public static func netfilter() throws -> DefaultNetlinkSocket {
+        try DefaultNetlinkSocket(protocol: NetlinkNetfilter.NETLINK_NETFILTER)
+    }
+
+    init(protocol netlinkProtocol: Int32) throws {
         pid = UInt32(getpid())
-        sockfd = osSocket(Int32(AddressFamily.AF_NETLINK), SocketType.SOCK_RAW, NetlinkProtocol.NETLINK_ROUTE)
+        sockfd = osSocket(Int32(AddressFamily.AF_NETLINK), SocketType.SOCK_RAW, netlinkProtocol)
         guard sockfd >= 0 else {
             throw NetlinkSocketError.socketFailure(rc: errno)
         }
@@ -130,6 +139,10 @@ public class DefaultNetlinkSocket: NetlinkSocket {
 
     public init() throws {}
 
+    public static func netfilter() throws -> DefaultNetlinkSocket {
+        try DefaultNetlinkSocket()
+    }
+
     public func send(buf: UnsafeRawPointer!, len: Int, flags: Int32) throws -> Int {
         throw NetlinkSocketError.notImplemented
     }
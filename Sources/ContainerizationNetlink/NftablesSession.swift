@@ -0,0 +1,579 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+import ContainerizationExtras
+import Logging
+
+/// Source NAT and forwarding rules for one bridge, kept in a dedicated
+/// nftables table so they can be replaced or removed as a unit without
+/// touching rules owned by other tools.
+public struct NftablesNATRules: Sendable, Equatable {
+    /// Name of the `ip`-family table holding the rules.
+    public var table: String
+    /// Guest subnet to masquerade.
+    public var subnet: CIDRv4
+    /// Bridge the guests are attached to.
+    public var bridge: String
+    /// Host interface guest traffic leaves through.
+    public var egress: String
+
+    public init(table: String, subnet: CIDRv4, bridge: String, egress: String) {
+        self.table = table
+        self.subnet = subnet
+        self.bridge = bridge
+        self.egress = egress
+    }
+}
+
+/// Programs nftables through `NETLINK_NETFILTER`. Every operation is sent
+/// as one nfnetlink batch, which the kernel applies atomically: either
+/// every message takes effect or none does.
+public struct NftablesSession {
+    private static let receiveDataLength = 65536
+    private let socket: any NetlinkSocket
+    private let log: Logger
+
+    /// Creates a new `NftablesSession`.
+    /// - Parameters:
+    ///   - socket: A `NETLINK_NETFILTER` socket, e.g.
+    ///     ``DefaultNetlinkSocket/netfilter()``.
+    ///   - log: The logger to use. The default value is `nil`.
+    public init(socket: any NetlinkSocket, log: Logger? = nil) {
+        self.socket = socket
+        self.log = log ?? Logger(label: "com.apple.containerization.nftables")
+    }
+
+    /// Replace `rules.table` with a fresh table implementing
+    ///
+    ///     postrouting (nat, srcnat):  ip saddr <subnet> oifname != <bridge> masquerade
+    ///     forward (filter, 0):        iifname <bridge> oifname <egress> accept
+    ///                                 iifname <egress> oifname <bridge> ct state established,related accept
+    ///
+    /// The equivalent of the `iptables` MASQUERADE/FORWARD rules, applied in
+    /// a single batch. Idempotent. The accepts cannot override a drop in
+    /// another table's forward chain; see ``foreignForwardChains(excluding:)``.
+    public func applyNAT(_ rules: NftablesNATRules) throws {
+        var batch = NftablesBatch(pid: socket.pid)
+        batch.replaceTable(rules.table)
+        batch.add(
+            chain: "postrouting", table: rules.table, type: "nat",
+            hook: NftablesHook.NF_INET_POST_ROUTING, priority: NftablesHook.NF_IP_PRI_NAT_SRC)
+        batch.add(
+            chain: "forward", table: rules.table, type: "filter",
+            hook: NftablesHook.NF_INET_FORWARD, priority: NftablesHook.NF_IP_PRI_FILTER)
+
+        let subnet = rules.subnet
+        batch.add(
+            rule: [
+                .payload(base: NftablesPayloadBase.NETWORK_HEADER, offset: 12, length: 4),
+                .bitwise(mask: bigEndianBytes(subnet.prefix.prefixMask32)),
+                .compare(.equal, subnet.lower.bytes),
+                .meta(NftablesMetaKey.OIFNAME),
+                .compare(.notEqual, interfaceName(rules.bridge)),
+                .masquerade,
+            ], chain: "postrouting", table: rules.table)
+        batch.add(
+            rule: [
+                .meta(NftablesMetaKey.IIFNAME),
+                .compare(.equal, interfaceName(rules.bridge)),
+                .meta(NftablesMetaKey.OIFNAME),
+                .compare(.equal, interfaceName(rules.egress)),
+                .accept,
+            ], chain: "forward", table: rules.table)
+        batch.add(
+            rule: [
+                .meta(NftablesMetaKey.IIFNAME),
+                .compare(.equal, interfaceName(rules.egress)),
+                .meta(NftablesMetaKey.OIFNAME),
+                .compare(.equal, interfaceName(rules.bridge)),
+                .conntrackState,
+                .bitwise(mask: hostBytes(NftablesConntrackState.ESTABLISHED | NftablesConntrackState.RELATED)),
+                .compare(.notEqual, hostBytes(UInt32(0))),
+                .accept,
+            ], chain: "forward", table: rules.table)
+        try commit(batch)
+    }
+
+    /// A base chain some other table hooks into IPv4 forwarding.
+    public struct ForwardChain: Sendable, Equatable {
+        public var table: String
+        public var chain: String
+        /// Whether the chain's policy drops what no rule accepts.
+        public var dropsByDefault: Bool
+
+        public init(table: String, chain: String, dropsByDefault: Bool) {
+            self.table = table
+            self.chain = chain
+            self.dropsByDefault = dropsByDefault
+        }
+    }
+
+    /// Base chains on the IPv4 forward hook in `ip` or `inet` tables other
+    /// than `table`, such as iptables-nft's `filter` table (and so Docker's
+    /// `DOCKER-USER`) or firewalld's. Every base chain on a hook gets a
+    /// verdict, so a drop in any of them, by policy or by rule, wins over
+    /// an accept in `table`.
+    public func foreignForwardChains(excluding table: String) throws -> [ForwardChain] {
+        let nfgen: [UInt8] = [0, 0, 0, 0]  // NFPROTO_UNSPEC: every family
+        let header = NetlinkMessageHeader(
+            len: UInt32(NetlinkMessageHeader.size + nfgen.count),
+            type: NetlinkNetfilter.NFNL_SUBSYS_NFTABLES << 8 | NftablesMessageType.GETCHAIN,
+            flags: NetlinkFlags.NLM_F_REQUEST | NetlinkFlags.NLM_F_DUMP,
+            seq: 0,
+            pid: socket.pid)
+        var request = [UInt8](repeating: 0, count: NetlinkMessageHeader.size)
+        _ = try header.appendBuffer(&request, offset: 0)
+        request += nfgen
+        _ = try socket.send(buf: &request, len: request.count, flags: 0)
+
+        var chains: [ForwardChain] = []
+        while true {
+            var response = [UInt8](repeating: 0, count: Self.receiveDataLength)
+            let size = try socket.recv(buf: &response, len: Self.receiveDataLength, flags: 0)
+            var offset = 0
+            while offset + NetlinkMessageHeader.size <= size {
+                var header = NetlinkMessageHeader()
+                let payload = try header.bindBuffer(&response, offset: offset)
+                guard header.len >= NetlinkMessageHeader.size, offset + Int(header.len) <= size else {
+                    throw NetlinkSession.Error.unexpectedOffset(offset: offset, size: size)
+                }
+                let end = offset + Int(header.len)
+                switch header.type {
+                case NetlinkType.NLMSG_DONE:
+                    return chains
+                case NetlinkType.NLMSG_ERROR:
+                    guard let (_, rc) = response.copyOut(as: Int32.self, offset: payload) else {
+                        throw BindError.recvMarshalFailure(type: "NetlinkErrorMessage", field: "error")
+                    }
+                    guard rc == 0 else {
+                        throw NetlinkDataError.responseError(rc: rc)
+                    }
+                case NetlinkNetfilter.NFNL_SUBSYS_NFTABLES << 8 | NftablesMessageType.NEWCHAIN:
+                    // struct nfgenmsg, then the chain's attributes.
+                    let family = response[payload]
+                    guard family == NetlinkNetfilter.NFPROTO_IPV4 || family == NetlinkNetfilter.NFPROTO_INET,
+                        payload + 4 <= end
+                    else {
+                        break
+                    }
+                    let attrs = Self.attributes(response[(payload + 4)..<end])
+                    guard let hook = attrs[NftablesAttribute.CHAIN_HOOK],
+                        Self.attributes(hook)[NftablesAttribute.HOOK_HOOKNUM].flatMap(Self.bigEndianUInt32)
+                            == NftablesHook.NF_INET_FORWARD,
+                        let chainTable = attrs[NftablesAttribute.CHAIN_TABLE].map(Self.string),
+                        chainTable != table
+                    else {
+                        break
+                    }
+                    let policy = attrs[NftablesAttribute.CHAIN_POLICY].flatMap(Self.bigEndianUInt32)
+                    chains.append(
+                        ForwardChain(
+                            table: chainTable,
+                            chain: attrs[NftablesAttribute.CHAIN_NAME].map(Self.string) ?? "",
+                            dropsByDefault: policy == NftablesVerdict.DROP
+                        ))
+                default:
+                    break
+                }
+                offset += (Int(header.len) + 3) & ~3
+            }
+        }
+    }
+
+    /// Delete `table` and every chain and rule in it. A no-op if the table
+    /// does not exist.
+    public func deleteTable(_ table: String) throws {
+        var batch = NftablesBatch(pid: socket.pid)
+        batch.deleteTable(table)
+        try commit(batch)
+    }
+
+    private func commit(_ batch: NftablesBatch) throws {
+        var buffer = batch.finish()
+        log.trace("SEND-LENGTH: \(buffer.count)")
+        log.trace("SEND-DUMP: \(buffer[0..<buffer.count].hexEncodedString())")
+        let sendLength = try socket.send(buf: &buffer, len: buffer.count, flags: 0)
+        if sendLength != buffer.count {
+            log.warning("sent length \(sendLength) not equal to batch length \(buffer.count)")
+        }
+
+        // Every message inside the batch carries NLM_F_ACK; the kernel acks
+        // each one, or replies with the first failure after rolling the
+        // whole batch back.
+        var acked = 0
+        while acked < batch.ackedMessages {
+            var response = [UInt8](repeating: 0, count: Self.receiveDataLength)
+            let size = try socket.recv(buf: &response, len: Self.receiveDataLength, flags: 0)
+            log.trace("RECV-LENGTH: \(size)")
+            var offset = 0
+            while offset + NetlinkMessageHeader.size <= size {
+                var header = NetlinkMessageHeader()
+                let payload = try header.bindBuffer(&response, offset: offset)
+                guard header.len >= NetlinkMessageHeader.size else {
+                    throw NetlinkSession.Error.unexpectedOffset(offset: offset, size: size)
+                }
+                if header.type == NetlinkType.NLMSG_ERROR {
+                    guard let (_, rc) = response.copyOut(as: Int32.self, offset: payload) else {
+                        throw BindError.recvMarshalFailure(type: "NetlinkErrorMessage", field: "error")
+                    }
+                    guard rc == 0 else {
+                        throw NetlinkDataError.responseError(rc: rc)
+                    }
+                    acked += 1
+                }
+                offset += (Int(header.len) + 3) & ~3
+            }
+        }
+    }
+
+    private static func attributes(_ bytes: ArraySlice<UInt8>) -> [UInt16: ArraySlice<UInt8>] {
+        var attributes: [UInt16: ArraySlice<UInt8>] = [:]
+        var offset = bytes.startIndex
+        while offset + RTAttribute.size <= bytes.endIndex {
+            let length = Int(UInt16(bytes[offset]) | UInt16(bytes[offset + 1]) << 8)
+            // Strip NLA_F_NESTED and NLA_F_NET_BYTEORDER.
+            let type = (UInt16(bytes[offset + 2]) | UInt16(bytes[offset + 3]) << 8) & 0x3fff
+            guard length >= RTAttribute.size, offset + length <= bytes.endIndex else {
+                break
+            }
+            attributes[type] = bytes[(offset + RTAttribute.size)..<(offset + length)]
+            offset += (length + 3) & ~3
+        }
+        return attributes
+    }
+
+    private static func bigEndianUInt32(_ bytes: ArraySlice<UInt8>) -> UInt32? {
+        guard bytes.count == 4 else {
+            return nil
+        }
+        return bytes.reduce(UInt32(0)) { $0 << 8 | UInt32($1) }
+    }
+
+    private static func string(_ bytes: ArraySlice<UInt8>) -> String {
+        String(decoding: bytes.prefix { $0 != 0 }, as: UTF8.self)
+    }
+
+    private func interfaceName(_ name: String) -> [UInt8] {
+        // Interface-name registers hold IFNAMSIZ bytes; an exact match
+        // compares the NUL padding too.
+        let bytes = Array(name.utf8.prefix(15))
+        return bytes + [UInt8](repeating: 0, count: 16 - bytes.count)
+    }
+
+    private func bigEndianBytes(_ value: UInt32) -> [UInt8] {
+        withUnsafeBytes(of: value.bigEndian, Array.init)
+    }
+
+    private func hostBytes(_ value: UInt32) -> [UInt8] {
+        withUnsafeBytes(of: value, Array.init)
+    }
+}
+
+// MARK: - nfnetlink encoding
+
+struct NetlinkNetfilter {
+    static let NETLINK_NETFILTER: Int32 = 12
+    static let NFNL_SUBSYS_NFTABLES: UInt16 = 10
+    static let NFNL_MSG_BATCH_BEGIN: UInt16 = 0x10
+    static let NFNL_MSG_BATCH_END: UInt16 = 0x11
+    static let NFPROTO_INET: UInt8 = 1
+    static let NFPROTO_IPV4: UInt8 = 2
+    static let NLA_F_NESTED: UInt16 = 0x8000
+}
+
+struct NftablesMessageType {
+    static let NEWTABLE: UInt16 = 0
+    static let DELTABLE: UInt16 = 2
+    static let NEWCHAIN: UInt16 = 3
+    static let GETCHAIN: UInt16 = 4
+    static let NEWRULE: UInt16 = 6
+}
+
+struct NftablesAttribute {
+    static let TABLE_NAME: UInt16 = 1
+    static let CHAIN_TABLE: UInt16 = 1
+    static let CHAIN_NAME: UInt16 = 3
+    static let CHAIN_HOOK: UInt16 = 4
+    static let CHAIN_POLICY: UInt16 = 5
+    static let CHAIN_TYPE: UInt16 = 7
+    static let HOOK_HOOKNUM: UInt16 = 1
+    static let HOOK_PRIORITY: UInt16 = 2
+    static let RULE_TABLE: UInt16 = 1
+    static let RULE_CHAIN: UInt16 = 2
+    static let RULE_EXPRESSIONS: UInt16 = 4
+    static let LIST_ELEM: UInt16 = 1
+    static let EXPR_NAME: UInt16 = 1
+    static let EXPR_DATA: UInt16 = 2
+    static let DATA_VALUE: UInt16 = 1
+    static let DATA_VERDICT: UInt16 = 2
+    static let VERDICT_CODE: UInt16 = 1
+    static let PAYLOAD_DREG: UInt16 = 1
+    static let PAYLOAD_BASE: UInt16 = 2
+    static let PAYLOAD_OFFSET: UInt16 = 3
+    static let PAYLOAD_LEN: UInt16 = 4
+    static let BITWISE_SREG: UInt16 = 1
+    static let BITWISE_DREG: UInt16 = 2
+    static let BITWISE_LEN: UInt16 = 3
+    static let BITWISE_MASK: UInt16 = 4
+    static let BITWISE_XOR: UInt16 = 5
+    static let CMP_SREG: UInt16 = 1
+    static let CMP_OP: UInt16 = 2
+    static let CMP_DATA: UInt16 = 3
+    static let META_DREG: UInt16 = 1
+    static let META_KEY: UInt16 = 2
+    static let CT_DREG: UInt16 = 1
+    static let CT_KEY: UInt16 = 2
+    static let IMMEDIATE_DREG: UInt16 = 1
+    static let IMMEDIATE_DATA: UInt16 = 2
+}
+
+struct NftablesHook {
+    static let NF_INET_FORWARD: UInt32 = 2
+    static let NF_INET_POST_ROUTING: UInt32 = 4
+    static let NF_IP_PRI_FILTER: Int32 = 0
+    static let NF_IP_PRI_NAT_SRC: Int32 = 100
+}
+
+struct NftablesVerdict {
+    static let DROP: UInt32 = 0
+    static let ACCEPT: UInt32 = 1
+}
+
+struct NftablesPayloadBase {
+    static let NETWORK_HEADER: UInt32 = 1
+}
+
+struct NftablesMetaKey {
+    static let IIFNAME: UInt32 = 6
+    static let OIFNAME: UInt32 = 7
+}
+
+struct NftablesConntrackState {
+    // NF_CT_STATE_BIT(IP_CT_ESTABLISHED) / NF_CT_STATE_BIT(IP_CT_RELATED)
+    static let ESTABLISHED: UInt32 = 1 << 1
+    static let RELATED: UInt32 = 1 << 2
+}
+
+/// One nftables rule expression. All of them work on register 1 except the
+/// verdict.
+enum NftablesExpression: Equatable {
+    enum CompareOp: UInt32 {
+        case equal = 0
+        case notEqual = 1
+    }
+
+    case payload(base: UInt32, offset: UInt32, length: UInt32)
+    case bitwise(mask: [UInt8])
+    case compare(CompareOp, [UInt8])
+    case meta(UInt32)
+    case conntrackState
+    case masquerade
+    case accept
+
+    private static let register1: UInt32 = 1
+    private static let verdictRegister: UInt32 = 0
+
+    var name: String {
+        switch self {
+        case .payload: "payload"
+        case .bitwise: "bitwise"
+        case .compare: "cmp"
+        case .meta: "meta"
+        case .conntrackState: "ct"
+        case .masquerade: "masq"
+        case .accept: "immediate"
+        }
+    }
+
+    func encodeData(into writer: inout NetlinkAttributeWriter) {
+        typealias A = NftablesAttribute
+        switch self {
+        case .payload(let base, let offset, let length):
+            writer.put(A.PAYLOAD_DREG, bigEndian: Self.register1)
+            writer.put(A.PAYLOAD_BASE, bigEndian: base)
+            writer.put(A.PAYLOAD_OFFSET, bigEndian: offset)
+            writer.put(A.PAYLOAD_LEN, bigEndian: length)
+        case .bitwise(let mask):
+            writer.put(A.BITWISE_SREG, bigEndian: Self.register1)
+            writer.put(A.BITWISE_DREG, bigEndian: Self.register1)
+            writer.put(A.BITWISE_LEN, bigEndian: UInt32(mask.count))
+            writer.nest(A.BITWISE_MASK) { $0.put(A.DATA_VALUE, mask) }
+            writer.nest(A.BITWISE_XOR) { $0.put(A.DATA_VALUE, [UInt8](repeating: 0, count: mask.count)) }
+        case .compare(let op, let data):
+            writer.put(A.CMP_SREG, bigEndian: Self.register1)
+            writer.put(A.CMP_OP, bigEndian: op.rawValue)
+            writer.nest(A.CMP_DATA) { $0.put(A.DATA_VALUE, data) }
+        case .meta(let key):
+            writer.put(A.META_DREG, bigEndian: Self.register1)
+            writer.put(A.META_KEY, bigEndian: key)
+        case .conntrackState:
+            writer.put(A.CT_DREG, bigEndian: Self.register1)
+            writer.put(A.CT_KEY, bigEndian: 0)
+        case .masquerade:
+            break
+        case .accept:
+            writer.put(A.IMMEDIATE_DREG, bigEndian: Self.verdictRegister)
+            writer.nest(A.IMMEDIATE_DATA) {
+                $0.nest(A.DATA_VERDICT) { $0.put(A.VERDICT_CODE, bigEndian: NftablesVerdict.ACCEPT) }
+            }
+        }
+    }
+}
+
+/// Appends netlink attributes (TLVs padded to 4 bytes) to a buffer.
+struct NetlinkAttributeWriter {
+    private(set) var bytes: [UInt8] = []
+
+    mutating func put(_ type: UInt16, _ payload: [UInt8]) {
+        appendHeader(type: type, length: RTAttribute.size + payload.count)
+        bytes += payload
+        pad()
+    }
+
+    mutating func put(_ type: UInt16, bigEndian value: UInt32) {
+        put(type, withUnsafeBytes(of: value.bigEndian, Array.init))
+    }
+
+    mutating func put(_ type: UInt16, string: String) {
+        put(type, Array(string.utf8) + [0])
+    }
+
+    mutating func nest(_ type: UInt16, _ body: (inout NetlinkAttributeWriter) -> Void) {
+        var inner = NetlinkAttributeWriter()
+        body(&inner)
+        appendHeader(type: type | NetlinkNetfilter.NLA_F_NESTED, length: RTAttribute.size + inner.bytes.count)
+        bytes += inner.bytes
+    }
+
+    private mutating func appendHeader(type: UInt16, length: Int) {
+        bytes += withUnsafeBytes(of: UInt16(length), Array.init)
+        bytes += withUnsafeBytes(of: type, Array.init)
+    }
+
+    private mutating func pad() {
+        while bytes.count % 4 != 0 {
+            bytes.append(0)
+        }
+    }
+}
+
+/// Builds an nfnetlink batch: `BATCH_BEGIN`, nftables messages,
+/// `BATCH_END`, each with its own sequence number.
+struct NftablesBatch {
+    private let pid: UInt32
+    private var seq: UInt32
+    private var buffer: [UInt8] = []
+    /// Number of messages the kernel will acknowledge.
+    private(set) var ackedMessages = 0
+
+    init(pid: UInt32, seq: UInt32 = UInt32.random(in: 0..<(UInt32.max / 2))) {
+        self.pid = pid
+        self.seq = seq
+        append(
+            type: NetlinkNetfilter.NFNL_MSG_BATCH_BEGIN, flags: NetlinkFlags.NLM_F_REQUEST,
+            family: 0, resourceID: NetlinkNetfilter.NFNL_SUBSYS_NFTABLES, attributes: [])
+    }
+
+    /// Create `table` if needed and then delete it, so deleting never fails
+    /// on a missing table.
+    mutating func deleteTable(_ table: String) {
+        var attrs = NetlinkAttributeWriter()
+        attrs.put(NftablesAttribute.TABLE_NAME, string: table)
+        message(NftablesMessageType.NEWTABLE, create: true, attrs)
+        message(NftablesMessageType.DELTABLE, create: false, attrs)
+    }
+
+    /// Drop any existing `table` and create it empty.
+    mutating func replaceTable(_ table: String) {
+        deleteTable(table)
+        var attrs = NetlinkAttributeWriter()
+        attrs.put(NftablesAttribute.TABLE_NAME, string: table)
+        message(NftablesMessageType.NEWTABLE, create: true, attrs)
+    }
+
+    mutating func add(chain: String, table: String, type: String, hook: UInt32, priority: Int32) {
+        var attrs = NetlinkAttributeWriter()
+        attrs.put(NftablesAttribute.CHAIN_TABLE, string: table)
+        attrs.put(NftablesAttribute.CHAIN_NAME, string: chain)
+        attrs.nest(NftablesAttribute.CHAIN_HOOK) {
+            $0.put(NftablesAttribute.HOOK_HOOKNUM, bigEndian: hook)
+            $0.put(NftablesAttribute.HOOK_PRIORITY, bigEndian: UInt32(bitPattern: priority))
+        }
+        attrs.put(NftablesAttribute.CHAIN_TYPE, string: type)
+        message(NftablesMessageType.NEWCHAIN, create: true, attrs)
+    }
+
+    mutating func add(rule expressions: [NftablesExpression], chain: String, table: String) {
+        var attrs = NetlinkAttributeWriter()
+        attrs.put(NftablesAttribute.RULE_TABLE, string: table)
+        attrs.put(NftablesAttribute.RULE_CHAIN, string: chain)
+        attrs.nest(NftablesAttribute.RULE_EXPRESSIONS) { list in
+            for expression in expressions {
+                list.nest(NftablesAttribute.LIST_ELEM) { elem in
+                    elem.put(NftablesAttribute.EXPR_NAME, string: expression.name)
+                    elem.nest(NftablesAttribute.EXPR_DATA) { expression.encodeData(into: &$0) }
+                }
+            }
+        }
+        message(NftablesMessageType.NEWRULE, create: true, append: true, attrs)
+    }
+
+    /// Close the batch and return the bytes to send.
+    func finish() -> [UInt8] {
+        var copy = self
+        copy.append(
+            type: NetlinkNetfilter.NFNL_MSG_BATCH_END, flags: NetlinkFlags.NLM_F_REQUEST,
+            family: 0, resourceID: NetlinkNetfilter.NFNL_SUBSYS_NFTABLES, attributes: [])
+        return copy.buffer
+    }
+
+    private mutating func message(
+        _ type: UInt16,
+        create: Bool,
+        append: Bool = false,
+        _ attrs: NetlinkAttributeWriter
+    ) {
+        var flags = NetlinkFlags.NLM_F_REQUEST | NetlinkFlags.NLM_F_ACK
+        if create {
+            flags |= NetlinkFlags.NLM_F_CREATE
+        }
+        if append {
+            flags |= NetlinkFlags.NLM_F_APPEND
+        }
+        self.append(
+            type: NetlinkNetfilter.NFNL_SUBSYS_NFTABLES << 8 | type, flags: flags,
+            family: NetlinkNetfilter.NFPROTO_IPV4, resourceID: 0, attributes: attrs.bytes)
+        ackedMessages += 1
+    }
+
+    private mutating func append(
+        type: UInt16,
+        flags: UInt16,
+        family: UInt8,
+        resourceID: UInt16,
+        attributes: [UInt8]
+    ) {
+        // struct nfgenmsg: family, version (NFNETLINK_V0), big-endian res_id.
+        let nfgen: [UInt8] = [family, 0] + withUnsafeBytes(of: resourceID.bigEndian, Array.init)
+        let length = NetlinkMessageHeader.size + nfgen.count + attributes.count
+        let header = NetlinkMessageHeader(
+            len: UInt32(length), type: type, flags: flags, seq: seq, pid: pid)
+        var headerBytes = [UInt8](repeating: 0, count: NetlinkMessageHeader.size)
+        _ = try? header.appendBuffer(&headerBytes, offset: 0)
+        buffer += headerBytes + nfgen + attributes
+        seq &+= 1
+    }
+}
@@ -609,6 +609,13 @@ public struct LinkResponse {
             .map { $0.data }
     }
 
+    /// The interface name from `IFLA_IFNAME`, if the response carries one.
+    public var name: String? {
+        attrDatas
+            .first { $0.attribute.type == LinkAttributeType.IFLA_IFNAME }
+            .map { String(decoding: $0.data.prefix { $0 != 0 }, as: UTF8.self) }
+    }
+
     /// Extract network interface statistics from the response attributes
     public func getStatistics() throws -> LinkStatistics64? {
         for attrData in attrDatas {
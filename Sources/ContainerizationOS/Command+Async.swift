@@ -0,0 +1,240 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+import CShim
+import Foundation
+
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Musl)
+import Musl
+#elseif canImport(Glibc)
+import Glibc
+#endif
+
+/// Serial queue shared by every async process wait and pipe read. Handlers
+/// only make non-blocking syscalls, so one queue serves any number of them.
+private let monitorQueue = DispatchQueue(label: "com.apple.containerization.command-monitor")
+
+extension Command {
+    /// Wait for the process to exit and return the exit status, without
+    /// blocking the calling thread.
+    ///
+    /// On Linux the exit is observed through a pidfd, and on Darwin through a
+    /// process dispatch source. Either way the process is reaped with a
+    /// non-blocking `wait4` once it has exited. If the task is cancelled the
+    /// wait ends with `CancellationError` and the process is left running.
+    @discardableResult
+    public func waitForExit() async throws -> Int32 {
+        let pid = self.pid
+        guard pid > 0 else {
+            return -1
+        }
+        if let status = try Self.reapIfExited(pid) {
+            return status
+        }
+        let watch = ExitWatch(pid: pid)
+        return try await withTaskCancellationHandler {
+            try await withCheckedThrowingContinuation { continuation in
+                watch.start(continuation)
+            }
+        } onCancel: {
+            watch.cancel()
+        }
+    }
+
+    /// Reap `pid` if it has exited. Returns nil while it is still running.
+    static func reapIfExited(_ pid: pid_t) throws -> Int32? {
+        var rus = rusage()
+        var ws = Int32()
+        while true {
+            let result = wait4(pid, &ws, WNOHANG, &rus)
+            if result == pid {
+                return toExitStatus(ws)
+            }
+            if result == 0 {
+                return nil
+            }
+            if errno == EINTR {
+                continue
+            }
+            throw POSIXError(.init(rawValue: errno)!)
+        }
+    }
+}
+
+extension FileHandle {
+    /// Read until end of file without blocking the calling thread.
+    ///
+    /// The descriptor is switched to non-blocking mode and drained from a
+    /// dispatch read source as data arrives. Use this for pipes whose write
+    /// end belongs to a child process, so the child can't stall on a full
+    /// pipe while its exit is awaited.
+    public func readToEndAsync() async throws -> Data {
+        let fd = self.fileDescriptor
+        let flags = fcntl(fd, F_GETFL)
+        guard flags != -1, fcntl(fd, F_SETFL, flags | O_NONBLOCK) != -1 else {
+            throw POSIXError(.init(rawValue: errno)!)
+        }
+        let drain = PipeDrain(fd: fd)
+        return try await withTaskCancellationHandler {
+            try await withCheckedThrowingContinuation { continuation in
+                drain.start(continuation)
+            }
+        } onCancel: {
+            drain.cancel()
+        }
+    }
+}
+
+/// Watches one process for exit. State is confined to `monitorQueue`.
+private final class ExitWatch: @unchecked Sendable {
+    private let pid: pid_t
+    private var source: (any DispatchSourceProtocol)?
+    private var continuation: CheckedContinuation<Int32, any Error>?
+    private var cancelled = false
+
+    init(pid: pid_t) {
+        self.pid = pid
+    }
+
+    func start(_ continuation: CheckedContinuation<Int32, any Error>) {
+        monitorQueue.async { [self] in
+            self.continuation = continuation
+            guard !cancelled else {
+                finish(.failure(CancellationError()))
+                return
+            }
+            let source = makeSource()
+            source.setEventHandler { [self] in check() }
+            self.source = source
+            source.activate()
+            // The process may have exited before the source was armed.
+            check()
+        }
+    }
+
+    func cancel() {
+        monitorQueue.async { [self] in
+            cancelled = true
+            finish(.failure(CancellationError()))
+        }
+    }
+
+    private func makeSource() -> any DispatchSourceProtocol {
+        #if os(Linux)
+        let pidfd = exec_command_pidfd_open(pid)
+        if pidfd >= 0 {
+            // A pidfd polls readable once the process has exited.
+            let source = DispatchSource.makeReadSource(fileDescriptor: pidfd, queue: monitorQueue)
+            source.setCancelHandler { close(pidfd) }
+            return source
+        }
+        // Kernels without pidfd_open (before 5.3): poll for the exit.
+        let timer = DispatchSource.makeTimerSource(queue: monitorQueue)
+        timer.schedule(deadline: .now() + .milliseconds(5), repeating: .milliseconds(5), leeway: .milliseconds(5))
+        return timer
+        #else
+        return DispatchSource.makeProcessSource(identifier: pid, eventMask: .exit, queue: monitorQueue)
+        #endif
+    }
+
+    private func check() {
+        do {
+            if let status = try Command.reapIfExited(pid) {
+                finish(.success(status))
+            }
+        } catch {
+            finish(.failure(error))
+        }
+    }
+
+    private func finish(_ result: Result<Int32, any Error>) {
+        guard let continuation else {
+            return
+        }
+        self.continuation = nil
+        source?.cancel()
+        source = nil
+        continuation.resume(with: result)
+    }
+}
+
+/// Drains one non-blocking descriptor to EOF. State is confined to
+/// `monitorQueue`.
+private final class PipeDrain: @unchecked Sendable {
+    private let fd: Int32
+    private var source: DispatchSourceRead?
+    private var continuation: CheckedContinuation<Data, any Error>?
+    private var result: Result<Data, any Error>?
+    private var data = Data()
+    private var cancelled = false
+
+    init(fd: Int32) {
+        self.fd = fd
+    }
+
+    func start(_ continuation: CheckedContinuation<Data, any Error>) {
+        monitorQueue.async { [self] in
+            self.continuation = continuation
+            guard !cancelled else {
+                continuation.resume(throwing: CancellationError())
+                self.continuation = nil
+                return
+            }
+            let source = DispatchSource.makeReadSource(fileDescriptor: fd, queue: monitorQueue)
+            source.setEventHandler { [self] in drain() }
+            // The caller owns the descriptor and may close it as soon as we
+            // return, so only resume once the source has let go of it.
+            source.setCancelHandler { [self] in
+                let result = self.result ?? .failure(CancellationError())
+                self.continuation?.resume(with: result)
+                self.continuation = nil
+            }
+            self.source = source
+            source.activate()
+        }
+    }
+
+    func cancel() {
+        monitorQueue.async { [self] in
+            cancelled = true
+            source?.cancel()
+            source = nil
+        }
+    }
+
+    private func drain() {
+        var buffer = [UInt8](repeating: 0, count: 65536)
+        while true {
+            let n = buffer.withUnsafeMutableBytes { read(fd, $0.baseAddress, $0.count) }
+            if n > 0 {
+                data.append(contentsOf: buffer[0..<n])
+                continue
+            }
+            if n < 0 && errno == EINTR {
+                continue
+            }
+            if n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK) {
+                return
+            }
+            result = n == 0 ? .success(data) : .failure(POSIXError(.init(rawValue: errno)!))
+            source?.cancel()
+            source = nil
+            return
+        }
+    }
+}
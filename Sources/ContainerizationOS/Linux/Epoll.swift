@@ -76,6 +76,35 @@ public final class Epoll: Sendable {
         public let mask: Mask
     }
 
+    /// When a registered descriptor is reported.
+    public enum Trigger: Sendable {
+        /// Once per readiness change. The handler must drain the
+        /// descriptor to EAGAIN before it is reported again.
+        case edge
+        /// On every wait while the descriptor is ready.
+        case level
+    }
+
+    /// Reusable storage for `wait(into:timeout:)`, so a poll loop doesn't
+    /// allocate on every wakeup.
+    public struct EventBatch: RandomAccessCollection {
+        fileprivate var raw: [epoll_event]
+        public fileprivate(set) var count = 0
+
+        /// - Parameter capacity: The most events one wait returns.
+        public init(capacity: Int = 1024) {
+            self.raw = .init(repeating: epoll_event(), count: max(capacity, 1))
+        }
+
+        public var startIndex: Int { 0 }
+        public var endIndex: Int { count }
+
+        public subscript(position: Int) -> Event {
+            precondition(position < count, "index out of range")
+            return Event(fd: raw[position].data.fd, mask: Mask(rawValue: raw[position].events))
+        }
+    }
+
     private let epollFD: Int32
     private let eventFD: Int32
 
@@ -115,20 +144,46 @@ public final class Epoll: Sendable {
         close(eventFD)
     }
 
-    /// Register a file descriptor for edge-triggered monitoring.
-    public func add(_ fd: Int32, mask: Mask) throws {
+    /// Register a file descriptor for monitoring, edge-triggered by default.
+    ///
+    /// With `oneShot`, the descriptor is disabled after its first event
+    /// until `rearm` is called, so a handler can't race with itself over
+    /// the same descriptor.
+    public func add(_ fd: Int32, mask: Mask, trigger: Trigger = .edge, oneShot: Bool = false) throws {
         guard fcntl(fd, F_SETFL, O_NONBLOCK) == 0 else {
             throw POSIXError.fromErrno()
         }
+        try control(EPOLL_CTL_ADD, fd, events: Self.events(mask, trigger: trigger, oneShot: oneShot))
+    }
 
-        let events = epollMask(EPOLLET) | mask.rawValue
+    /// Re-enable a one-shot descriptor after its event has been handled.
+    public func rearm(_ fd: Int32, mask: Mask, trigger: Trigger = .edge) throws {
+        try control(EPOLL_CTL_MOD, fd, events: Self.events(mask, trigger: trigger, oneShot: true))
+    }
 
+    /// Change the events a registered descriptor is monitored for.
+    public func modify(_ fd: Int32, mask: Mask, trigger: Trigger = .edge, oneShot: Bool = false) throws {
+        try control(EPOLL_CTL_MOD, fd, events: Self.events(mask, trigger: trigger, oneShot: oneShot))
+    }
+
+    private static func events(_ mask: Mask, trigger: Trigger, oneShot: Bool) -> UInt32 {
+        var events = mask.rawValue
+        if trigger == .edge {
+            events |= epollMask(EPOLLET)
+        }
+        if oneShot {
+            events |= epollMask(EPOLLONESHOT)
+        }
+        return events
+    }
+
+    private func control(_ op: Int32, _ fd: Int32, events: UInt32) throws {
         var event = epoll_event()
         event.events = events
         event.data.fd = fd
 
         try withUnsafeMutablePointer(to: &event) { ptr in
-            if epoll_ctl(self.epollFD, EPOLL_CTL_ADD, fd, ptr) == -1 {
+            if epoll_ctl(self.epollFD, op, fd, ptr) == -1 {
                 throw POSIXError.fromErrno()
             }
         }
@@ -149,10 +204,22 @@ public final class Epoll: Sendable {
     ///
     /// Returns ready events, an empty array on timeout, or `nil` on shutdown.
     public func wait(maxEvents: Int = 128, timeout: Int32 = -1) -> [Event]? {
-        var events: [epoll_event] = .init(repeating: epoll_event(), count: maxEvents)
+        var batch = EventBatch(capacity: maxEvents)
+        guard wait(into: &batch, timeout: timeout) else {
+            return nil
+        }
+        return Array(batch)
+    }
 
+    /// Wait for events, filling `batch` in place.
+    ///
+    /// Returns false on shutdown; otherwise `batch` holds the ready events,
+    /// and is empty on timeout.
+    public func wait(into batch: inout EventBatch, timeout: Int32 = -1) -> Bool {
         while true {
-            let n = epoll_wait(self.epollFD, &events, Int32(events.count), timeout)
+            let n = batch.raw.withUnsafeMutableBufferPointer {
+                epoll_wait(self.epollFD, $0.baseAddress, Int32($0.count), timeout)
+            }
             if n < 0 {
                 if errno == EINTR || errno == EAGAIN {
                     continue
@@ -160,20 +227,12 @@ public final class Epoll: Sendable {
                 preconditionFailure("epoll_wait failed unexpectedly: \(POSIXError.fromErrno())")
             }
 
-            if n == 0 {
-                return []
-            }
-
-            var result: [Event] = []
-            result.reserveCapacity(Int(n))
-            for i in 0..<Int(n) {
-                let fd = events[i].data.fd
-                if fd == self.eventFD {
-                    return nil
-                }
-                result.append(Event(fd: fd, mask: Mask(rawValue: events[i].events)))
+            batch.count = Int(n)
+            for i in 0..<Int(n) where batch.raw[i].data.fd == self.eventFD {
+                batch.count = 0
+                return false
             }
-            return result
+            return true
         }
     }
 
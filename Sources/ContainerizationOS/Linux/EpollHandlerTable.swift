@@ -0,0 +1,208 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+#if os(Linux)
+#if canImport(FoundationEssentials)
+import FoundationEssentials
+#else
+import Foundation
+#endif
+
+import Synchronization
+
+/// Per-descriptor handlers for an epoll loop, looked up without a lock.
+///
+/// Slots are indexed by fd in lazily allocated chunks, and each holds an
+/// atomically published pointer to its handler. Registration is rare and
+/// serializes on a mutex. Dispatch is the hot path and only does atomic
+/// loads. A replaced or removed handler can still be in use by a dispatch
+/// in flight, so its release is deferred until that batch ends, in the
+/// manner of RCU.
+///
+/// There must be a single dispatching thread: the one calling `dispatch`.
+/// Handlers may register and remove descriptors, including their own,
+/// from inside `dispatch`.
+public final class EpollHandlerTable<Handler: Sendable>: @unchecked Sendable {
+    private final class Box {
+        let handler: Handler
+
+        init(_ handler: Handler) {
+            self.handler = handler
+        }
+    }
+
+    private static var chunkShift: Int { 10 }
+    private static var chunkSize: Int { 1 << chunkShift }
+
+    /// Exclusive upper bound on the descriptors the table accepts.
+    public let capacity: Int
+
+    // Chunk pointers, each an array of `chunkSize` slot words. A chunk is
+    // never freed before the table, so a loaded chunk stays valid.
+    private let chunks: UnsafeMutablePointer<Atomic<UInt>>
+    private let chunkCount: Int
+
+    /// Serializes writers; holds handlers retired during a dispatch.
+    private let retired = Mutex<[UInt]>([])
+    private let retiredCount = Atomic<Int>(0)
+    private let dispatching = Atomic<Bool>(false)
+
+    /// - Parameter capacity: Descriptors at or above this are rejected.
+    ///   Only the chunks that are used are allocated.
+    public init(capacity: Int = 1 << 20) {
+        self.chunkCount = (max(capacity, 1) + Self.chunkSize - 1) >> Self.chunkShift
+        self.capacity = chunkCount << Self.chunkShift
+        self.chunks = .allocate(capacity: chunkCount)
+        for i in 0..<chunkCount {
+            (chunks + i).initialize(to: Atomic(0))
+        }
+    }
+
+    deinit {
+        for i in 0..<chunkCount {
+            guard let chunk = Self.chunk(chunks[i].load(ordering: .relaxed)) else {
+                continue
+            }
+            for j in 0..<Self.chunkSize {
+                Self.box(chunk[j].load(ordering: .relaxed))?.release()
+            }
+            chunk.deinitialize(count: Self.chunkSize)
+            chunk.deallocate()
+        }
+        chunks.deinitialize(count: chunkCount)
+        chunks.deallocate()
+        for bits in retired.withLock({ $0 }) {
+            Self.box(bits)?.release()
+        }
+    }
+
+    /// Install `handler` for `fd`, replacing any previous one.
+    public func set(_ fd: Int32, _ handler: Handler) throws {
+        guard fd >= 0 else {
+            throw POSIXError(.EBADF)
+        }
+        guard Int(fd) < capacity else {
+            throw POSIXError(.EMFILE)
+        }
+        let box = Unmanaged.passRetained(Box(handler))
+        publish(fd, UInt(bitPattern: box.toOpaque()))
+    }
+
+    /// Remove the handler for `fd`, if any.
+    public func remove(_ fd: Int32) {
+        guard fd >= 0, Int(fd) < capacity else {
+            return
+        }
+        publish(fd, 0)
+    }
+
+    /// Call `body` with the handler of each event's descriptor, skipping
+    /// descriptors without one. Takes no lock unless handlers were removed
+    /// while it ran.
+    public func dispatch<Events: Sequence<Epoll.Event>>(
+        _ events: Events,
+        _ body: (Handler, Epoll.Event) -> Void
+    ) {
+        // Sequentially consistent, pairing with the writer's exchange and
+        // load in `publish`: either the writer sees this dispatch and defers
+        // its release, or this dispatch's slot loads see the new value.
+        dispatching.store(true, ordering: .sequentiallyConsistent)
+        for event in events {
+            guard let box = load(event.fd) else {
+                continue
+            }
+            body(box.takeUnretainedValue().handler, event)
+        }
+        dispatching.store(false, ordering: .sequentiallyConsistent)
+        if retiredCount.load(ordering: .sequentiallyConsistent) > 0 {
+            reclaim()
+        }
+    }
+
+    private func load(_ fd: Int32) -> Unmanaged<Box>? {
+        guard fd >= 0, Int(fd) < capacity,
+            let chunk = Self.chunk(chunks[Int(fd) >> Self.chunkShift].load(ordering: .acquiring))
+        else {
+            return nil
+        }
+        return Self.box(chunk[Int(fd) & (Self.chunkSize - 1)].load(ordering: .sequentiallyConsistent))
+    }
+
+    private func publish(_ fd: Int32, _ value: UInt) {
+        var release: [UInt] = []
+        retired.withLock { retired in
+            let index = Int(fd) >> Self.chunkShift
+            var chunk = Self.chunk(chunks[index].load(ordering: .acquiring))
+            if chunk == nil {
+                guard value != 0 else {
+                    return
+                }
+                let fresh = UnsafeMutablePointer<Atomic<UInt>>.allocate(capacity: Self.chunkSize)
+                for i in 0..<Self.chunkSize {
+                    (fresh + i).initialize(to: Atomic(0))
+                }
+                chunks[index].store(UInt(bitPattern: fresh), ordering: .releasing)
+                chunk = fresh
+            }
+            let slot = Int(fd) & (Self.chunkSize - 1)
+            let old = chunk![slot].exchange(value, ordering: .sequentiallyConsistent)
+            guard old != 0 else {
+                return
+            }
+            guard dispatching.load(ordering: .sequentiallyConsistent) else {
+                release.append(old)
+                return
+            }
+            retired.append(old)
+            retiredCount.add(1, ordering: .sequentiallyConsistent)
+            // The dispatch may have ended before the count went up and so
+            // missed it. If so, the handlers are no longer in use.
+            if !dispatching.load(ordering: .sequentiallyConsistent) {
+                release = retired
+                retired.removeAll()
+                retiredCount.store(0, ordering: .sequentiallyConsistent)
+            }
+        }
+        // Outside the lock: a handler's captures may register descriptors
+        // as they deinit.
+        for bits in release {
+            Self.box(bits)?.release()
+        }
+    }
+
+    private func reclaim() {
+        let release = retired.withLock { retired in
+            defer {
+                retired.removeAll()
+                retiredCount.store(0, ordering: .sequentiallyConsistent)
+            }
+            return retired
+        }
+        for bits in release {
+            Self.box(bits)?.release()
+        }
+    }
+
+    private static func chunk(_ bits: UInt) -> UnsafeMutablePointer<Atomic<UInt>>? {
+        UnsafeMutablePointer(bitPattern: bits)
+    }
+
+    private static func box(_ bits: UInt) -> Unmanaged<Box>? {
+        UnsafeRawPointer(bitPattern: bits).map { Unmanaged<Box>.fromOpaque($0) }
+    }
+}
+
+#endif  // os(Linux)
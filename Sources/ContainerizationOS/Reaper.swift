@@ -30,24 +30,33 @@ import Foundation
 /// A process reaper that returns exited processes along
 /// with their exit status.
 public struct Reaper {
-    /// Process's pid and exit status.
-    typealias Exit = (pid: Int32, status: Int32)
+    /// A reaped process's exit status and resource usage.
+    public struct Exit: Sendable {
+        public var status: Int32
+        public var usage: ResourceUsage
+    }
 
     /// Reap all pending processes and return the pid and exit status.
     public static func reap() -> [Int32: Int32] {
-        var reaped = [Int32: Int32]()
+        reapWithUsage().mapValues(\.status)
+    }
+
+    /// Reap all pending processes and return the pid, exit status and
+    /// resource usage of each.
+    public static func reapWithUsage() -> [Int32: Exit] {
+        var reaped = [Int32: Exit]()
         while true {
-            guard let exit = wait() else {
+            guard case let (pid, exit)? = wait() else {
                 return reaped
             }
-            reaped[exit.pid] = exit.status
+            reaped[pid] = exit
         }
         return reaped
     }
 
-    /// Returns the exit status of the last process that exited.
+    /// Returns the exit of the last process that exited.
     /// nil is returned when no pending processes exist.
-    private static func wait() -> Exit? {
+    private static func wait() -> (Int32, Exit)? {
         var rus = rusage()
         var ws = Int32()
 
@@ -55,6 +64,6 @@ public struct Reaper {
         if pid <= 0 {
             return nil
         }
-        return (pid: pid, status: Command.toExitStatus(ws))
+        return (pid, Exit(status: Command.toExitStatus(ws), usage: ResourceUsage(rus)))
     }
 }
@@ -0,0 +1,97 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+#if canImport(Musl)
+import Musl
+#elseif canImport(Glibc)
+import Glibc
+#elseif canImport(Darwin)
+import Darwin
+#endif
+
+/// Resource usage of an exited process and the children it waited for, as
+/// reported by `wait4(2)`.
+public struct ResourceUsage: Sendable, Equatable {
+    /// CPU time spent in user mode.
+    public var userTime: Duration
+    /// CPU time spent in the kernel.
+    public var systemTime: Duration
+    /// Peak resident set size, in bytes.
+    public var maxRSSBytes: UInt64
+    /// Page faults served without I/O.
+    public var minorPageFaults: UInt64
+    /// Page faults that required I/O.
+    public var majorPageFaults: UInt64
+    /// Context switches from blocking, such as waiting on I/O.
+    public var voluntaryContextSwitches: UInt64
+    /// Context switches from preemption.
+    public var involuntaryContextSwitches: UInt64
+    /// Filesystem reads that went to the block layer.
+    public var blockInputOps: UInt64
+    /// Filesystem writes that went to the block layer.
+    public var blockOutputOps: UInt64
+
+    public init(
+        userTime: Duration = .zero,
+        systemTime: Duration = .zero,
+        maxRSSBytes: UInt64 = 0,
+        minorPageFaults: UInt64 = 0,
+        majorPageFaults: UInt64 = 0,
+        voluntaryContextSwitches: UInt64 = 0,
+        involuntaryContextSwitches: UInt64 = 0,
+        blockInputOps: UInt64 = 0,
+        blockOutputOps: UInt64 = 0
+    ) {
+        self.userTime = userTime
+        self.systemTime = systemTime
+        self.maxRSSBytes = maxRSSBytes
+        self.minorPageFaults = minorPageFaults
+        self.majorPageFaults = majorPageFaults
+        self.voluntaryContextSwitches = voluntaryContextSwitches
+        self.involuntaryContextSwitches = involuntaryContextSwitches
+        self.blockInputOps = blockInputOps
+        self.blockOutputOps = blockOutputOps
+    }
+
+    public init(_ rus: rusage) {
+        #if os(Linux)
+        // Linux reports ru_maxrss in kilobytes, Darwin in bytes.
+        let maxRSS = UInt64(clamping: rus.ru_maxrss) * 1024
+        #else
+        let maxRSS = UInt64(clamping: rus.ru_maxrss)
+        #endif
+        self.init(
+            userTime: Self.duration(rus.ru_utime),
+            systemTime: Self.duration(rus.ru_stime),
+            maxRSSBytes: maxRSS,
+            minorPageFaults: UInt64(clamping: rus.ru_minflt),
+            majorPageFaults: UInt64(clamping: rus.ru_majflt),
+            voluntaryContextSwitches: UInt64(clamping: rus.ru_nvcsw),
+            involuntaryContextSwitches: UInt64(clamping: rus.ru_nivcsw),
+            blockInputOps: UInt64(clamping: rus.ru_inblock),
+            blockOutputOps: UInt64(clamping: rus.ru_oublock)
+        )
+    }
+
+    /// User plus system CPU time.
+    public var cpuTime: Duration {
+        userTime + systemTime
+    }
+
+    private static func duration(_ tv: timeval) -> Duration {
+        .seconds(Int64(tv.tv_sec)) + .microseconds(Int64(tv.tv_usec))
+    }
+}
@@ -14,6 +14,9 @@
 // limitations under the License.
 //===----------------------------------------------------------------------===//
 
+#if os(Linux)
+import CShim
+#endif
 import ContainerizationError
 import Dispatch
 import Logging
@@ -35,19 +38,28 @@ import Foundation
 
 /// Manages bidirectional data relay between two file descriptors using `DispatchSource`.
 ///
-/// Uses non-blocking I/O with backpressure: when a destination fd's buffer is full,
-/// the relay suspends reading from the source and installs a `DispatchSourceWrite`
-/// to resume once the destination is writable again. This prevents blocking the
-/// dispatch queue and avoids head-of-line blocking across connections.
+/// Uses non-blocking I/O with backpressure: each direction stages bytes in its own
+/// buffer, and when the destination fd's buffer is full the relay suspends reading
+/// from the source and installs a `DispatchSourceWrite` to resume once the destination
+/// is writable again. This prevents blocking the dispatch queue and avoids
+/// head-of-line blocking across connections.
+///
+/// On Linux each direction first tries `splice(2)` through a pipe, so payload bytes
+/// never enter user space. Descriptors the kernel cannot splice fall back to a ring
+/// buffer that starts small and doubles, up to 1 MiB, while reads keep filling it;
+/// whatever was already spliced into the pipe is moved into the ring first.
+///
+/// Relays created without an explicit queue are spread over a fixed set of serial
+/// queues, one per active processor, rather than each getting its own.
 ///
 /// ## Concurrency model
 ///
 /// The class has two distinct synchronization domains:
 ///
 /// - **Serial dispatch queue** — owns all I/O state: the `Direction` objects (`d1`, `d2`)
-///   and their read buffers (`buf1`, `buf2`). Every event handler, cancel handler, and
-///   `stop()` call runs on this queue. No locks are needed for that state because the
-///   queue is the exclusive executor. Fields in this domain are marked `nonisolated(unsafe)`.
+///   and their staging buffers. Every event handler, cancel handler, and `stop()` call
+///   runs on this queue. No locks are needed for that state because the queue is the
+///   exclusive executor. Fields in this domain are marked `nonisolated(unsafe)`.
 ///
 /// - **Mutexes** — protect the two pieces of state that cross the queue boundary:
 ///   `activeDirections` (written by `start()`, which may run off-queue) and
@@ -57,18 +69,238 @@ public final class BidirectionalRelay: Sendable {
     private let fd2: Int32
     private let log: Logger?
     private let queue: DispatchQueue
-    private static let queueKey = DispatchSpecificKey<Void>()
+    private static let queueKey = DispatchSpecificKey<ObjectIdentifier>()
+
+    private static let sharedQueues: [DispatchQueue] = (0..<max(ProcessInfo.processInfo.activeProcessorCount, 1))
+        .map { DispatchQueue(label: "com.apple.containerization.bidirectional-relay.\($0)") }
+    private static let nextSharedQueue = Atomic<Int>(0)
+
+    private static let initialBufferSize = 16 * 1024
+    private static let maxBufferSize = 1024 * 1024
+
+    /// Default capacity requested for each direction's splice pipe. Pipe pages
+    /// are unswappable kernel memory, so this stays well under `maxBufferSize`.
+    public static let defaultPipeSize = 256 * 1024
+
+    /// A fixed-capacity byte ring. Reads land in the free space after the tail and
+    /// writes drain from the head, so bytes a blocked destination did not accept stay
+    /// where they are instead of being copied aside.
+    private struct RingBuffer: ~Copyable {
+        private var storage: UnsafeMutableRawBufferPointer
+        private var head = 0
+        private(set) var count = 0
+
+        init(capacity: Int) {
+            storage = .allocate(byteCount: capacity, alignment: 16)
+        }
+
+        deinit {
+            storage.deallocate()
+        }
+
+        var capacity: Int { storage.count }
+        var isFull: Bool { count == storage.count }
+
+        /// The contiguous free space after the tail.
+        var writable: UnsafeMutableRawBufferPointer {
+            let tail = (head + count) % storage.count
+            let end = tail < head || count == storage.count ? head : storage.count
+            return UnsafeMutableRawBufferPointer(rebasing: storage[tail..<max(tail, end)])
+        }
+
+        /// The contiguous buffered bytes starting at the head.
+        var readable: UnsafeRawBufferPointer {
+            UnsafeRawBufferPointer(rebasing: storage[head..<min(head + count, storage.count)])
+        }
+
+        mutating func didWrite(_ n: Int) {
+            count += n
+        }
+
+        mutating func didRead(_ n: Int) {
+            count -= n
+            head = count == 0 ? 0 : (head + n) % storage.count
+        }
+
+        /// Replaces the storage with a larger one. Only valid while empty.
+        mutating func grow(to capacity: Int) {
+            precondition(count == 0)
+            storage.deallocate()
+            storage = .allocate(byteCount: capacity, alignment: 16)
+            head = 0
+        }
+    }
+
+    #if os(Linux)
+    /// A pipe used as the staging buffer for `splice(2)`.
+    private struct SplicePipe {
+        let reader: Int32
+        let writer: Int32
+        let capacity: Int
+        var count = 0
+
+        init?(size: Int) {
+            var fds: [Int32] = [-1, -1]
+            guard pipe(&fds) == 0 else {
+                return nil
+            }
+            for fd in fds {
+                _ = fcntl(fd, F_SETFD, FD_CLOEXEC)
+                _ = fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK)
+            }
+            reader = fds[0]
+            writer = fds[1]
+            // Best effort: unprivileged callers are capped at fs.pipe-max-size.
+            _ = fcntl(writer, F_SETPIPE_SZ, Int32(clamping: size))
+            let actual = fcntl(writer, F_GETPIPE_SZ)
+            capacity = actual > 0 ? Int(actual) : 65536
+        }
+
+        func release() {
+            _ = close(reader)
+            _ = close(writer)
+        }
+    }
+    #endif
 
     /// Owns one direction of the relay: its read source, optional write source, and
-    /// any data buffered due to backpressure.
+    /// the bytes read from the source that the destination has not yet accepted.
     ///
     /// All methods must be called only from the relay's serial dispatch queue.
     private final class Direction {
         var readSource: DispatchSourceRead?
         var writeSource: DispatchSourceWrite?
-        var pendingData: [UInt8] = []
-        var pendingOffset: Int = 0
+        /// Set once the source reports EOF; the direction finishes after the
+        /// buffered bytes are written.
+        var sourceClosed = false
+        /// Bytes written to the destination. Read from any thread.
+        let transferred = Atomic<UInt64>(0)
         private var readSuspended = false
+        private var ring = RingBuffer(capacity: BidirectionalRelay.initialBufferSize)
+        #if os(Linux)
+        private var pipe: SplicePipe?
+        #endif
+
+        init(pipeSize: Int) {
+            #if os(Linux)
+            pipe = SplicePipe(size: pipeSize)
+            #endif
+        }
+
+        deinit {
+            #if os(Linux)
+            pipe?.release()
+            #endif
+        }
+
+        /// Bytes read from the source but not yet written to the destination.
+        var buffered: Int {
+            #if os(Linux)
+            if let pipe { return pipe.count }
+            #endif
+            return ring.count
+        }
+
+        var isFull: Bool {
+            #if os(Linux)
+            if let pipe { return pipe.count == pipe.capacity }
+            #endif
+            return ring.isFull
+        }
+
+        /// Reads from `fd` into the staging buffer. Returns what `read(2)` would.
+        func fill(from fd: Int32) -> Int {
+            #if os(Linux)
+            if var p = pipe {
+                let n = splice(fd, nil, p.writer, nil, p.capacity - p.count, UInt32(SPLICE_F_MOVE | SPLICE_F_NONBLOCK))
+                if n >= 0 {
+                    p.count += n
+                    pipe = p
+                    return n
+                }
+                guard errno == EINVAL, abandonPipe() else {
+                    return n
+                }
+            }
+            #endif
+            let region = ring.writable
+            let wasEmpty = ring.count == 0
+            let n = read(fd, region.baseAddress, region.count)
+            if n > 0 {
+                ring.didWrite(n)
+                if wasEmpty && n == ring.capacity && ring.capacity < BidirectionalRelay.maxBufferSize {
+                    growWhenEmpty = true
+                }
+            }
+            return n
+        }
+
+        /// Writes staged bytes to `fd`. Returns what `write(2)` would.
+        func flush(to fd: Int32) -> Int {
+            #if os(Linux)
+            if var p = pipe {
+                let n = splice(p.reader, nil, fd, nil, p.count, UInt32(SPLICE_F_MOVE | SPLICE_F_NONBLOCK))
+                if n > 0 {
+                    p.count -= n
+                    pipe = p
+                    transferred.add(UInt64(n), ordering: .relaxed)
+                }
+                guard n < 0, errno == EINVAL, abandonPipe() else {
+                    return n
+                }
+            }
+            #endif
+            let region = ring.readable
+            let n = write(fd, region.baseAddress, region.count)
+            if n > 0 {
+                ring.didRead(n)
+                transferred.add(UInt64(n), ordering: .relaxed)
+                if ring.count == 0 && growWhenEmpty {
+                    growWhenEmpty = false
+                    ring.grow(to: ring.capacity * 2)
+                }
+            }
+            return n
+        }
+
+        #if os(Linux)
+        /// One side of this direction cannot be spliced: move whatever the pipe
+        /// holds into the ring and copy through user space from now on. Returns
+        /// false, with `errno` set, if the pipe could not be drained.
+        private func abandonPipe() -> Bool {
+            guard let p = pipe else {
+                return true
+            }
+            if p.count > 0 {
+                // The ring is unused while splicing, so it is empty here.
+                if p.count >= ring.capacity {
+                    ring.grow(to: max(p.capacity, ring.capacity))
+                }
+                while ring.count < p.count {
+                    let region = ring.writable
+                    let n = read(p.reader, region.baseAddress, min(region.count, p.count - ring.count))
+                    if n > 0 {
+                        ring.didWrite(n)
+                    } else if n < 0 && errno == EINTR {
+                        continue
+                    } else {
+                        if n == 0 {
+                            errno = EIO
+                        }
+                        return false
+                    }
+                }
+            }
+            p.release()
+            pipe = nil
+            return true
+        }
+        #endif
+
+        /// Set when a read filled the whole, previously empty, ring: the source
+        /// is producing faster than one buffer per event, so double the ring the
+        /// next time it drains.
+        private var growWhenEmpty = false
 
         func suspendRead() {
             guard let src = readSource, !src.isCancelled, !readSuspended else { return }
@@ -110,10 +342,8 @@ public final class BidirectionalRelay: Sendable {
     // accesses from event/cancel handlers observe the initialized values without
     // additional synchronization. nonisolated(unsafe) declares that we are taking
     // responsibility for this; the serial queue is the enforcing mechanism.
-    private nonisolated(unsafe) let d1 = Direction()  // fd1 → fd2
-    private nonisolated(unsafe) let d2 = Direction()  // fd2 → fd1
-    private nonisolated(unsafe) let buf1: UnsafeMutableBufferPointer<UInt8>
-    private nonisolated(unsafe) let buf2: UnsafeMutableBufferPointer<UInt8>
+    private nonisolated(unsafe) let d1: Direction  // fd1 → fd2
+    private nonisolated(unsafe) let d2: Direction  // fd2 → fd1
 
     // Counts active read sources. Set to 2 in start() (possibly off-queue) and
     // decremented in cancel handlers (always on the queue). The Mutex provides the
@@ -131,30 +361,30 @@ public final class BidirectionalRelay: Sendable {
     /// - Parameters:
     ///   - fd1: The first file descriptor.
     ///   - fd2: The second file descriptor.
-    ///   - queue: The dispatch queue to use for I/O operations. If nil, a new queue is created.
+    ///   - queue: The serial dispatch queue to use for I/O operations. If nil, one of a
+    ///     shared set of relay queues is used.
+    ///   - pipeSize: Capacity to request for each direction's `splice(2)` pipe on
+    ///     Linux. Ignored elsewhere.
     ///   - log: The optional logger for debugging.
     public init(
         fd1: Int32,
         fd2: Int32,
         queue: DispatchQueue? = nil,
+        pipeSize: Int = BidirectionalRelay.defaultPipeSize,
         log: Logger? = nil
     ) {
         self.fd1 = fd1
         self.fd2 = fd2
-        self.queue = queue ?? DispatchQueue(label: "com.apple.containerization.bidirectional-relay")
-        self.queue.setSpecific(key: Self.queueKey, value: ())
+        self.d1 = Direction(pipeSize: pipeSize)
+        self.d2 = Direction(pipeSize: pipeSize)
+        self.queue =
+            queue
+            ?? Self.sharedQueues[
+                Self.nextSharedQueue.wrappingAdd(1, ordering: .relaxed).oldValue % Self.sharedQueues.count]
+        self.queue.setSpecific(key: Self.queueKey, value: ObjectIdentifier(self.queue))
         self.log = log
         self.activeDirections = Mutex(0)
         self.completionState = Mutex(.pending)
-
-        let pageSize = Int(getpagesize())
-        self.buf1 = UnsafeMutableBufferPointer<UInt8>.allocate(capacity: pageSize)
-        self.buf2 = UnsafeMutableBufferPointer<UInt8>.allocate(capacity: pageSize)
-    }
-
-    deinit {
-        buf1.deallocate()
-        buf2.deallocate()
     }
 
     private static func setNonBlocking(_ fd: Int32) throws {
@@ -184,8 +414,8 @@ public final class BidirectionalRelay: Sendable {
         d2.readSource = src2
         activeDirections.withLock { $0 = 2 }
 
-        src1.setEventHandler { [self] in handleRead(d1, from: fd1, to: fd2, buffer: buf1) }
-        src2.setEventHandler { [self] in handleRead(d2, from: fd2, to: fd1, buffer: buf2) }
+        src1.setEventHandler { [self] in handleRead(d1, from: fd1, to: fd2) }
+        src2.setEventHandler { [self] in handleRead(d2, from: fd2, to: fd1) }
 
         src1.setCancelHandler { [self] in
             d1.writeSource?.cancel()
@@ -210,6 +440,12 @@ public final class BidirectionalRelay: Sendable {
         }
     }
 
+    /// Bytes relayed so far in each direction. Safe to call from any thread,
+    /// including after the relay has completed.
+    public var bytesTransferred: (fromFd1: UInt64, fromFd2: UInt64) {
+        (d1.transferred.load(ordering: .relaxed), d2.transferred.load(ordering: .relaxed))
+    }
+
     /// Waits for the relay to complete.
     public func waitForCompletion() async {
         await withCheckedContinuation { c in
@@ -227,7 +463,7 @@ public final class BidirectionalRelay: Sendable {
     }
 
     private func runOnQueue(_ work: () -> Void) {
-        if DispatchQueue.getSpecific(key: Self.queueKey) != nil {
+        if DispatchQueue.getSpecific(key: Self.queueKey) == ObjectIdentifier(queue) {
             work()
         } else {
             queue.sync(execute: work)
@@ -244,14 +480,9 @@ public final class BidirectionalRelay: Sendable {
         }
     }
 
-    private func handleRead(
-        _ dir: Direction,
-        from srcFd: Int32,
-        to dstFd: Int32,
-        buffer: UnsafeMutableBufferPointer<UInt8>
-    ) {
+    private func handleRead(_ dir: Direction, from srcFd: Int32, to dstFd: Int32) {
         do {
-            switch try Self.copy(buffer: buffer, from: srcFd, to: dstFd, direction: dir) {
+            switch try Self.copy(from: srcFd, to: dstFd, direction: dir) {
             case .ok:
                 break
 
@@ -260,13 +491,7 @@ public final class BidirectionalRelay: Sendable {
                     "source EOF",
                     metadata: ["sourceFd": "\(srcFd)", "destinationFd": "\(dstFd)"]
                 )
-                dir.cancelRead()
-                if shutdown(dstFd, Int32(SHUT_WR)) != 0 {
-                    log?.debug(
-                        "shutdown(SHUT_WR) failed",
-                        metadata: ["fd": "\(dstFd)", "errno": "\(errno)"]
-                    )
-                }
+                finishWriting(dir, to: dstFd)
 
             case .blocked:
                 log?.debug(
@@ -274,7 +499,7 @@ public final class BidirectionalRelay: Sendable {
                     metadata: [
                         "sourceFd": "\(srcFd)",
                         "destinationFd": "\(dstFd)",
-                        "pendingBytes": "\(dir.pendingData.count)",
+                        "pendingBytes": "\(dir.buffered)",
                     ]
                 )
                 dir.suspendRead()
@@ -299,45 +524,52 @@ public final class BidirectionalRelay: Sendable {
         }
     }
 
+    /// The source reached EOF and everything it sent has been written.
+    private func finishWriting(_ dir: Direction, to dstFd: Int32) {
+        dir.cancelRead()
+        if shutdown(dstFd, Int32(SHUT_WR)) != 0 {
+            log?.debug(
+                "shutdown(SHUT_WR) failed",
+                metadata: ["fd": "\(dstFd)", "errno": "\(errno)"]
+            )
+        }
+    }
+
     private func installWriteSource(for dir: Direction, from srcFd: Int32, to dstFd: Int32) {
         let ws = DispatchSource.makeWriteSource(fileDescriptor: dstFd, queue: queue)
         dir.writeSource = ws
         ws.setEventHandler { [self] in drainPending(dir: dir, from: srcFd, to: dstFd) }
-        // No cancel handler: clearing pendingData from a cancel handler would race with
-        // a newly installed write source if drainPending completes and the read source
-        // immediately produces another blocked write, installing a fresh write source
-        // before the old cancel handler fires. pendingData is cleared explicitly by
-        // drainPending on success, and freed with Direction when the relay is torn down.
+        // No cancel handler: the buffered bytes belong to the direction, not to this
+        // source, and are only consumed by drainPending. They are freed with Direction
+        // when the relay is torn down.
         ws.activate()
     }
 
     private func drainPending(dir: Direction, from srcFd: Int32, to dstFd: Int32) {
-        let remaining = dir.pendingData.count - dir.pendingOffset
-        guard remaining > 0 else { return }
-
-        let n = dir.pendingData.withUnsafeBufferPointer { buf in
-            write(dstFd, buf.baseAddress!.advanced(by: dir.pendingOffset), remaining)
-        }
-
-        if n > 0 {
-            dir.pendingOffset += n
-            if dir.pendingOffset >= dir.pendingData.count {
-                dir.writeSource?.cancel()
-                dir.writeSource = nil
-                dir.pendingData = []
-                dir.pendingOffset = 0
+        do {
+            guard try Self.flush(dir, to: dstFd) else {
+                // Still blocked, or a spurious write-ready notification; wait for the next one.
+                return
+            }
+            dir.writeSource?.cancel()
+            dir.writeSource = nil
+            if dir.sourceClosed {
+                log?.debug(
+                    "source EOF",
+                    metadata: ["sourceFd": "\(srcFd)", "destinationFd": "\(dstFd)"]
+                )
+                finishWriting(dir, to: dstFd)
+            } else {
                 log?.debug(
                     "backpressure relieved, resuming reads",
                     metadata: ["sourceFd": "\(srcFd)", "destinationFd": "\(dstFd)"]
                 )
                 dir.resumeRead()
             }
-        } else if n == -1 && errno == EAGAIN {
-            // Spurious write-ready notification; wait for the next one.
-        } else {
+        } catch {
             log?.warning(
                 "write error during pending drain",
-                metadata: ["destinationFd": "\(dstFd)", "errno": "\(errno)"]
+                metadata: ["destinationFd": "\(dstFd)", "error": "\(error)"]
             )
             dir.writeSource?.cancel()
             dir.writeSource = nil
@@ -357,54 +589,57 @@ public final class BidirectionalRelay: Sendable {
     /// whether to fire the read event, so when the only remaining readable condition is
     /// EOF (FIONREAD == 0), the event is suppressed. Reading in a loop here ensures we
     /// observe read() == 0 on the same handler invocation that drained the last bytes.
-    private static func copy(
-        buffer: UnsafeMutableBufferPointer<UInt8>,
-        from srcFd: Int32,
-        to dstFd: Int32,
-        direction: Direction
-    ) throws -> CopyResult {
-        guard let base = buffer.baseAddress else {
-            throw ContainerizationError(.invalidState, message: "buffer has no base address")
-        }
-
-        readLoop: while true {
-            let nr = read(srcFd, base, buffer.count)
-            if nr == 0 { return .eof }
-            if nr < 0 {
-                if errno == EAGAIN || errno == EWOULDBLOCK { return .ok }
-                if errno == EINTR { continue readLoop }
-                throw ContainerizationError(
-                    .internalError,
-                    message: "read failed: fd \(srcFd), errno \(errno)"
-                )
-            }
-
-            var offset = 0
-            while offset < nr {
-                let nw = write(dstFd, base.advanced(by: offset), nr - offset)
-                if nw > 0 {
-                    offset += nw
-                } else if nw < 0 {
+    private static func copy(from srcFd: Int32, to dstFd: Int32, direction: Direction) throws -> CopyResult {
+        while true {
+            var drained = direction.sourceClosed
+            if !drained && !direction.isFull {
+                let nr = direction.fill(from: srcFd)
+                if nr == 0 {
+                    direction.sourceClosed = true
+                    drained = true
+                } else if nr < 0 {
                     if errno == EINTR { continue }
-                    if errno == EAGAIN || errno == EWOULDBLOCK {
-                        direction.pendingData = Array(
-                            UnsafeBufferPointer(start: base.advanced(by: offset), count: nr - offset)
+                    guard errno == EAGAIN || errno == EWOULDBLOCK else {
+                        throw ContainerizationError(
+                            .internalError,
+                            message: "read failed: fd \(srcFd), errno \(errno)"
                         )
-                        direction.pendingOffset = 0
-                        return .blocked
                     }
-                    throw ContainerizationError(
-                        .internalError,
-                        message: "write failed: fd \(dstFd), errno \(errno)"
-                    )
-                } else {
-                    throw ContainerizationError(
-                        .internalError,
-                        message: "zero-byte write on fd \(dstFd)"
-                    )
+                    drained = true
                 }
             }
+
+            guard try flush(direction, to: dstFd) else {
+                return .blocked
+            }
+            if drained {
+                return direction.sourceClosed ? .eof : .ok
+            }
+        }
+    }
+
+    /// Writes everything buffered in `direction` to dstFd. Returns false if the
+    /// destination would block before the buffer is empty.
+    private static func flush(_ direction: Direction, to dstFd: Int32) throws -> Bool {
+        while direction.buffered > 0 {
+            let nw = direction.flush(to: dstFd)
+            if nw > 0 {
+                continue
+            }
+            if nw < 0 {
+                if errno == EINTR { continue }
+                if errno == EAGAIN || errno == EWOULDBLOCK { return false }
+                throw ContainerizationError(
+                    .internalError,
+                    message: "write failed: fd \(dstFd), errno \(errno)"
+                )
+            }
+            throw ContainerizationError(
+                .internalError,
+                message: "zero-byte write on fd \(dstFd)"
+            )
         }
+        return true
     }
 
     private func closeBothFds() {
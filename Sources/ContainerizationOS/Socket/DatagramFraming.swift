@@ -0,0 +1,119 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+#if canImport(Musl)
+import Musl
+#elseif canImport(Glibc)
+import Glibc
+#elseif canImport(Darwin)
+import Darwin
+#endif
+
+/// Carries datagrams over a byte stream such as a vsock connection. Each
+/// datagram is sent as a 2-byte big-endian length followed by its payload.
+public enum DatagramFraming {
+    public static let headerSize = 2
+    /// The largest payload a frame can carry.
+    public static let maxDatagramSize = Int(UInt16.max)
+
+    /// Reassembles datagrams from bytes read off the stream.
+    public struct Decoder: Sendable {
+        private var buffer: [UInt8] = []
+        private var start = 0
+
+        public init() {}
+
+        /// Adds bytes read from the stream.
+        public mutating func append(_ bytes: UnsafeRawBufferPointer) {
+            if start > 0 && start >= buffer.count / 2 {
+                buffer.removeFirst(start)
+                start = 0
+            }
+            buffer.append(contentsOf: bytes)
+        }
+
+        /// Returns the next complete datagram, or nil if more bytes are needed.
+        public mutating func next() -> ArraySlice<UInt8>? {
+            guard buffer.count - start >= DatagramFraming.headerSize else {
+                return nil
+            }
+            let length = Int(buffer[start]) << 8 | Int(buffer[start + 1])
+            let end = start + DatagramFraming.headerSize + length
+            guard end <= buffer.count else {
+                return nil
+            }
+            let payload = buffer[(start + DatagramFraming.headerSize)..<end]
+            start = end
+            return payload
+        }
+    }
+
+    /// Queues framed datagrams for a non-blocking stream and writes as much
+    /// as the stream accepts. A frame is either queued whole or dropped, so a
+    /// partial write never splits the stream's framing.
+    public struct Encoder: Sendable {
+        /// The most bytes, headers included, held while the stream is blocked.
+        public let capacity: Int
+        private var buffer: [UInt8] = []
+        private var start = 0
+
+        public init(capacity: Int = 256 * 1024) {
+            self.capacity = capacity
+        }
+
+        /// Bytes queued but not yet written.
+        public var pending: Int { buffer.count - start }
+
+        /// Queues one datagram. Returns false, queueing nothing, if the
+        /// datagram is too large to frame or the queue is full.
+        public mutating func enqueue(_ datagram: UnsafeRawBufferPointer) -> Bool {
+            guard datagram.count <= DatagramFraming.maxDatagramSize,
+                pending + DatagramFraming.headerSize + datagram.count <= capacity
+            else {
+                return false
+            }
+            if start > 0 && start == buffer.count {
+                buffer.removeAll(keepingCapacity: true)
+                start = 0
+            }
+            buffer.append(UInt8(truncatingIfNeeded: datagram.count >> 8))
+            buffer.append(UInt8(truncatingIfNeeded: datagram.count))
+            buffer.append(contentsOf: datagram)
+            return true
+        }
+
+        /// Writes queued bytes to `fd` until the queue is empty or the write
+        /// would block. Returns false if the write failed for any other reason.
+        public mutating func flush(to fd: Int32) -> Bool {
+            while pending > 0 {
+                let n = buffer.withUnsafeBytes { buf in
+                    write(fd, buf.baseAddress!.advanced(by: start), buf.count - start)
+                }
+                if n > 0 {
+                    start += n
+                    continue
+                }
+                if n < 0 && errno == EINTR {
+                    continue
+                }
+                return n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)
+            }
+            buffer.removeAll(keepingCapacity: true)
+            start = 0
+            return true
+        }
+    }
+}
@@ -0,0 +1,169 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+#if canImport(Musl)
+import Musl
+#elseif canImport(Glibc)
+import Glibc
+#elseif canImport(Darwin)
+import Darwin
+#else
+#error("InetType not supported on this platform.")
+#endif
+
+/// TCP over IPv4 or IPv6 variant of `SocketType`.
+///
+/// The address is also usable on its own, through `withSockAddr`, for
+/// binding, connecting or addressing datagram sockets.
+public struct InetType: SocketType, Sendable, CustomStringConvertible {
+    public var domain: Int32 { _domain }
+    public var type: Int32 { _SOCK_STREAM }
+    public var description: String {
+        _domain == AF_INET6 ? "[\(address)]:\(port)" : "\(address):\(port)"
+    }
+
+    public let address: String
+    public let port: UInt16
+    private let _domain: Int32
+    private let _addr: sockaddr_storage
+
+    /// Creates an address from a numeric IPv4 or IPv6 string and a port.
+    public init(address: String, port: UInt16) throws {
+        var storage = sockaddr_storage()
+        if address.contains(":") {
+            var sin6 = sockaddr_in6()
+            sin6.sin6_family = sa_family_t(AF_INET6)
+            sin6.sin6_port = port.bigEndian
+            guard inet_pton(AF_INET6, address, &sin6.sin6_addr) == 1 else {
+                throw Error.invalidAddress(address)
+            }
+            #if os(macOS)
+            sin6.sin6_len = UInt8(MemoryLayout<sockaddr_in6>.size)
+            #endif
+            Self.copy(sin6, into: &storage)
+            self._domain = AF_INET6
+        } else {
+            var sin = sockaddr_in()
+            sin.sin_family = sa_family_t(AF_INET)
+            sin.sin_port = port.bigEndian
+            guard inet_pton(AF_INET, address, &sin.sin_addr) == 1 else {
+                throw Error.invalidAddress(address)
+            }
+            #if os(macOS)
+            sin.sin_len = UInt8(MemoryLayout<sockaddr_in>.size)
+            #endif
+            Self.copy(sin, into: &storage)
+            self._domain = AF_INET
+        }
+        self.address = address
+        self.port = port
+        self._addr = storage
+    }
+
+    /// Wraps an address filled in by the kernel, such as from accept(2) or
+    /// recvfrom(2). Returns nil for families other than AF_INET and AF_INET6.
+    public init?(sockaddr storage: sockaddr_storage) {
+        var storage = storage
+        var text = [CChar](repeating: 0, count: Int(INET6_ADDRSTRLEN))
+        switch Int32(storage.ss_family) {
+        case AF_INET:
+            let port = withUnsafePointer(to: &storage) {
+                $0.withMemoryRebound(to: sockaddr_in.self, capacity: 1) { sin in
+                    var addr = sin.pointee.sin_addr
+                    inet_ntop(AF_INET, &addr, &text, socklen_t(text.count))
+                    return UInt16(bigEndian: sin.pointee.sin_port)
+                }
+            }
+            self.port = port
+            self._domain = AF_INET
+        case AF_INET6:
+            let port = withUnsafePointer(to: &storage) {
+                $0.withMemoryRebound(to: sockaddr_in6.self, capacity: 1) { sin6 in
+                    var addr = sin6.pointee.sin6_addr
+                    inet_ntop(AF_INET6, &addr, &text, socklen_t(text.count))
+                    return UInt16(bigEndian: sin6.pointee.sin6_port)
+                }
+            }
+            self.port = port
+            self._domain = AF_INET6
+        default:
+            return nil
+        }
+        self.address = String(cString: text)
+        self._addr = storage
+    }
+
+    private static func copy<T>(_ value: T, into storage: inout sockaddr_storage) {
+        withUnsafeBytes(of: value) { src in
+            withUnsafeMutableBytes(of: &storage) { dst in
+                dst.copyMemory(from: src)
+            }
+        }
+    }
+
+    private var addrLength: UInt32 {
+        UInt32(_domain == AF_INET6 ? MemoryLayout<sockaddr_in6>.size : MemoryLayout<sockaddr_in>.size)
+    }
+
+    public func beforeBind(fd: Int32) throws {
+        var one: Int32 = 1
+        guard setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, socklen_t(MemoryLayout<Int32>.size)) == 0 else {
+            throw Socket.errnoToError(msg: "setsockopt SO_REUSEADDR failed")
+        }
+    }
+
+    public func accept(fd: Int32) throws -> (Int32, SocketType) {
+        var addr = sockaddr_storage()
+
+        let clientFD = Syscall.retrying {
+            var size = socklen_t(MemoryLayout<sockaddr_storage>.stride)
+            return withUnsafeMutablePointer(to: &addr) { pointer in
+                pointer.withMemoryRebound(to: sockaddr.self, capacity: 1) { pointer in
+                    sysAccept(fd, pointer, &size)
+                }
+            }
+        }
+        if clientFD < 0 {
+            throw Socket.errnoToError(msg: "accept failed")
+        }
+
+        return (clientFD, InetType(sockaddr: addr) ?? self)
+    }
+
+    public func withSockAddr(_ closure: (UnsafePointer<sockaddr>, UInt32) throws -> Void) throws {
+        var addr = self._addr
+        let length = addrLength
+        try withUnsafePointer(to: &addr) {
+            try $0.withMemoryRebound(to: sockaddr.self, capacity: 1) {
+                try closure($0, length)
+            }
+        }
+    }
+}
+
+extension InetType {
+    /// `InetType` errors.
+    public enum Error: Swift.Error, CustomStringConvertible {
+        case invalidAddress(_: String)
+
+        public var description: String {
+            switch self {
+            case .invalidAddress(let address):
+                return "\(address) is not a numeric IPv4 or IPv6 address"
+            }
+        }
+    }
+}
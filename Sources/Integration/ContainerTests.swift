@@ -68,6 +68,33 @@ extension IntegrationSuite {
         }
     }
 
+    func testProcessResourceUsage() async throws {
+        let id = "test-process-resource-usage"
+
+        let bs = try await bootstrap(id)
+        let container = try LinuxContainer(id, rootfs: bs.rootfs, vmm: bs.vmm) { config in
+            // Spin long enough to register CPU time.
+            config.process.arguments = ["/bin/sh", "-c", "i=0; while [ $i -lt 200000 ]; do i=$((i+1)); done"]
+            config.bootLog = bs.bootLog
+        }
+
+        try await container.create()
+        try await container.start()
+
+        let status = try await container.wait()
+        try await container.stop()
+
+        guard status.exitCode == 0 else {
+            throw IntegrationError.assert(msg: "process status \(status) != 0")
+        }
+        guard let usage = status.usage else {
+            throw IntegrationError.assert(msg: "no resource usage reported for reaped process")
+        }
+        guard usage.cpuTime > .zero, usage.maxRSSBytes > 0 else {
+            throw IntegrationError.assert(msg: "implausible resource usage \(usage)")
+        }
+    }
+
     final class DiscardingWriter: @unchecked Sendable, Writer {
         var count: Int = 0
 
@@ -1124,6 +1151,79 @@ extension IntegrationSuite {
         }
     }
 
+    func testPortForwardTCP() async throws {
+        try await portForwardTCP(id: "test-port-forward-tcp")
+    }
+
+    func testPortForwardTCPIOUring() async throws {
+        try await portForwardTCP(id: "test-port-forward-tcp-io-uring", initArgs: ["--io-engine", "io-uring"])
+    }
+
+    private func portForwardTCP(id: String, initArgs: [String] = []) async throws {
+        let bs = try await bootstrap(id, initArgs: initArgs)
+
+        // Let the kernel pick a free host port, then hand it to the forward.
+        let probe = try Socket(type: InetType(address: "127.0.0.1", port: 0))
+        try probe.listen()
+        var addr = sockaddr_storage()
+        var len = socklen_t(MemoryLayout<sockaddr_storage>.size)
+        _ = withUnsafeMutablePointer(to: &addr) {
+            $0.withMemoryRebound(to: sockaddr.self, capacity: 1) { getsockname(probe.fileDescriptor, $0, &len) }
+        }
+        guard let hostPort = InetType(sockaddr: addr)?.port else {
+            throw IntegrationError.assert(msg: "failed to pick a host port")
+        }
+        try probe.close()
+
+        let container = try LinuxContainer(id, rootfs: bs.rootfs, vmm: bs.vmm) { config in
+            config.process.arguments = ["nc", "-lk", "-p", "8080", "-e", "cat"]
+            config.portForwards = [
+                PortForwardConfiguration(proto: .tcp, hostPort: hostPort, guestPort: 8080)
+            ]
+            config.bootLog = bs.bootLog
+        }
+
+        do {
+            try await container.create()
+            try await container.start()
+
+            // nc may not be listening yet; until it is, the guest side refuses
+            // and the host connection closes without an echo.
+            let message = Array("ping through the forward\n".utf8)
+            var echoed: [UInt8] = []
+            for _ in 0..<50 {
+                let client = try Socket(type: InetType(address: "127.0.0.1", port: hostPort))
+                try client.connect()
+                try client.setTimeout(option: .receive, seconds: 5)
+                _ = try client.write(data: Data(message))
+                var data = Data(count: message.count)
+                let n = (try? client.read(buffer: &data)) ?? 0
+                try? client.close()
+                if n > 0 {
+                    echoed = Array(data.prefix(n))
+                    break
+                }
+                try await Task.sleep(for: .milliseconds(100))
+            }
+            guard echoed == Array(message.prefix(echoed.count)), !echoed.isEmpty else {
+                throw IntegrationError.assert(msg: "expected echo of \(message), got \(echoed)")
+            }
+
+            let stats = try await container.portForwardStatistics()
+            guard let forward = stats.first, forward.acceptLatency.count > 0 else {
+                throw IntegrationError.assert(msg: "expected accept latency samples, got \(stats)")
+            }
+            print("port forward accept latency p50: \(forward.acceptLatency.percentile(0.5).map { "\($0)" } ?? "n/a")")
+
+            try await container.kill(.kill)
+            try await container.wait()
+            try await container.stop()
+        } catch {
+            try? await container.stop()
+            throw error
+        }
+    }
+
     // NOTE: Once upon a time our guest agent created any proxied unix sockets at
     // a path that contained the container ID in it. The problem here is if the container
     // ID is comically long we exceed the max length of a unix domain socket path.
@@ -1910,6 +2010,83 @@ extension IntegrationSuite {
         }
     }
 
+    func testIOEngineIOUring() async throws {
+        // Guest kernels without io_uring fall back to epoll inside vminitd, so
+        // this passes either way; on io_uring kernels it drives the ring relay.
+        try await exerciseIOEngine(id: "test-io-engine-io-uring", engine: "io-uring")
+    }
+
+    func testIOEngineEpoll() async throws {
+        try await exerciseIOEngine(id: "test-io-engine-epoll", engine: "epoll")
+    }
+
+    /// Boots vminitd with `--io-engine <engine>` and pushes stdio, an exec and
+    /// a copy through it.
+    private func exerciseIOEngine(id: String, engine: String) async throws {
+        let bs = try await bootstrap(id, initArgs: ["--io-engine", engine])
+
+        let container = try LinuxContainer(id, rootfs: bs.rootfs, vmm: bs.vmm) { config in
+            config.process.arguments = ["sleep", "100"]
+            config.bootLog = bs.bootLog
+        }
+
+        let testContent = "copied through the \(engine) engine"
+        let hostFile = FileManager.default.uniqueTemporaryDirectory(create: true)
+            .appendingPathComponent("io-engine.txt")
+        try testContent.write(to: hostFile, atomically: true, encoding: .utf8)
+
+        do {
+            try await container.create()
+            try await container.start()
+
+            // Large enough to take several relay rounds through the pipes.
+            let payload = Data((0..<(512 * 1024)).map { UInt8(truncatingIfNeeded: $0 &* 31) })
+            let echoed = BufferWriter()
+            let stdio = try await container.exec("stdio") { config in
+                config.arguments = ["cat"]
+                config.stdin = StdinBuffer(data: payload)
+                config.stdout = echoed
+            }
+            try await stdio.start()
+            let stdioStatus = try await stdio.wait()
+            try await stdio.delete()
+
+            guard stdioStatus.exitCode == 0 else {
+                throw IntegrationError.assert(msg: "cat command failed with status \(stdioStatus)")
+            }
+            guard echoed.data == payload else {
+                throw IntegrationError.assert(
+                    msg: "stdout mismatch: expected \(payload.count) bytes, got \(echoed.data.count)")
+            }
+
+            try await container.copyIn(from: hostFile, to: URL(filePath: "/tmp/io-engine.txt"))
+
+            let copied = BufferWriter()
+            let verify = try await container.exec("verify-copy") { config in
+                config.arguments = ["cat", "/tmp/io-engine.txt"]
+                config.stdout = copied
+            }
+            try await verify.start()
+            let verifyStatus = try await verify.wait()
+            try await verify.delete()
+
+            guard verifyStatus.exitCode == 0 else {
+                throw IntegrationError.assert(msg: "cat command failed with status \(verifyStatus)")
+            }
+            guard String(data: copied.data, encoding: .utf8) == testContent else {
+                throw IntegrationError.assert(
+                    msg: "copied file content mismatch: expected '\(testContent)', got '\(String(data: copied.data, encoding: .utf8) ?? "")'")
+            }
+
+            try await container.kill(.kill)
+            try await container.wait()
+            try await container.stop()
+        } catch {
+            try? await container.stop()
+            throw error
+        }
+    }
+
     func testCopyInFileToExistingDirectory() async throws {
         let id = "test-copy-in-file-to-dir"
 
@@ -5672,4 +5849,76 @@ extension IntegrationSuite {
                 msg: "expected 'deep-content' but got '\(value ?? "<nil>")'")
         }
     }
+
+    #if os(Linux)
+    /// fio-style scaling check for multi-queue virtio-blk. Runs the same
+    /// parallel O_DIRECT write load against a data disk attached with one
+    /// queue and with one queue per vCPU, asserts the guest sees the
+    /// configured number of blk-mq hardware queues, and logs throughput for
+    /// each. CH-only (VZ has no queue knobs).
+    func testBlockMultiQueueScaling() async throws {
+        let id = "test-block-multi-queue"
+        let bs = try await bootstrap(id)
+
+        let cpus = 4
+        let jobs = 4
+        let blocksPerJob = 16384  // 64 MiB of 4 KiB writes per job.
+        // Find the data disk, report its hardware queue count, then time
+        // `jobs` concurrent direct-I/O writers.
+        let script = """
+            dev=$(awk '$2 == "/data" { print $1 }' /proc/mounts)
+            ls /sys/block/${dev#/dev/}/mq | wc -l
+            start=$(date +%s%N)
+            for i in $(seq \(jobs)); do
+                dd if=/dev/zero of=/data/job$i bs=4k count=\(blocksPerJob) oflag=direct 2>/dev/null &
+            done
+            wait
+            end=$(date +%s%N)
+            echo $(( (end - start) / 1000000 ))
+            """
+
+        for queues in [1, cpus] {
+            let diskPath = Self.testDir.appending(component: "\(id)-\(queues).ext4")
+            try? FileManager.default.removeItem(at: diskPath)
+            let filesystem = try EXT4.Formatter(FilePath(diskPath.absolutePath()), minDiskSize: 1024.mib())
+            try filesystem.close()
+
+            let buffer = BufferWriter()
+            let container = try LinuxContainer("\(id)-\(queues)", rootfs: bs.rootfs, vmm: bs.vmm) { config in
+                config.cpus = cpus
+                config.cpuOverhead = 0
+                config.mounts.append(
+                    .block(
+                        format: "ext4",
+                        source: diskPath.absolutePath(),
+                        destination: "/data",
+                        runtimeOptions: ["chNumQueues=\(queues)", "chDirect=true"]
+                    ))
+                config.process.arguments = ["/bin/sh", "-c", script]
+                config.process.stdout = buffer
+                config.bootLog = bs.bootLog
+            }
+
+            try await container.create()
+            try await container.start()
+            let status = try await container.wait()
+            try await container.stop()
+
+            guard status.exitCode == 0 else {
+                throw IntegrationError.assert(msg: "process failed with status \(status)")
+            }
+            let lines = String(decoding: buffer.data, as: UTF8.self).split(separator: "\n")
+            guard lines.count == 2, let hwQueues = Int(lines[0]), let elapsedMs = Int(lines[1]) else {
+                throw IntegrationError.assert(msg: "unexpected output: \(lines)")
+            }
+            guard hwQueues == queues else {
+                throw IntegrationError.assert(msg: "guest sees \(hwQueues) blk-mq queues, expected \(queues)")
+            }
+
+            let mib = Double(jobs * blocksPerJob * 4) / 1024
+            let throughput = mib / (Double(max(elapsedMs, 1)) / 1000)
+            log.info("virtio-blk \(queues) queue(s), \(jobs) O_DIRECT writers: \(Int(throughput)) MiB/s (\(elapsedMs) ms)")
+        }
+    }
+    #endif
 }
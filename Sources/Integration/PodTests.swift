@@ -2362,5 +2362,64 @@ extension IntegrationSuite {
             throw error
         }
     }
+
+    func testPodHotplugBatch() async throws {
+        let id = "test-pod-hotplug-batch"
+        let bs = try await bootstrap(id)
+
+        let pod = try LinuxPod(id, vmm: bs.vmm) { config in
+            config.cpus = 4
+            config.memoryInBytes = 1024.mib()
+            config.bootLog = bs.bootLog
+        }
+
+        try await pod.addContainer("seed", rootfs: try cloneRootfs(bs.rootfs, testID: id, containerID: "seed")) { config in
+            config.process.arguments = ["/bin/sleep", "infinity"]
+        }
+
+        try await pod.create()
+
+        let ids = (0..<8).map { "sidecar-\($0)" }
+        var buffers: [String: BufferWriter] = [:]
+        var requests: [LinuxPod.ContainerRequest] = []
+        for containerID in ids {
+            let buffer = BufferWriter()
+            buffers[containerID] = buffer
+            requests.append(
+                LinuxPod.ContainerRequest(
+                    id: containerID,
+                    rootfs: try cloneRootfs(bs.rootfs, testID: id, containerID: containerID)
+                ) { config in
+                    config.process.arguments = ["/bin/echo", containerID]
+                    config.process.stdout = buffer
+                })
+        }
+
+        do {
+            let clock = ContinuousClock()
+            let started = clock.now
+            try await pod.addContainers(requests)
+            log.info("hotplugged \(ids.count) containers in \(clock.now - started)")
+
+            for containerID in ids {
+                try await pod.startContainer(containerID)
+                let status = try await pod.waitContainer(containerID)
+                try await pod.stopContainer(containerID)
+
+                guard status.exitCode == 0 else {
+                    throw IntegrationError.assert(msg: "\(containerID) status \(status) != 0")
+                }
+                let output = buffers[containerID].flatMap { String(data: $0.data, encoding: .utf8) }
+                guard output == "\(containerID)\n" else {
+                    throw IntegrationError.assert(
+                        msg: "expected '\(containerID)' from \(containerID), got '\(output ?? "nil")'")
+                }
+            }
+            try await pod.stop()
+        } catch {
+            try? await pod.stop()
+            throw error
+        }
+    }
     #endif
 }
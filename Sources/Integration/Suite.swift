@@ -195,7 +195,7 @@ struct IntegrationSuite: AsyncParsableCommand {
 
     static let eventLoop = MultiThreadedEventLoopGroup(numberOfThreads: System.coreCount)
 
-    func bootstrap(_ testID: String) async throws -> (rootfs: Containerization.Mount, vmm: VirtualMachineManager, image: Containerization.Image, bootLog: BootLog) {
+    func bootstrap(_ testID: String, initArgs: [String] = []) async throws -> (rootfs: Containerization.Mount, vmm: VirtualMachineManager, image: Containerization.Image, bootLog: BootLog) {
         let reference = "ghcr.io/linuxcontainers/alpine:3.20"
         let store = Self.imageStore
 
@@ -217,7 +217,8 @@ struct IntegrationSuite: AsyncParsableCommand {
             }
         }()
 
-        let testKernel = Kernel(path: .init(filePath: kernel), platform: .linuxArm)
+        var testKernel = Kernel(path: .init(filePath: kernel), platform: .linuxArm)
+        testKernel.commandLine.initArgs.append(contentsOf: initArgs)
         // Intentionally NOT adding `debug` or `earlycon=pl011,...` here.
         // Both look free, but each costs real wall-clock per VM boot:
         //   * `debug` floods printk through hvc0 (which CH writes to the
@@ -422,6 +423,7 @@ struct IntegrationSuite: AsyncParsableCommand {
             // Process basics
             Test("process true", testProcessTrue),
             Test("process false", testProcessFalse),
+            Test("process resource usage", testProcessResourceUsage),
             Test("process echo hi", testProcessEchoHi),
             Test("process no executable", testProcessNoExecutable),
             Test("process user", testProcessUser),
@@ -461,6 +463,8 @@ struct IntegrationSuite: AsyncParsableCommand {
             // Stat / Copy
             Test("container stat", testStat),
             Test("container copy in", testCopyIn),
+            Test("io engine io_uring", testIOEngineIOUring),
+            Test("io engine epoll", testIOEngineEpoll),
             Test("container copy in file to existing directory", testCopyInFileToExistingDirectory),
             Test("container copy in file to missing directory fails", testCopyInFileToMissingDirectoryFails),
             Test("container copy in directory over existing file fails", testCopyInDirectoryOverExistingFileFails),
@@ -596,6 +600,8 @@ struct IntegrationSuite: AsyncParsableCommand {
 
                 // Unix socket forwarding (dynamic vsock listen exceeds CH's prebound stdio pool)
                 Test("unix socket into guest", testUnixSocketIntoGuest),
+                Test("port forward tcp", testPortForwardTCP),
+                Test("port forward tcp io_uring", testPortForwardTCPIOUring),
                 Test("unix socket into guest long container id", testUnixSocketIntoGuestLongContainerID),
                 Test("unix socket into guest symlink", testUnixSocketIntoGuestSymlink),
                 Test("pod unix socket into guest symlink", testPodUnixSocketIntoGuestSymlink),
@@ -626,6 +632,9 @@ struct IntegrationSuite: AsyncParsableCommand {
         let linuxOnlyTests: [Test] = [
             Test("pod hotplug block rootfs", testPodHotplugBlockRootfs),
             Test("pod hotplug virtiofs rootfs", testPodHotplugVirtiofsRootfs),
+            Test("pod hotplug batch", testPodHotplugBatch),
+            // virtio queue knobs are CH runtime options.
+            Test("container block multi-queue scaling", testBlockMultiQueueScaling),
         ]
         let tests: [Test] = crossPlatformTests + linuxOnlyTests
         #endif
@@ -275,6 +275,12 @@ extension Application {
         )
         var egress: String?
 
+        @Option(
+            name: .customLong("net-queues"),
+            help: "RX/TX queue pairs for the container TAP (default: 1; values above 1 use a multi-queue TAP)"
+        )
+        var netQueues: Int?
+
         @Flag(name: .customLong("no-network"), help: "Skip all host network setup; container has no interface")
         var noNetwork: Bool = false
 
@@ -332,9 +338,10 @@ extension Application {
             defer { hostTerminal?.tryReset() }
             let sigwinchStream = AsyncSignalHandler.create(notify: [SIGWINCH])
 
-            // Pull the container image and unpack to a per-container ext4 (same
-            // shape as ContainerManager.unpack on macOS: reuse the existing
-            // rootfs.ext4 if it's already there, fresh-unpack otherwise).
+            // Pull the container image and give the container a thin qcow2
+            // overlay over a shared, read-only ext4 base unpacked once per
+            // image (reusing an existing overlay keeps the container's prior
+            // writes, matching ContainerManager's reuse of rootfs.ext4).
             let imageStore = Application.imageStore
             let reference = try Reference.parse(imageReference)
             reference.normalize()
@@ -348,20 +355,13 @@ extension Application {
                 .appendingPathComponent("containers")
                 .appendingPathComponent(id)
             try FileManager.default.createDirectory(at: containersRoot, withIntermediateDirectories: true)
-            let rootfsPath = containersRoot.appendingPathComponent("rootfs.ext4")
-
-            var rootfsMount: Containerization.Mount
-            do {
-                let unpacker = EXT4Unpacker(capacityInBytes: fsSizeInMB.mib())
-                rootfsMount = try await unpacker.unpack(image, for: imagePlatform, at: rootfsPath)
-            } catch let err as ContainerizationError where err.code == .exists {
-                rootfsMount = .block(
-                    format: "ext4",
-                    source: rootfsPath.absolutePath(),
-                    destination: "/",
-                    options: []
-                )
-            }
+            let rootfsPath = containersRoot.appendingPathComponent("rootfs.qcow2")
+
+            let baseStore = try RootfsOverlayStore(
+                root: Application.appRoot.appendingPathComponent("bases"),
+                capacityInBytes: fsSizeInMB.mib()
+            )
+            var rootfsMount = try await baseStore.overlay(for: image, platform: imagePlatform, at: rootfsPath)
             if readOnly {
                 rootfsMount.options.append("ro")
             }
@@ -398,6 +398,8 @@ extension Application {
             var interfaces: [any Interface] = []
             var dnsConfig: DNS? = nil
             var hostsConfig: Hosts? = nil
+            var network: LinuxBridgedNetwork? = nil
+            defer { try? network?.releaseInterface(id) }
 
             if !noNetwork {
                 let subnetCIDR = try CIDRv4(subnet)
@@ -414,13 +416,24 @@ extension Application {
                 )
                 try mgr.create()
 
-                var network = try LinuxBridgedNetwork(
+                // The IPAM journal shares address assignments with every other
+                // `cctl run` on this bridge.
+                var bridged = try LinuxBridgedNetwork(
                     subnet: subnetCIDR,
                     gateway: gw,
                     bridge: bridge,
-                    mtu: 1500
+                    mtu: 1500,
+                    queuePairs: netQueues,
+                    ipamDirectory: LinuxBridgedNetwork.defaultIPAMDirectory
                 )
-                if let iface = try network.createInterface(id) {
+                // A previous run with this id that was killed before it could
+                // release its address would otherwise make allocation fail.
+                // A run with this id that's still going keeps its address,
+                // and allocation fails instead.
+                try? bridged.releaseOrphanedInterface(id)
+                let created = try bridged.createInterface(id)
+                network = bridged
+                if let iface = created {
                     interfaces.append(iface)
 
                     var h = Hosts.default
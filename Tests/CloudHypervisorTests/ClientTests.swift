@@ -303,6 +303,72 @@ struct ClientTests {
         #expect(recorded[0].body.isEmpty)
     }
 
+    // MARK: - vmSnapshot
+
+    @Test("vmSnapshot sends PUT /api/v1/vm.snapshot with destination_url body")
+    func vmSnapshot() async throws {
+        let server = try await StubHTTPServer(eventLoopGroup: Self.group) { _ in
+            StubResponse.status(.noContent)
+        }
+        defer { Task { try? await server.shutdown() } }
+
+        let config = CloudHypervisor.VmSnapshotConfig(destinationUrl: "file:///tmp/snap")
+        let client = try CloudHypervisor.Client(socketPath: URL(filePath: server.socketPath), eventLoopGroup: Self.group)
+        try await client.vmSnapshot(config)
+
+        let recorded = server.recordedRequests()
+        #expect(recorded.count == 1)
+        #expect(recorded[0].method == .PUT)
+        #expect(recorded[0].uri == "/api/v1/vm.snapshot")
+
+        let decoded = try JSONDecoder().decode(CloudHypervisor.VmSnapshotConfig.self, from: recorded[0].body)
+        #expect(decoded == config)
+    }
+
+    // MARK: - vmRestore
+
+    @Test("vmRestore sends PUT /api/v1/vm.restore with source_url body")
+    func vmRestore() async throws {
+        let server = try await StubHTTPServer(eventLoopGroup: Self.group) { _ in
+            StubResponse.status(.noContent)
+        }
+        defer { Task { try? await server.shutdown() } }
+
+        let config = CloudHypervisor.RestoreConfig(sourceUrl: "file:///tmp/snap", prefault: false)
+        let client = try CloudHypervisor.Client(socketPath: URL(filePath: server.socketPath), eventLoopGroup: Self.group)
+        try await client.vmRestore(config)
+
+        let recorded = server.recordedRequests()
+        #expect(recorded.count == 1)
+        #expect(recorded[0].method == .PUT)
+        #expect(recorded[0].uri == "/api/v1/vm.restore")
+
+        let decoded = try JSONDecoder().decode(CloudHypervisor.RestoreConfig.self, from: recorded[0].body)
+        #expect(decoded == config)
+    }
+
+    @Test("vmRestore surfaces a non-2xx response as .http")
+    func vmRestoreFailure() async throws {
+        let body = Data("snapshot not found".utf8)
+        let server = try await StubHTTPServer(eventLoopGroup: Self.group) { _ in
+            StubResponse.status(.internalServerError, body: body)
+        }
+        defer { Task { try? await server.shutdown() } }
+
+        let client = try CloudHypervisor.Client(socketPath: URL(filePath: server.socketPath), eventLoopGroup: Self.group)
+        do {
+            try await client.vmRestore(.init(sourceUrl: "file:///nonexistent"))
+            Issue.record("Expected .http error but call succeeded")
+        } catch let err as CloudHypervisor.Error {
+            guard case .http(let status, let respBody) = err else {
+                Issue.record("Expected .http, got \(err)")
+                return
+            }
+            #expect(status == .internalServerError)
+            #expect(respBody == body)
+        }
+    }
+
     // MARK: - vmAddDisk
 
     @Test("vmAddDisk sends PUT /api/v1/vm.add-disk and returns PciDeviceInfo")
@@ -449,6 +515,124 @@ struct ClientTests {
         }
     }
 
+    // MARK: - Keep-alive
+
+    /// Issues `count` pings and returns the mean latency per call.
+    @discardableResult
+    private func ping(_ client: CloudHypervisor.Client, count: Int) async throws -> Duration {
+        let elapsed = try await ContinuousClock().measure {
+            for _ in 0..<count {
+                _ = try await client.vmmPing()
+            }
+        }
+        return elapsed / count
+    }
+
+    @Test("Sequential requests share one keep-alive connection")
+    func keepAliveReusesConnection() async throws {
+        let expected = CloudHypervisor.VmmPingResponse(version: "v40.0", pid: 1)
+        let server = try await StubHTTPServer(eventLoopGroup: Self.group) { _ in
+            (try? StubResponse.json(expected)) ?? StubResponse.ok()
+        }
+        defer { Task { try? await server.shutdown() } }
+
+        let client = try CloudHypervisor.Client(socketPath: URL(filePath: server.socketPath), eventLoopGroup: Self.group)
+        defer { Task { try? await client.shutdown() } }
+
+        try await ping(client, count: 50)
+
+        let recorded = server.recordedRequests()
+        #expect(recorded.count == 50)
+        #expect(recorded.allSatisfy { !$0.headers["Connection"].contains("close") })
+        #expect(server.acceptedConnections() == 1)
+    }
+
+    @Test("keepAlive: false opens a connection per request")
+    func connectionPerRequest() async throws {
+        let expected = CloudHypervisor.VmmPingResponse(version: "v40.0", pid: 1)
+        let server = try await StubHTTPServer(eventLoopGroup: Self.group) { _ in
+            (try? StubResponse.json(expected)) ?? StubResponse.ok()
+        }
+        defer { Task { try? await server.shutdown() } }
+
+        let client = try CloudHypervisor.Client(
+            socketPath: URL(filePath: server.socketPath),
+            eventLoopGroup: Self.group,
+            keepAlive: false
+        )
+        defer { Task { try? await client.shutdown() } }
+
+        try await ping(client, count: 50)
+
+        let recorded = server.recordedRequests()
+        #expect(recorded.allSatisfy { $0.headers["Connection"] == ["close"] })
+        #expect(server.acceptedConnections() == 50)
+    }
+
+    @Test("Client reconnects after the server drops a keep-alive connection")
+    func keepAliveReconnects() async throws {
+        let expected = CloudHypervisor.VmmPingResponse(version: "v40.0", pid: 1)
+        let server = try await StubHTTPServer(eventLoopGroup: Self.group) { request in
+            guard request.method == .GET else {
+                return StubResponse.status(.noContent)
+            }
+            return (try? StubResponse.json(expected)) ?? StubResponse.ok()
+        }
+        defer { Task { try? await server.shutdown() } }
+
+        let client = try CloudHypervisor.Client(socketPath: URL(filePath: server.socketPath), eventLoopGroup: Self.group)
+        defer { Task { try? await client.shutdown() } }
+
+        try await client.vmPause()
+        #expect(server.acceptedConnections() == 1)
+
+        // Only reads are retried if they race the close, so reconnect with
+        // one before sending another PUT.
+        await server.dropConnections()
+        _ = try await client.vmmPing()
+        try await client.vmResume()
+
+        let recorded = server.recordedRequests()
+        #expect(recorded.map(\.method) == [.PUT, .GET, .PUT])
+        #expect(server.acceptedConnections() == 2)
+    }
+
+    private static let timingEnabled = ProcessInfo.processInfo.environment["ENABLE_TIMING_TESTS"] != nil
+
+    /// Compares mean ping latency with and without keep-alive and prints both.
+    ///
+    /// Run with:
+    ///   ENABLE_TIMING_TESTS=1 swift test --filter ClientTests
+    @Test("Keep-alive latency versus a connection per request", .enabled(if: ClientTests.timingEnabled))
+    func keepAliveLatency() async throws {
+        let expected = CloudHypervisor.VmmPingResponse(version: "v40.0", pid: 1)
+        let server = try await StubHTTPServer(eventLoopGroup: Self.group) { _ in
+            (try? StubResponse.json(expected)) ?? StubResponse.ok()
+        }
+        defer { Task { try? await server.shutdown() } }
+
+        let keepAlive = try CloudHypervisor.Client(socketPath: URL(filePath: server.socketPath), eventLoopGroup: Self.group)
+        defer { Task { try? await keepAlive.shutdown() } }
+        let perRequest = try CloudHypervisor.Client(
+            socketPath: URL(filePath: server.socketPath),
+            eventLoopGroup: Self.group,
+            keepAlive: false
+        )
+        defer { Task { try? await perRequest.shutdown() } }
+
+        // Warm up both clients before measuring.
+        try await ping(keepAlive, count: 10)
+        try await ping(perRequest, count: 10)
+
+        let count = 500
+        let reused = try await ping(keepAlive, count: count)
+        let fresh = try await ping(perRequest, count: count)
+
+        print("\n--- CloudHypervisor.Client vmm.ping, \(count) calls ---\n")
+        print("  Keep-alive:             \(reused) per call")
+        print("  Connection per request: \(fresh) per call")
+    }
+
     // MARK: - Shutdown ordering
 
     /// Regression: with a caller-supplied group, `Client.shutdown()` must
@@ -56,6 +56,9 @@ struct StubResponse: Sendable {
 
 /// An in-process HTTP/1.1 server bound to a Unix Domain Socket, used in tests.
 ///
+/// Connections are kept alive unless the request asks for `Connection:
+/// close`, like CH's own HTTP server.
+///
 /// Example:
 /// ```swift
 /// let server = try await StubHTTPServer(eventLoopGroup: group) { req in
@@ -70,6 +73,10 @@ final class StubHTTPServer: Sendable {
     private let channel: Channel
     /// Recorded requests, protected by a lock so the test thread can read safely.
     private let requests: NIOLockedValueBox<[StubRequest]>
+    /// Total number of connections accepted.
+    private let accepted: NIOLockedValueBox<Int>
+    /// Client connections that are still open.
+    private let connections: NIOLockedValueBox<[ObjectIdentifier: Channel]>
 
     init(
         eventLoopGroup: any EventLoopGroup,
@@ -80,12 +87,20 @@ final class StubHTTPServer: Sendable {
             .path
 
         let requestsBox = NIOLockedValueBox<[StubRequest]>([])
+        let acceptedBox = NIOLockedValueBox(0)
+        let connectionsBox = NIOLockedValueBox<[ObjectIdentifier: Channel]>([:])
 
         let bootstrap = ServerBootstrap(group: eventLoopGroup)
             .serverChannelOption(.backlog, value: 256)
             .serverChannelOption(.socketOption(.so_reuseaddr), value: 1)
             .childChannelInitializer { channel in
-                channel.eventLoop.makeCompletedFuture {
+                let id = ObjectIdentifier(channel)
+                acceptedBox.withLockedValue { $0 += 1 }
+                connectionsBox.withLockedValue { $0[id] = channel }
+                channel.closeFuture.whenComplete { _ in
+                    _ = connectionsBox.withLockedValue { $0.removeValue(forKey: id) }
+                }
+                return channel.eventLoop.makeCompletedFuture {
                     try channel.pipeline.syncOperations.configureHTTPServerPipeline(
                         withPipeliningAssistance: false
                     )
@@ -103,11 +118,15 @@ final class StubHTTPServer: Sendable {
         self.socketPath = sockPath
         self.channel = boundChannel
         self.requests = requestsBox
+        self.accepted = acceptedBox
+        self.connections = connectionsBox
     }
 
-    /// Stop accepting connections and close the listening socket.
+    /// Stop accepting connections, close the listening socket and drop any
+    /// open client connections.
     func shutdown() async throws {
         try await channel.close().get()
+        await dropConnections()
         try? FileManager.default.removeItem(atPath: socketPath)
     }
 
@@ -115,6 +134,19 @@ final class StubHTTPServer: Sendable {
     func recordedRequests() -> [StubRequest] {
         requests.withLockedValue { $0 }
     }
+
+    /// Returns the number of connections accepted so far.
+    func acceptedConnections() -> Int {
+        accepted.withLockedValue { $0 }
+    }
+
+    /// Close every open client connection, as a restarted server would.
+    func dropConnections() async {
+        let open = connections.withLockedValue { Array($0.values) }
+        for connection in open {
+            try? await connection.close().get()
+        }
+    }
 }
 
 // MARK: - StubRequestHandler
@@ -137,6 +169,7 @@ private final class StubRequestHandler: ChannelInboundHandler, @unchecked Sendab
     private var pendingURI: String?
     private var pendingHeaders: HTTPHeaders = [:]
     private var pendingBody: [UInt8] = []
+    private var pendingKeepAlive = true
 
     init(
         userHandler: @escaping @Sendable (StubRequest) -> StubResponse,
@@ -153,6 +186,7 @@ private final class StubRequestHandler: ChannelInboundHandler, @unchecked Sendab
             pendingURI = head.uri
             pendingHeaders = head.headers
             pendingBody = []
+            pendingKeepAlive = head.isKeepAlive
         case .body(var buf):
             if let bytes = buf.readBytes(length: buf.readableBytes) {
                 pendingBody.append(contentsOf: bytes)
@@ -170,14 +204,14 @@ private final class StubRequestHandler: ChannelInboundHandler, @unchecked Sendab
             )
             requests.withLockedValue { $0.append(request) }
             let stubResp = userHandler(request)
-            writeResponse(context: context, response: stubResp)
+            writeResponse(context: context, response: stubResp, keepAlive: pendingKeepAlive)
         }
     }
 
-    private func writeResponse(context: ChannelHandlerContext, response: StubResponse) {
+    private func writeResponse(context: ChannelHandlerContext, response: StubResponse, keepAlive: Bool) {
         var respHeaders = response.headers
         respHeaders.replaceOrAdd(name: "Content-Length", value: "\(response.body.count)")
-        respHeaders.replaceOrAdd(name: "Connection", value: "close")
+        respHeaders.replaceOrAdd(name: "Connection", value: keepAlive ? "keep-alive" : "close")
 
         let head = HTTPResponseHead(version: .http1_1, status: response.status, headers: respHeaders)
         context.write(wrapOutboundOut(.head(head)), promise: nil)
@@ -188,6 +222,11 @@ private final class StubRequestHandler: ChannelInboundHandler, @unchecked Sendab
             context.write(wrapOutboundOut(.body(.byteBuffer(buf))), promise: nil)
         }
 
+        guard !keepAlive else {
+            context.writeAndFlush(wrapOutboundOut(.end(nil)), promise: nil)
+            return
+        }
+
         // Use NIOLoopBound to safely capture `context` in a @Sendable closure.
         // The bound asserts event-loop access; the close runs on the same loop
         // as the flush completion, which is correct.
@@ -72,6 +72,25 @@ struct TypesTests {
         let jsonString = try #require(String(data: data, encoding: .utf8))
         #expect(!jsonString.contains("\"hotplug_size\""))
         #expect(!jsonString.contains("\"mergeable\""))
+        #expect(!jsonString.contains("\"hugepages\""))
+    }
+
+    @Test("MemoryConfig encodes hugepage settings with snake_case keys")
+    func memoryConfigHugepages() throws {
+        let cfg = CloudHypervisor.MemoryConfig(
+            size: UInt64(2) << 30,
+            shared: true,
+            hugepages: true,
+            hugepageSize: UInt64(2) << 20,
+            prefault: true
+        )
+        let data = try JSONEncoder().encode(cfg)
+        let jsonString = try #require(String(data: data, encoding: .utf8))
+        #expect(jsonString.contains("\"hugepages\":true"))
+        #expect(jsonString.contains("\"hugepage_size\":2097152"))
+        #expect(jsonString.contains("\"prefault\":true"))
+        let decoded = try JSONDecoder().decode(CloudHypervisor.MemoryConfig.self, from: data)
+        #expect(decoded == cfg)
     }
 
     @Test("PayloadConfig round-trips through JSON")
@@ -114,7 +133,10 @@ struct TypesTests {
             direct: false,
             iommu: nil,
             id: "disk0",
-            pciSegment: 0
+            pciSegment: 0,
+            numQueues: 4,
+            queueSize: 256,
+            backingFiles: true
         )
         let encoder = JSONEncoder()
         encoder.outputFormatting = [.sortedKeys]
@@ -122,9 +144,12 @@ struct TypesTests {
         let decoded = try JSONDecoder().decode(CloudHypervisor.DiskConfig.self, from: data)
         #expect(decoded == cfg)
 
-        // Verify snake_case key for pci_segment.
+        // Verify snake_case keys.
         let jsonString = try #require(String(data: data, encoding: .utf8))
         #expect(jsonString.contains("\"pci_segment\""))
+        #expect(jsonString.contains("\"num_queues\":4"))
+        #expect(jsonString.contains("\"queue_size\":256"))
+        #expect(jsonString.contains("\"backing_files\":true"))
     }
 
     @Test("DiskConfig omits nil optional fields from JSON")
@@ -137,6 +162,9 @@ struct TypesTests {
         #expect(!jsonString.contains("\"iommu\""))
         #expect(!jsonString.contains("\"id\""))
         #expect(!jsonString.contains("\"pci_segment\""))
+        #expect(!jsonString.contains("\"num_queues\""))
+        #expect(!jsonString.contains("\"queue_size\""))
+        #expect(!jsonString.contains("\"backing_files\""))
     }
 
     @Test("NetConfig round-trips through JSON")
@@ -199,6 +227,31 @@ struct TypesTests {
         #expect(decoded == info)
     }
 
+    // MARK: - Snapshot / Restore
+
+    @Test("VmSnapshotConfig encodes destination_url")
+    func vmSnapshotConfigEncoding() throws {
+        let cfg = CloudHypervisor.VmSnapshotConfig(destinationUrl: "file:///var/snap")
+        let data = try JSONEncoder().encode(cfg)
+        let jsonString = try #require(String(data: data, encoding: .utf8))
+        #expect(jsonString.contains("\"destination_url\""))
+        let decoded = try JSONDecoder().decode(CloudHypervisor.VmSnapshotConfig.self, from: data)
+        #expect(decoded == cfg)
+    }
+
+    @Test("RestoreConfig round-trips through JSON and omits nil prefault")
+    func restoreConfigRoundTrip() throws {
+        let cfg = CloudHypervisor.RestoreConfig(sourceUrl: "file:///var/snap", prefault: true)
+        let data = try JSONEncoder().encode(cfg)
+        let decoded = try JSONDecoder().decode(CloudHypervisor.RestoreConfig.self, from: data)
+        #expect(decoded == cfg)
+
+        let bare = try JSONEncoder().encode(CloudHypervisor.RestoreConfig(sourceUrl: "file:///var/snap"))
+        let jsonString = try #require(String(data: bare, encoding: .utf8))
+        #expect(jsonString.contains("\"source_url\""))
+        #expect(!jsonString.contains("\"prefault\""))
+    }
+
     // MARK: - VmInfo / VmState
 
     @Test("VmState round-trips through JSON with CH literal strings")
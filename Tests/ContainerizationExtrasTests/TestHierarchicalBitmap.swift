@@ -0,0 +1,67 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+@testable import ContainerizationExtras
+
+struct TestHierarchicalBitmap {
+    @Test(arguments: [1, 63, 64, 65, 4096, 4097, 262_145])
+    func testFillsInAscendingOrder(count: Int) {
+        var bitmap = HierarchicalBitmap(count: count)
+        for expected in 0..<count {
+            guard let index = bitmap.firstClear() else {
+                Issue.record("bitmap reported full at \(expected) of \(count)")
+                return
+            }
+            #expect(index == expected)
+            bitmap.set(index)
+        }
+        #expect(bitmap.firstClear() == nil)
+    }
+
+    @Test
+    func testClearReopensFullWords() {
+        var bitmap = HierarchicalBitmap(count: 64 * 64 + 1)
+        for index in 0..<bitmap.count {
+            bitmap.set(index)
+        }
+        #expect(bitmap.firstClear() == nil)
+
+        bitmap.clear(64 * 63 + 5)
+        bitmap.clear(64 * 2 + 1)
+        #expect(!bitmap[64 * 2 + 1])
+        #expect(bitmap.firstClear() == 64 * 2 + 1)
+        bitmap.set(64 * 2 + 1)
+        #expect(bitmap.firstClear() == 64 * 63 + 5)
+        bitmap.set(64 * 63 + 5)
+        #expect(bitmap.firstClear() == nil)
+    }
+
+    @Test
+    func testRedundantSetAndClearKeepSummaryConsistent() {
+        var bitmap = HierarchicalBitmap(count: 128)
+        for index in 0..<64 {
+            bitmap.set(index)
+        }
+        bitmap.set(10)
+        #expect(bitmap.firstClear() == 64)
+        bitmap.clear(100)
+        bitmap.clear(10)
+        bitmap.clear(10)
+        #expect(bitmap.firstClear() == 10)
+    }
+}
@@ -66,6 +66,21 @@ final class TestAddressAllocators {
         }
     }
 
+    @Test
+    func testZeroSizeAllocatorIsFull() throws {
+        let ports = try UInt16.allocator(lower: 5000, size: 0)
+        #expect(throws: AllocatorError.allocatorFull) {
+            _ = try ports.allocate()
+        }
+        #expect(throws: AllocatorError.invalidAddress("5000")) {
+            try ports.reserve(5000)
+        }
+        let vsockPorts = try UInt32.allocator(lower: 5000, size: 0)
+        #expect(throws: AllocatorError.allocatorFull) {
+            _ = try vsockPorts.allocate()
+        }
+    }
+
     @Test
     func testFreeUnallocated() throws {
         let allocator = try IPv4Address.allocator(
@@ -245,4 +260,36 @@ final class TestAddressAllocators {
         let third = try allocator.allocate()
         #expect(third == 5001)
     }
+
+    @Test
+    func testRotatingReserveReleasedUInt32PortAllocator() throws {
+        let allocator = try UInt32.rotatingAllocator(lower: 5000, size: 3)
+        for _ in 0..<3 {
+            _ = try allocator.allocate()
+        }
+        try allocator.release(5000)
+        try allocator.release(5001)
+
+        // Reserving a queued port takes it out of the queue; releasing it
+        // again puts it at the back.
+        try allocator.reserve(5000)
+        try allocator.release(5000)
+        #expect(try allocator.allocate() == 5001)
+        #expect(try allocator.allocate() == 5000)
+        #expect(throws: AllocatorError.allocatorFull) {
+            _ = try allocator.allocate()
+        }
+    }
+
+    @Test
+    func testAllocatorRejectsIndexPastEnd() throws {
+        let indexed = try UInt32.allocator(lower: 5000, size: 3)
+        #expect(throws: AllocatorError.invalidAddress("5003")) {
+            try indexed.reserve(5003)
+        }
+        let rotating = try UInt32.rotatingAllocator(lower: 5000, size: 3)
+        #expect(throws: AllocatorError.invalidAddress("5003")) {
+            try rotating.release(5003)
+        }
+    }
 }
@@ -647,10 +647,111 @@ struct NetlinkSessionTest {
         #expect(links[2].attrDatas[0].attribute.type == 0x0003)
         #expect(links[2].attrDatas[0].attribute.len == 0x0009)
         #expect(links[2].attrDatas[0].data == [0x65, 0x74, 0x68, 0x30, 0x00])
+        #expect(links[2].name == "eth0")
         #expect(links[2].attrDatas[1].attribute.type == 0x000d)
         #expect(links[2].attrDatas[1].attribute.len == 0x0008)
         #expect(links[2].attrDatas[1].data == [0xe8, 0x03, 0x00, 0x00])
     }
+
+    private static let eth0LookupResponse =
+        "2000000010000000000000000cc00cc0"  // Netlink header (16 B)
+        + "00000100020000004310010000000000"  // struct ifinfomsg (16 B) – ifindex 2, no attributes
+
+    private static func ack(rc: String = "00000000") -> String {
+        "2400000002000000000000000cc00cc0"  // Netlink header (16 B)
+            + rc  // nlmsg_err error
+            + "00000000000000000000000000000000"  // echoed request header
+    }
+
+    @Test func testBatchSendsOneRequest() throws {
+        let mockSocket = try MockNetlinkSocket()
+        mockSocket.pid = 0xc00c_c00c
+
+        // eth0 is looked up once; the cached index serves the second request.
+        mockSocket.responses.append([UInt8](hex: Self.eth0LookupResponse))
+        // Both acknowledgements arrive in one datagram.
+        mockSocket.responses.append([UInt8](hex: Self.ack() + Self.ack()))
+
+        let session = NetlinkSession(socket: mockSocket)
+        try session.batch {
+            try session.addressAdd(interface: "eth0", ipv4Address: try CIDRv4("192.168.64.250/24"))
+            try session.linkSet(interface: "eth0", up: true, mtu: 1280)
+        }
+
+        #expect(mockSocket.requests.count == 2)
+        #expect(mockSocket.responseIndex == 2)
+
+        var batch = mockSocket.requests[1]
+        #expect(batch.count == 0x28 + 0x28)
+        // Each message carries its own, consecutive sequence number.
+        func seq(at offset: Int) -> UInt32 {
+            batch[(offset + 8)..<(offset + 12)].reversed().reduce(0) { $0 << 8 | UInt32($1) }
+        }
+        #expect(seq(at: 0x28) == seq(at: 0) &+ 1)
+        batch[8..<12] = [0, 0, 0, 0]
+        batch[0x28 + 8..<0x28 + 12] = [0, 0, 0, 0]
+        let expectedBatch =
+            "2800000014000506000000000cc00cc0"  // RTM_NEWADDR header
+            + "0218000002000000"  // ifaddrmsg: AF_INET, /24, ifindex 2
+            + "08000200c0a840fa"  // IFA_LOCAL
+            + "08000100c0a840fa"  // IFA_ADDRESS
+            + "2800000010000500000000000cc00cc0"  // RTM_NEWLINK header
+            + "110000000200000001000000ffffffff"  // ifinfomsg: ifindex 2, IFF_UP
+            + "0800040000050000"  // IFLA_MTU = 1280
+        #expect(expectedBatch == batch.hexEncodedString())
+    }
+
+    @Test func testBatchReportsFirstErrorAfterDraining() throws {
+        let mockSocket = try MockNetlinkSocket()
+        mockSocket.pid = 0xc00c_c00c
+
+        mockSocket.responses.append([UInt8](hex: Self.eth0LookupResponse))
+        // EEXIST for the address, then a separate datagram for the link ack.
+        mockSocket.responses.append([UInt8](hex: Self.ack(rc: "efffffff")))
+        mockSocket.responses.append([UInt8](hex: Self.ack()))
+
+        let session = NetlinkSession(socket: mockSocket)
+        #expect(throws: NetlinkDataError.responseError(rc: -17)) {
+            try session.batch {
+                try session.addressAdd(interface: "eth0", ipv4Address: try CIDRv4("192.168.64.250/24"))
+                try session.linkSet(interface: "eth0", up: true)
+            }
+        }
+        #expect(mockSocket.requests.count == 2)
+        #expect(mockSocket.responseIndex == 3)
+    }
+
+    @Test func testBatchSendsNothingWhenBodyThrows() throws {
+        let mockSocket = try MockNetlinkSocket()
+        mockSocket.responses.append([UInt8](hex: Self.eth0LookupResponse))
+
+        struct Abandon: Swift.Error {}
+        let session = NetlinkSession(socket: mockSocket)
+        #expect(throws: Abandon.self) {
+            try session.batch {
+                try session.linkSet(interface: "eth0", up: true)
+                throw Abandon()
+            }
+        }
+        // Only the interface lookup went out.
+        #expect(mockSocket.requests.count == 1)
+    }
+
+    @Test func testInterfaceIndexIsCached() throws {
+        let mockSocket = try MockNetlinkSocket()
+        mockSocket.pid = 0xc00c_c00c
+
+        mockSocket.responses.append([UInt8](hex: Self.eth0LookupResponse))
+        mockSocket.responses.append([UInt8](hex: Self.ack()))
+        mockSocket.responses.append([UInt8](hex: Self.ack()))
+
+        let session = NetlinkSession(socket: mockSocket)
+        try session.linkSet(interface: "eth0", up: true)
+        try session.linkSet(interface: "eth0", up: false)
+
+        #expect(mockSocket.requests.count == 3)
+        #expect(mockSocket.responseIndex == 3)
+    }
 }
 
 extension Array where Element == UInt8 {
@@ -0,0 +1,217 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+import ContainerizationExtras
+import Testing
+
+@testable import ContainerizationNetlink
+
+struct NftablesSessionTest {
+    private struct Message {
+        let type: UInt16
+        let flags: UInt16
+        let seq: UInt32
+        let family: UInt8
+        let payload: [UInt8]
+    }
+
+    private static func messages(in batch: [UInt8]) -> [Message] {
+        var messages: [Message] = []
+        var offset = 0
+        while offset + 20 <= batch.count {
+            func u16(_ at: Int) -> UInt16 { UInt16(batch[at]) | UInt16(batch[at + 1]) << 8 }
+            let length = Int(u16(offset)) | Int(u16(offset + 2)) << 16
+            let seq = batch[(offset + 8)..<(offset + 12)].reversed().reduce(UInt32(0)) { $0 << 8 | UInt32($1) }
+            messages.append(
+                Message(
+                    type: u16(offset + 4),
+                    flags: u16(offset + 6),
+                    seq: seq,
+                    family: batch[offset + 16],
+                    payload: Array(batch[(offset + 20)..<(offset + length)])
+                ))
+            offset += length
+        }
+        return messages
+    }
+
+    /// `count` `NLMSG_ERROR` replies carrying `rc`, packed into one datagram.
+    private static func acks(count: Int, rc: Int32 = 0) -> [UInt8] {
+        var reply: [UInt8] = []
+        for seq in 0..<UInt32(count) {
+            reply += withUnsafeBytes(of: UInt32(36).littleEndian, Array.init)
+            reply += withUnsafeBytes(of: NetlinkType.NLMSG_ERROR.littleEndian, Array.init)
+            reply += [0, 1]
+            reply += withUnsafeBytes(of: seq.littleEndian, Array.init)
+            reply += [0, 0, 0, 0]
+            reply += withUnsafeBytes(of: rc.littleEndian, Array.init)
+            reply += [UInt8](repeating: 0, count: 16)
+        }
+        return reply
+    }
+
+    private static func contains(_ haystack: [UInt8], _ needle: [UInt8]) -> Bool {
+        guard haystack.count >= needle.count else { return false }
+        return (0...(haystack.count - needle.count)).contains { Array(haystack[$0..<($0 + needle.count)]) == needle }
+    }
+
+    private static let rules = try! NftablesNATRules(
+        table: "containerization-cz0",
+        subnet: CIDRv4("10.88.0.0/16"),
+        bridge: "cz0",
+        egress: "eth0"
+    )
+
+    @Test func testApplyNATSendsOneBatch() throws {
+        let mockSocket = try MockNetlinkSocket()
+        // Three table messages, two chains and three rules.
+        mockSocket.responses.append(Self.acks(count: 8))
+
+        try NftablesSession(socket: mockSocket).applyNAT(Self.rules)
+
+        #expect(mockSocket.requests.count == 1)
+        let messages = Self.messages(in: mockSocket.requests[0])
+        let nft = NetlinkNetfilter.NFNL_SUBSYS_NFTABLES << 8
+        #expect(
+            messages.map(\.type) == [
+                NetlinkNetfilter.NFNL_MSG_BATCH_BEGIN,
+                nft | NftablesMessageType.NEWTABLE,
+                nft | NftablesMessageType.DELTABLE,
+                nft | NftablesMessageType.NEWTABLE,
+                nft | NftablesMessageType.NEWCHAIN,
+                nft | NftablesMessageType.NEWCHAIN,
+                nft | NftablesMessageType.NEWRULE,
+                nft | NftablesMessageType.NEWRULE,
+                nft | NftablesMessageType.NEWRULE,
+                NetlinkNetfilter.NFNL_MSG_BATCH_END,
+            ])
+
+        // Sequence numbers are consecutive and every inner message asks for an ack.
+        let first = try #require(messages.first)
+        #expect(messages.map(\.seq) == (0..<UInt32(messages.count)).map { first.seq &+ $0 })
+        for message in messages.dropFirst().dropLast() {
+            #expect(message.flags & NetlinkFlags.NLM_F_ACK != 0)
+            #expect(message.family == NetlinkNetfilter.NFPROTO_IPV4)
+        }
+
+        // The masquerade rule matches the subnet (network order) and the
+        // bridge name padded to IFNAMSIZ.
+        let masquerade = messages[6].payload
+        #expect(Self.contains(masquerade, [10, 88, 0, 0]))
+        #expect(Self.contains(masquerade, [255, 255, 0, 0]))
+        #expect(Self.contains(masquerade, Array("cz0".utf8) + [UInt8](repeating: 0, count: 13)))
+        #expect(Self.contains(masquerade, Array("masq\0".utf8)))
+        #expect(Self.contains(messages[8].payload, Array("ct\0".utf8)))
+    }
+
+    @Test func testDeleteTableIsIdempotentBatch() throws {
+        let mockSocket = try MockNetlinkSocket()
+        mockSocket.responses.append(Self.acks(count: 2))
+
+        try NftablesSession(socket: mockSocket).deleteTable("containerization-cz0")
+
+        let nft = NetlinkNetfilter.NFNL_SUBSYS_NFTABLES << 8
+        #expect(
+            Self.messages(in: mockSocket.requests[0]).map(\.type) == [
+                NetlinkNetfilter.NFNL_MSG_BATCH_BEGIN,
+                nft | NftablesMessageType.NEWTABLE,
+                nft | NftablesMessageType.DELTABLE,
+                NetlinkNetfilter.NFNL_MSG_BATCH_END,
+            ])
+    }
+
+    @Test func testBatchErrorIsReported() throws {
+        let mockSocket = try MockNetlinkSocket()
+        // EOPNOTSUPP from a kernel without nf_tables.
+        mockSocket.responses.append(Self.acks(count: 1, rc: -95))
+
+        #expect(throws: NetlinkDataError.responseError(rc: -95)) {
+            try NftablesSession(socket: mockSocket).applyNAT(Self.rules)
+        }
+    }
+
+    /// One `NEWCHAIN` dump reply, as the kernel answers `GETCHAIN`.
+    private static func chain(
+        family: UInt8, table: String, name: String, hook: UInt32? = nil, policy: UInt32? = nil
+    ) -> [UInt8] {
+        var attrs = NetlinkAttributeWriter()
+        attrs.put(NftablesAttribute.CHAIN_TABLE, string: table)
+        attrs.put(NftablesAttribute.CHAIN_NAME, string: name)
+        if let hook {
+            attrs.nest(NftablesAttribute.CHAIN_HOOK) {
+                $0.put(NftablesAttribute.HOOK_HOOKNUM, bigEndian: hook)
+                $0.put(NftablesAttribute.HOOK_PRIORITY, bigEndian: 0)
+            }
+        }
+        if let policy {
+            attrs.put(NftablesAttribute.CHAIN_POLICY, bigEndian: policy)
+        }
+        let type = NetlinkNetfilter.NFNL_SUBSYS_NFTABLES << 8 | NftablesMessageType.NEWCHAIN
+        var reply: [UInt8] = []
+        reply += withUnsafeBytes(of: UInt32(20 + attrs.bytes.count).littleEndian, Array.init)
+        reply += withUnsafeBytes(of: type.littleEndian, Array.init)
+        reply += [2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0]  // NLM_F_MULTI, seq, pid
+        reply += [family, 0, 0, 0]
+        return reply + attrs.bytes
+    }
+
+    @Test func testForeignForwardChainsSkipsOwnTableAndOtherHooks() throws {
+        let mockSocket = try MockNetlinkSocket()
+        let filterForward = Self.chain(
+            family: NetlinkNetfilter.NFPROTO_IPV4, table: "filter", name: "FORWARD",
+            hook: NftablesHook.NF_INET_FORWARD, policy: NftablesVerdict.DROP)
+        let firewalld = Self.chain(
+            family: NetlinkNetfilter.NFPROTO_INET, table: "firewalld", name: "filter_FORWARD",
+            hook: NftablesHook.NF_INET_FORWARD, policy: NftablesVerdict.ACCEPT)
+        let own = Self.chain(
+            family: NetlinkNetfilter.NFPROTO_IPV4, table: "containerization-cz0", name: "forward",
+            hook: NftablesHook.NF_INET_FORWARD, policy: NftablesVerdict.ACCEPT)
+        let postrouting = Self.chain(
+            family: NetlinkNetfilter.NFPROTO_IPV4, table: "nat", name: "POSTROUTING",
+            hook: NftablesHook.NF_INET_POST_ROUTING)
+        let regular = Self.chain(family: NetlinkNetfilter.NFPROTO_IPV4, table: "filter", name: "DOCKER-USER")
+        let ipv6 = Self.chain(
+            family: 10, table: "filter", name: "FORWARD", hook: NftablesHook.NF_INET_FORWARD,
+            policy: NftablesVerdict.DROP)
+        // The dump spans two datagrams; only NLMSG_DONE ends it.
+        mockSocket.responses.append(filterForward + own + postrouting)
+        var done = withUnsafeBytes(of: UInt32(20).littleEndian, Array.init)
+        done += withUnsafeBytes(of: NetlinkType.NLMSG_DONE.littleEndian, Array.init)
+        done += [UInt8](repeating: 0, count: 14)
+        mockSocket.responses.append(regular + ipv6 + firewalld + done)
+
+        let chains = try NftablesSession(socket: mockSocket).foreignForwardChains(excluding: "containerization-cz0")
+
+        #expect(
+            chains == [
+                .init(table: "filter", chain: "FORWARD", dropsByDefault: true),
+                .init(table: "firewalld", chain: "filter_FORWARD", dropsByDefault: false),
+            ])
+        let request = try #require(Self.messages(in: mockSocket.requests[0]).first)
+        #expect(request.type == NetlinkNetfilter.NFNL_SUBSYS_NFTABLES << 8 | NftablesMessageType.GETCHAIN)
+        #expect(request.flags & NetlinkFlags.NLM_F_DUMP == NetlinkFlags.NLM_F_DUMP)
+    }
+
+    @Test func testAttributeWriterPadsAndNests() {
+        var writer = NetlinkAttributeWriter()
+        writer.nest(1) { $0.put(2, string: "ab") }
+        #expect(
+            writer.bytes == [
+                12, 0, 0x01, 0x80,  // nested header, NLA_F_NESTED
+                7, 0, 2, 0, 0x61, 0x62, 0, 0,  // "ab\0" padded to 4
+            ])
+    }
+}
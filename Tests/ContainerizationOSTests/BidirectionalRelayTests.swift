@@ -342,4 +342,122 @@ final class BidirectionalRelayTests {
 
         #expect(completed, "Relay should complete after stop() even when backpressured")
     }
+
+    // MARK: - Test 6: Data integrity
+
+    /// Sets a receive timeout so a stalled relay fails the test instead of hanging it.
+    private func setReceiveTimeout(fd: Int32, seconds: Int) {
+        var tv = timeval(tv_sec: seconds, tv_usec: 0)
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, socklen_t(MemoryLayout<timeval>.size))
+    }
+
+    /// Streams `chunks * chunkSize` bytes of a non-repeating pattern from `writer`
+    /// and verifies every byte read back from `reader`, `readSize` bytes at a time.
+    private func streamPattern(from writer: Int32, to reader: Int32, chunkSize: Int, chunks: Int, readSize: Int) throws {
+        let pattern = (0..<(chunkSize + 251)).map { UInt8(truncatingIfNeeded: $0 % 251) }
+        DispatchQueue.global().async {
+            for i in 0..<chunks {
+                let offset = (i * chunkSize) % 251
+                var sent = 0
+                while sent < chunkSize {
+                    let n = pattern.withUnsafeBufferPointer { buf in
+                        write(writer, buf.baseAddress!.advanced(by: offset + sent), chunkSize - sent)
+                    }
+                    guard n > 0 else { return }
+                    sent += n
+                }
+            }
+        }
+
+        var received = 0
+        var buffer = [UInt8](repeating: 0, count: readSize)
+        while received < chunkSize * chunks {
+            let n = buffer.withUnsafeMutableBufferPointer { buf in
+                read(reader, buf.baseAddress!, buf.count)
+            }
+            try #require(n > 0, "relay stalled after \(received) bytes, errno: \(errno)")
+            let offset = received % 251
+            try #require(buffer[0..<n].elementsEqual(pattern[offset..<offset + n]), "corrupt data at \(received)")
+            received += n
+        }
+    }
+
+    @Test
+    func testDataIntegrityUnderBackpressure() throws {
+        // A small pipe and send buffer keep the destination backing up, and reads of
+        // an odd size drain it unevenly, so staged bytes are partially written and
+        // the ring (or splice pipe on Linux) wraps many times over 4 MiB.
+        let (a0, a1) = try makeSocketPair()
+        let (b0, b1) = try makeSocketPair()
+        defer {
+            close(a0)
+            close(b1)
+        }
+        setSendBufferSize(fd: b0, size: 4096)
+        setReceiveTimeout(fd: b1, seconds: 5)
+
+        let relay = BidirectionalRelay(fd1: a1, fd2: b0, pipeSize: 4096)
+        try relay.start()
+        defer { relay.stop() }
+
+        try streamPattern(from: a0, to: b1, chunkSize: 1 << 16, chunks: 64, readSize: 4093)
+    }
+
+    // MARK: - Test 7: Throughput and latency
+
+    private static let timingEnabled = ProcessInfo.processInfo.environment["ENABLE_TIMING_TESTS"] != nil
+
+    /// Streams 64 MiB one way, then bounces single bytes through both directions,
+    /// and prints the throughput and mean round-trip time.
+    ///
+    /// Run with:
+    ///   ENABLE_TIMING_TESTS=1 swift test --filter BidirectionalRelayTests
+    @Test(.enabled(if: BidirectionalRelayTests.timingEnabled))
+    func testThroughputAndLatency() throws {
+        let (a0, a1) = try makeSocketPair()
+        let (b0, b1) = try makeSocketPair()
+        defer {
+            close(a0)
+            close(b1)
+        }
+        setReceiveTimeout(fd: a0, seconds: 5)
+        setReceiveTimeout(fd: b1, seconds: 5)
+
+        let relay = BidirectionalRelay(fd1: a1, fd2: b0)
+        try relay.start()
+        defer { relay.stop() }
+
+        let clock = ContinuousClock()
+        let chunkSize = 1 << 16
+        let chunks = 1024
+        let streamDuration = try clock.measure {
+            try streamPattern(from: a0, to: b1, chunkSize: chunkSize, chunks: chunks, readSize: chunkSize)
+        }
+
+        // Latency: one-byte round trips through both directions.
+        let roundTrips = 1000
+        var byte: UInt8 = 0
+        let roundTripDuration = try clock.measure {
+            for i in 0..<roundTrips {
+                byte = UInt8(truncatingIfNeeded: i)
+                try #require(write(a0, &byte, 1) == 1)
+                try #require(read(b1, &byte, 1) == 1)
+                try #require(write(b1, &byte, 1) == 1)
+                try #require(read(a0, &byte, 1) == 1)
+                #expect(byte == UInt8(truncatingIfNeeded: i))
+            }
+        }
+
+        let streamSeconds = toSeconds(streamDuration)
+        let mib = Double(chunkSize * chunks) / Double(1 << 20)
+        print("\n--- BidirectionalRelay ---\n")
+        print("  Stream \(String(format: "%.0f", mib)) MiB:      \(streamDuration) (\(String(format: "%.1f", mib / streamSeconds)) MiB/s)")
+        print("  \(roundTrips) round trips:   \(roundTripDuration)")
+        print("  Mean round trip:    \(String(format: "%.1f", toSeconds(roundTripDuration) * 1e6 / Double(roundTrips))) us")
+    }
+
+    private func toSeconds(_ d: Duration) -> Double {
+        let (seconds, attoseconds) = d.components
+        return Double(seconds) + Double(attoseconds) / 1e18
+    }
 }
@@ -0,0 +1,163 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import Testing
+
+@testable import ContainerizationOS
+
+#if canImport(Musl)
+import Musl
+#elseif canImport(Glibc)
+import Glibc
+#elseif canImport(Darwin)
+import Darwin
+#endif
+
+@Suite("Command")
+struct CommandTests {
+    @Test func exitStatusIsReturned() throws {
+        let cmd = Command("/bin/sh", arguments: ["-c", "exit 3"])
+        try cmd.start()
+        #expect(try cmd.wait() == 3)
+    }
+
+    @Test func extraFilesAreMappedAfterStdio() throws {
+        let pipe = Pipe()
+        let cmd = Command("/bin/sh", arguments: ["-c", "echo mapped >&3"], extraFiles: [pipe.fileHandleForWriting])
+        try cmd.start()
+        try pipe.fileHandleForWriting.close()
+
+        let output = try pipe.fileHandleForReading.readToEnd() ?? Data()
+        #expect(try cmd.wait() == 0)
+        #expect(String(decoding: output, as: UTF8.self) == "mapped\n")
+    }
+
+    @Test func missingExecutableThrows() {
+        let cmd = Command("/nonexistent/binary")
+        #expect(throws: POSIXError.self) { try cmd.start() }
+        #expect(cmd.pid == -1)
+    }
+
+    @Test func workingDirectoryIsApplied() throws {
+        let pipe = Pipe()
+        var cmd = Command("/bin/sh", arguments: ["-c", "pwd"], directory: "/")
+        cmd.stdout = pipe.fileHandleForWriting
+        try cmd.start()
+        try pipe.fileHandleForWriting.close()
+
+        let output = try pipe.fileHandleForReading.readToEnd() ?? Data()
+        #expect(try cmd.wait() == 0)
+        #expect(String(decoding: output, as: UTF8.self) == "/\n")
+    }
+
+    @Test func waitForExitReturnsStatus() async throws {
+        let cmd = Command("/bin/sh", arguments: ["-c", "sleep 0.1; exit 5"])
+        try cmd.start()
+        #expect(try await cmd.waitForExit() == 5)
+    }
+
+    @Test func readToEndAsyncDrainsWhileWaiting() async throws {
+        // More than a pipe buffer, so the child only exits if we drain.
+        let pipe = Pipe()
+        var cmd = Command("/bin/sh", arguments: ["-c", "head -c 1048576 /dev/zero"])
+        cmd.stdout = pipe.fileHandleForWriting
+        try cmd.start()
+        try pipe.fileHandleForWriting.close()
+
+        async let output = pipe.fileHandleForReading.readToEndAsync()
+        #expect(try await cmd.waitForExit() == 0)
+        #expect(try await output.count == 1_048_576)
+    }
+
+    @Test func manyConcurrentWaits() async throws {
+        // Far more waits than cooperative threads; none may block one.
+        let count = 200
+        let statuses = try await withThrowingTaskGroup(of: Int32.self) { group in
+            for i in 0..<count {
+                group.addTask {
+                    let pipe = Pipe()
+                    var cmd = Command("/bin/sh", arguments: ["-c", "sleep 0.2; echo \(i)"])
+                    cmd.stdout = pipe.fileHandleForWriting
+                    try cmd.start()
+                    try pipe.fileHandleForWriting.close()
+                    async let output = pipe.fileHandleForReading.readToEndAsync()
+                    let status = try await cmd.waitForExit()
+                    let text = String(decoding: try await output, as: UTF8.self)
+                    return text == "\(i)\n" ? status : -1
+                }
+            }
+            return try await group.reduce(into: []) { $0.append($1) }
+        }
+        #expect(statuses.count == count)
+        #expect(statuses.allSatisfy { $0 == 0 })
+    }
+
+    @Test func waitForExitIsCancellable() async throws {
+        let cmd = Command("/bin/sleep", arguments: ["30"])
+        try cmd.start()
+        defer {
+            cmd.kill(SIGKILL)
+            _ = try? cmd.wait()
+        }
+
+        let waiter = Task { try await cmd.waitForExit() }
+        try await Task.sleep(for: .milliseconds(50))
+        waiter.cancel()
+        await #expect(throws: CancellationError.self) { try await waiter.value }
+    }
+
+    #if os(Linux)
+    private static let timingEnabled = ProcessInfo.processInfo.environment["ENABLE_TIMING_TESTS"] != nil
+
+    /// Spawn latency as this process's resident set grows. The vfork-style
+    /// spawn shares the parent's address space, so the cost should stay flat
+    /// where fork() grows with the page tables it copies.
+    ///
+    /// Run with:
+    ///   ENABLE_TIMING_TESTS=1 swift test --filter CommandTests
+    @Test(.enabled(if: CommandTests.timingEnabled))
+    func spawnLatencyByResidentSize() throws {
+        var ballast: [[UInt8]] = []
+        var baseline: Duration?
+        for megabytes in [0, 256, 1024, 2048] {
+            let grow = megabytes - ballast.count * 256
+            if grow > 0 {
+                for _ in 0..<(grow / 256) {
+                    // Non-zero so every page is touched and resident.
+                    ballast.append([UInt8](repeating: 1, count: 256 << 20))
+                }
+            }
+            let latency = try Self.measureSpawn(iterations: 200)
+            baseline = baseline ?? latency
+            print("spawn at +\(megabytes) MiB RSS: \(latency) per process (\(String(format: "%.2f", latency / baseline!))x)")
+        }
+        withExtendedLifetime(ballast) {}
+    }
+
+    private static func measureSpawn(iterations: Int) throws -> Duration {
+        let clock = ContinuousClock()
+        let elapsed = try clock.measure {
+            for _ in 0..<iterations {
+                let cmd = Command("/bin/true", environment: [])
+                try cmd.start()
+                try cmd.wait()
+            }
+        }
+        return elapsed / iterations
+    }
+    #endif
+}
@@ -0,0 +1,154 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import Testing
+
+@testable import ContainerizationOS
+
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#elseif canImport(Musl)
+import Musl
+#endif
+
+@Suite("DatagramFraming and InetType tests")
+struct DatagramFramingTests {
+    private func frames(_ datagrams: [[UInt8]]) -> [UInt8] {
+        var encoder = DatagramFraming.Encoder()
+        for d in datagrams {
+            #expect(d.withUnsafeBytes { encoder.enqueue($0) })
+        }
+        let (r, w) = makePipe()
+        defer {
+            close(r)
+            close(w)
+        }
+        #expect(encoder.flush(to: w))
+        #expect(encoder.pending == 0)
+        var out = [UInt8](repeating: 0, count: 1 << 16)
+        let n = out.withUnsafeMutableBytes { read(r, $0.baseAddress, $0.count) }
+        return Array(out[0..<max(n, 0)])
+    }
+
+    private func makePipe() -> (Int32, Int32) {
+        var fds: [Int32] = [-1, -1]
+        #expect(pipe(&fds) == 0)
+        return (fds[0], fds[1])
+    }
+
+    @Test
+    func testRoundTripAcrossSplitReads() {
+        let datagrams: [[UInt8]] = [Array("hello".utf8), [], Array(repeating: 0xab, count: 1000)]
+        let stream = frames(datagrams)
+        #expect(stream.count == datagrams.reduce(0) { $0 + $1.count + DatagramFraming.headerSize })
+        #expect(Array(stream[0..<2]) == [0, 5])
+
+        // Feed the stream one byte at a time; datagrams come out whole.
+        var decoder = DatagramFraming.Decoder()
+        var decoded: [[UInt8]] = []
+        for byte in stream {
+            [byte].withUnsafeBytes { decoder.append($0) }
+            while let d = decoder.next() {
+                decoded.append(Array(d))
+            }
+        }
+        #expect(decoded == datagrams)
+    }
+
+    @Test
+    func testEncoderRejectsWithoutQueueing() {
+        var encoder = DatagramFraming.Encoder(capacity: 10)
+        let big = [UInt8](repeating: 1, count: DatagramFraming.maxDatagramSize + 1)
+        #expect(!big.withUnsafeBytes { encoder.enqueue($0) })
+        #expect([UInt8](repeating: 1, count: 8).withUnsafeBytes { encoder.enqueue($0) })
+        #expect(encoder.pending == 10)
+        #expect(![UInt8(1)].withUnsafeBytes { encoder.enqueue($0) })
+        #expect(encoder.pending == 10)
+    }
+
+    @Test
+    func testEncoderKeepsUnwrittenBytes() throws {
+        let (r, w) = makePipe()
+        defer {
+            close(r)
+            close(w)
+        }
+        let flags = fcntl(w, F_GETFL)
+        #expect(fcntl(w, F_SETFL, flags | O_NONBLOCK) == 0)
+
+        // More than a default pipe holds, so the flush stops at EAGAIN.
+        var encoder = DatagramFraming.Encoder(capacity: 1 << 20)
+        let payload = [UInt8](repeating: 7, count: 60_000)
+        for _ in 0..<4 {
+            #expect(payload.withUnsafeBytes { encoder.enqueue($0) })
+        }
+        #expect(encoder.flush(to: w))
+        #expect(encoder.pending > 0)
+
+        var decoder = DatagramFraming.Decoder()
+        var count = 0
+        var buffer = [UInt8](repeating: 0, count: 1 << 16)
+        while count < 4 {
+            let n = buffer.withUnsafeMutableBytes { read(r, $0.baseAddress, $0.count) }
+            try #require(n > 0)
+            buffer.withUnsafeBytes { decoder.append(UnsafeRawBufferPointer(rebasing: $0[0..<n])) }
+            while let d = decoder.next() {
+                #expect(d.count == payload.count)
+                count += 1
+            }
+            #expect(encoder.flush(to: w))
+        }
+        #expect(encoder.pending == 0)
+    }
+
+    @Test
+    func testInetTypeParsesAndFormats() throws {
+        let v4 = try InetType(address: "127.0.0.1", port: 8080)
+        #expect(v4.domain == AF_INET)
+        #expect(v4.description == "127.0.0.1:8080")
+
+        let v6 = try InetType(address: "::1", port: 53)
+        #expect(v6.domain == AF_INET6)
+        #expect(v6.description == "[::1]:53")
+
+        #expect(throws: InetType.Error.self) { try InetType(address: "localhost", port: 80) }
+        #expect(throws: InetType.Error.self) { try InetType(address: "300.1.1.1", port: 80) }
+    }
+
+    @Test
+    func testInetTypeListensAndReportsPeer() throws {
+        let listener = try Socket(type: InetType(address: "127.0.0.1", port: 0))
+        try listener.listen()
+
+        var addr = sockaddr_storage()
+        var len = socklen_t(MemoryLayout<sockaddr_storage>.size)
+        let rc = withUnsafeMutablePointer(to: &addr) {
+            $0.withMemoryRebound(to: sockaddr.self, capacity: 1) { getsockname(listener.fileDescriptor, $0, &len) }
+        }
+        try #require(rc == 0)
+        let bound = try #require(InetType(sockaddr: addr))
+        #expect(bound.address == "127.0.0.1")
+        #expect(bound.port != 0)
+
+        let client = try Socket(type: InetType(address: "127.0.0.1", port: bound.port))
+        try client.connect()
+        let accepted = try listener.accept()
+        #expect(accepted.fileDescriptor >= 0)
+    }
+}
@@ -17,6 +17,7 @@
 #if os(Linux)
 
 import Foundation
+import Synchronization
 import Testing
 
 #if canImport(Musl)
@@ -295,6 +296,214 @@ final class EpollTests {
         try #require(events3 != nil)
         #expect(!events3!.isEmpty, "New write after drain should trigger event")
     }
+
+    @Test
+    func levelTriggeredRefiresUntilDrained() throws {
+        let epoll = try Epoll()
+        let (readFD, writeFD) = try Self.makePipe()
+        defer {
+            close(readFD)
+            close(writeFD)
+        }
+
+        try epoll.add(readFD, mask: .input, trigger: .level)
+
+        var byte: UInt8 = 7
+        _ = write(writeFD, &byte, 1)
+
+        for _ in 0..<3 {
+            let events = epoll.wait(maxEvents: 4, timeout: 1000)
+            try #require(events != nil)
+            #expect(events!.contains { $0.fd == readFD }, "Level triggered should re-fire while data is pending")
+        }
+
+        var buf = [UInt8](repeating: 0, count: 16)
+        _ = read(readFD, &buf, buf.count)
+        let drained = epoll.wait(maxEvents: 4, timeout: 0)
+        try #require(drained != nil)
+        #expect(drained!.isEmpty, "Drained fd should not be reported")
+    }
+
+    @Test
+    func oneShotFiresOnceUntilRearmed() throws {
+        let epoll = try Epoll()
+        let (readFD, writeFD) = try Self.makePipe()
+        defer {
+            close(readFD)
+            close(writeFD)
+        }
+
+        try epoll.add(readFD, mask: .input, trigger: .level, oneShot: true)
+
+        var byte: UInt8 = 7
+        _ = write(writeFD, &byte, 1)
+
+        let first = epoll.wait(maxEvents: 4, timeout: 1000)
+        try #require(first != nil)
+        #expect(first!.count == 1)
+
+        // Data is still pending, but the descriptor is disabled.
+        let second = epoll.wait(maxEvents: 4, timeout: 0)
+        try #require(second != nil)
+        #expect(second!.isEmpty, "One-shot fd should be disabled after its event")
+
+        try epoll.rearm(readFD, mask: .input, trigger: .level)
+        let third = epoll.wait(maxEvents: 4, timeout: 1000)
+        try #require(third != nil)
+        #expect(third!.contains { $0.fd == readFD }, "Rearmed fd should fire again")
+    }
+
+    @Test
+    func waitIntoReusesBatch() throws {
+        let epoll = try Epoll()
+        let (readFD, writeFD) = try Self.makePipe()
+        defer {
+            close(readFD)
+            close(writeFD)
+        }
+
+        try epoll.add(readFD, mask: .input)
+
+        var batch = Epoll.EventBatch(capacity: 8)
+        #expect(epoll.wait(into: &batch, timeout: 0))
+        #expect(batch.isEmpty)
+
+        var byte: UInt8 = 1
+        _ = write(writeFD, &byte, 1)
+        #expect(epoll.wait(into: &batch, timeout: 1000))
+        #expect(batch.count == 1)
+        #expect(batch[0].fd == readFD)
+        #expect(batch[0].mask.readyToRead)
+
+        // No new edge, so the same batch comes back empty.
+        #expect(epoll.wait(into: &batch, timeout: 0))
+        #expect(batch.isEmpty)
+
+        epoll.shutdown()
+        #expect(!epoll.wait(into: &batch, timeout: 0), "wait(into:) should return false after shutdown")
+        #expect(batch.isEmpty)
+    }
+
+    @Suite("Handler table")
+    struct HandlerTableTests {
+        private static func event(_ fd: Int32) -> Epoll.Event {
+            Epoll.Event(fd: fd, mask: .input)
+        }
+
+        @Test
+        func dispatchCallsRegisteredHandlers() throws {
+            let table = EpollHandlerTable<Int>()
+            try table.set(3, 30)
+            try table.set(2000, 20000)
+
+            var seen: [Int] = []
+            table.dispatch([Self.event(3), Self.event(4), Self.event(2000)]) { value, _ in
+                seen.append(value)
+            }
+            #expect(seen == [30, 20000], "Unregistered fds should be skipped")
+        }
+
+        @Test
+        func setReplacesAndRemoveClears() throws {
+            let table = EpollHandlerTable<Int>()
+            try table.set(5, 1)
+            try table.set(5, 2)
+
+            var seen: [Int] = []
+            table.dispatch([Self.event(5)]) { value, _ in seen.append(value) }
+            table.remove(5)
+            table.dispatch([Self.event(5)]) { value, _ in seen.append(value) }
+            #expect(seen == [2])
+        }
+
+        @Test
+        func outOfRangeFDsAreRejected() throws {
+            let table = EpollHandlerTable<Int>(capacity: 16)
+            #expect(throws: POSIXError.self) {
+                try table.set(-1, 0)
+            }
+            #expect(throws: POSIXError.self) {
+                try table.set(Int32(table.capacity), 0)
+            }
+            table.remove(-1)
+            table.remove(Int32(table.capacity))
+        }
+
+        private final class Counter: Sendable {
+            private let count = Atomic<Int>(0)
+
+            var value: Int { count.load(ordering: .relaxed) }
+
+            func increment() {
+                count.add(1, ordering: .relaxed)
+            }
+        }
+
+        private final class Tracker: Sendable {
+            let releases: Counter
+
+            init(_ releases: Counter) {
+                self.releases = releases
+            }
+
+            deinit {
+                releases.increment()
+            }
+        }
+
+        @Test
+        func handlerRemovedDuringDispatchIsReleasedAfterward() throws {
+            let releases = Counter()
+            let table = EpollHandlerTable<@Sendable () -> Void>()
+            do {
+                let tracker = Tracker(releases)
+                try table.set(7) { _ = tracker }
+            }
+            try table.set(8) {}
+
+            var releasedDuringDispatch = -1
+            table.dispatch([Self.event(7), Self.event(8)]) { handler, event in
+                handler()
+                if event.fd == 7 {
+                    table.remove(7)
+                } else {
+                    releasedDuringDispatch = releases.value
+                }
+            }
+            #expect(releasedDuringDispatch == 0, "Removed handler must stay alive until the batch ends")
+            #expect(releases.value == 1, "Removed handler should be released after the batch")
+        }
+
+        @Test
+        func concurrentRegistrationWhileDispatching() async throws {
+            let table = EpollHandlerTable<Int32>()
+            let fds: [Int32] = Array(0..<64)
+            let stop = Counter()
+
+            await withTaskGroup(of: Void.self) { group in
+                group.addTask {
+                    var round = 0
+                    while stop.value == 0 {
+                        for fd in fds {
+                            if (Int(fd) + round) % 2 == 0 {
+                                try? table.set(fd, fd)
+                            } else {
+                                table.remove(fd)
+                            }
+                        }
+                        round += 1
+                    }
+                }
+                let events = fds.map { Self.event($0) }
+                for _ in 0..<2000 {
+                    table.dispatch(events) { value, event in
+                        #expect(value == event.fd)
+                    }
+                }
+                stop.increment()
+            }
+        }
+    }
 }
 
 #endif  // os(Linux)
@@ -0,0 +1,67 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+@testable import ContainerizationOS
+
+#if canImport(Musl)
+import Musl
+#elseif canImport(Glibc)
+import Glibc
+#elseif canImport(Darwin)
+import Darwin
+#endif
+
+struct ResourceUsageTests {
+    @Test func convertsRusage() {
+        var rus = rusage()
+        rus.ru_utime.tv_sec = 1
+        rus.ru_utime.tv_usec = 250_000
+        rus.ru_stime.tv_usec = 500
+        rus.ru_maxrss = 2048
+        rus.ru_minflt = 10
+        rus.ru_majflt = 2
+        rus.ru_nvcsw = 7
+        rus.ru_nivcsw = 3
+        rus.ru_inblock = 8
+        rus.ru_oublock = 16
+
+        let usage = ResourceUsage(rus)
+        #expect(usage.userTime == .milliseconds(1250))
+        #expect(usage.systemTime == .microseconds(500))
+        #expect(usage.cpuTime == .microseconds(1_250_500))
+        #if os(Linux)
+        #expect(usage.maxRSSBytes == 2048 * 1024)
+        #else
+        #expect(usage.maxRSSBytes == 2048)
+        #endif
+        #expect(usage.minorPageFaults == 10)
+        #expect(usage.majorPageFaults == 2)
+        #expect(usage.voluntaryContextSwitches == 7)
+        #expect(usage.involuntaryContextSwitches == 3)
+        #expect(usage.blockInputOps == 8)
+        #expect(usage.blockOutputOps == 16)
+    }
+
+    @Test func selfUsageIsPlausible() {
+        var rus = rusage()
+        #expect(getrusage(RUSAGE_SELF, &rus) == 0)
+        let usage = ResourceUsage(rus)
+        #expect(usage.maxRSSBytes > 0)
+        #expect(usage.cpuTime > .zero)
+    }
+}
@@ -0,0 +1,99 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+
+import Foundation
+import Testing
+
+@testable import Containerization
+
+@Suite("BootTrace")
+struct BootTraceTests {
+    @Test("events encode as Chrome trace events with per-lane pid/tid")
+    func chromeEncoding() throws {
+        let trace = BootTrace(traceEvents: [
+            .init(name: "vmBoot", lane: .vmm, kind: .complete, timestamp: 100, duration: 50),
+            .init(name: "serving", lane: .guest, kind: .instant, timestamp: 7),
+        ])
+
+        let json = try #require(JSONSerialization.jsonObject(with: trace.jsonData()) as? [String: Any])
+        let events = try #require(json["traceEvents"] as? [[String: Any]])
+        #expect(json["displayTimeUnit"] as? String == "ms")
+
+        #expect(events[0]["ph"] as? String == "X")
+        #expect(events[0]["cat"] as? String == "vmm")
+        #expect(events[0]["ts"] as? Int == 100)
+        #expect(events[0]["dur"] as? Int == 50)
+        #expect(events[0]["pid"] as? Int == 1)
+        #expect(events[0]["tid"] as? Int == 2)
+
+        #expect(events[1]["ph"] as? String == "i")
+        #expect(events[1]["pid"] as? Int == 2)
+        #expect(events[1]["dur"] == nil)
+
+        let decoded = try JSONDecoder().decode(BootTrace.self, from: trace.jsonData())
+        #expect(decoded == trace)
+    }
+
+    @Test("merging shifts guest events so the anchors line up at the RPC midpoint")
+    func mergeAlignsClocks() {
+        let host = BootTrace(traceEvents: [
+            .init(name: "vm.start", lane: .container, kind: .complete, timestamp: 10_000, duration: 500),
+            .init(name: BootTrace.clockAnchorEvent, lane: .container, kind: .complete, timestamp: 20_000, duration: 200),
+        ])
+        let guest = BootTrace(traceEvents: [
+            .init(name: "kernel", lane: .guest, kind: .complete, timestamp: 0, duration: 300),
+            .init(name: BootTrace.clockAnchorEvent, lane: .guest, kind: .instant, timestamp: 9_000),
+        ])
+
+        let merged = host.merging(guest: guest)
+        let kernel = merged.traceEvents.first { $0.name == "kernel" }
+        let anchor = merged.traceEvents.first { $0.name == BootTrace.clockAnchorEvent && $0.lane == .guest }
+
+        #expect(anchor?.timestamp == 20_100)
+        #expect(kernel?.timestamp == 11_100)
+        #expect(merged.traceEvents.map(\.timestamp) == merged.traceEvents.map(\.timestamp).sorted())
+    }
+
+    @Test("merging without an anchor appends guest events unshifted")
+    func mergeWithoutAnchor() {
+        let host = BootTrace(traceEvents: [.init(name: "create", lane: .container, kind: .complete, timestamp: 5, duration: 1)])
+        let guest = BootTrace(traceEvents: [.init(name: "serving", lane: .guest, kind: .instant, timestamp: 3)])
+
+        let merged = host.merging(guest: guest)
+        #expect(merged.traceEvents.count == 2)
+        #expect(merged.traceEvents.first { $0.lane == .guest }?.timestamp == 3)
+    }
+
+    @Test("recorder spans are recorded even when the body throws")
+    func recorderSpan() async {
+        struct Failure: Error {}
+        let recorder = BootTraceRecorder()
+
+        let value = await recorder.span("ok", lane: .container) { 42 }
+        await #expect(throws: Failure.self) {
+            try await recorder.span("fails", lane: .vmm) { throw Failure() }
+        }
+        recorder.instant("mark", lane: .guest)
+
+        #expect(value == 42)
+        let events = recorder.trace.traceEvents
+        #expect(events.map(\.name) == ["ok", "fails", "mark"])
+        #expect(events.allSatisfy { $0.kind == .instant || ($0.duration ?? -1) >= 0 })
+        #expect(recorder.contains("fails"))
+        #expect(!recorder.contains("missing"))
+    }
+}
@@ -0,0 +1,197 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+#if os(Linux)
+import ContainerizationExtras
+import Foundation
+import Testing
+
+@testable import Containerization
+
+@Suite("Bridge IPAM journal")
+struct BridgeIPAMJournalTests {
+    private static func withDirectory(_ body: (URL) throws -> Void) throws {
+        let dir = FileManager.default.uniqueTemporaryDirectory(create: true)
+        defer { try? FileManager.default.removeItem(at: dir) }
+        try body(dir)
+    }
+
+    private static func commit(_ journal: BridgeIPAMJournal, _ entries: [BridgeIPAMJournal.Entry]) throws {
+        try journal.transaction { _, commit in
+            for entry in entries {
+                try commit(entry)
+            }
+        }
+    }
+
+    @Test("record encoding round-trips and stops at a torn tail")
+    func encoding() {
+        let entries: [BridgeIPAMJournal.Entry] = [
+            .allocate(id: "a", address: 0x0a00_0002),
+            .release(id: "a", address: 0x0a00_0002),
+            .allocate(id: "ü-container", address: 0x0a00_0003),
+        ]
+        let bytes = entries.flatMap(BridgeIPAMJournal.encode)
+        #expect(BridgeIPAMJournal.decodeEntries(bytes[...]).entries == entries)
+
+        let torn = bytes.dropLast(3)
+        let decoded = BridgeIPAMJournal.decodeEntries(torn)
+        #expect(decoded.entries == Array(entries.prefix(2)))
+        #expect(decoded.consumed == bytes.count - BridgeIPAMJournal.encode(entries[2]).count)
+
+        var corrupt = bytes
+        corrupt[1] ^= 0xff
+        #expect(BridgeIPAMJournal.decodeEntries(corrupt[...]).entries.isEmpty)
+    }
+
+    @Test("assignments survive reopening the journal")
+    func recovery() throws {
+        try Self.withDirectory { dir in
+            do {
+                let journal = try BridgeIPAMJournal(directory: dir, bridge: "cz0")
+                try Self.commit(
+                    journal,
+                    [
+                        .allocate(id: "a", address: 2),
+                        .allocate(id: "b", address: 3),
+                        .release(id: "a", address: 2),
+                    ])
+            }
+
+            let reopened = try BridgeIPAMJournal(directory: dir, bridge: "cz0")
+            let changes = try reopened.transaction { changes, _ in changes }
+            guard case .reload(let live) = changes else {
+                Issue.record("expected a reload on first transaction, got \(changes)")
+                return
+            }
+            #expect(live == ["b": 3])
+        }
+    }
+
+    @Test("a second journal on the same bridge sees the first one's records")
+    func sharedBridge() throws {
+        try Self.withDirectory { dir in
+            let first = try BridgeIPAMJournal(directory: dir, bridge: "cz0")
+            let second = try BridgeIPAMJournal(directory: dir, bridge: "cz0")
+            try Self.commit(first, [])
+            try Self.commit(second, [])
+
+            try Self.commit(first, [.allocate(id: "a", address: 2)])
+            let changes = try second.transaction { changes, _ in changes }
+            guard case .entries(let entries) = changes else {
+                Issue.record("expected incremental entries, got \(changes)")
+                return
+            }
+            #expect(entries == [.allocate(id: "a", address: 2)])
+            #expect(second.allocations == ["a": 2])
+        }
+    }
+
+    @Test("a torn record at the tail is dropped on recovery")
+    func tornTail() throws {
+        try Self.withDirectory { dir in
+            let journal = try BridgeIPAMJournal(directory: dir, bridge: "cz0")
+            try Self.commit(journal, [.allocate(id: "a", address: 2)])
+
+            let handle = try #require(FileHandle(forWritingAtPath: journal.logPath))
+            try handle.seekToEnd()
+            try handle.write(contentsOf: BridgeIPAMJournal.encode(.allocate(id: "b", address: 3)).dropLast(2))
+            try handle.close()
+
+            let reopened = try BridgeIPAMJournal(directory: dir, bridge: "cz0")
+            try Self.commit(reopened, [.allocate(id: "c", address: 4)])
+            #expect(reopened.allocations == ["a": 2, "c": 4])
+
+            let again = try BridgeIPAMJournal(directory: dir, bridge: "cz0")
+            try Self.commit(again, [])
+            #expect(again.allocations == ["a": 2, "c": 4])
+        }
+    }
+
+    @Test("compaction snapshots live assignments and other journals reload")
+    func compaction() throws {
+        try Self.withDirectory { dir in
+            let writer = try BridgeIPAMJournal(directory: dir, bridge: "cz0", compactAfter: 8)
+            let reader = try BridgeIPAMJournal(directory: dir, bridge: "cz0")
+            try Self.commit(reader, [])
+
+            for i in 0..<10 {
+                let id = "c\(i)"
+                try Self.commit(writer, [.allocate(id: id, address: UInt32(i))])
+                if i % 2 == 0 {
+                    try Self.commit(writer, [.release(id: id, address: UInt32(i))])
+                }
+            }
+            #expect(FileManager.default.fileExists(atPath: writer.snapshotPath))
+
+            let expected: [String: UInt32] = ["c1": 1, "c3": 3, "c5": 5, "c7": 7, "c9": 9]
+            let changes = try reader.transaction { changes, _ in changes }
+            guard case .reload(let live) = changes else {
+                Issue.record("expected a reload after compaction, got \(changes)")
+                return
+            }
+            #expect(live == expected)
+
+            let reopened = try BridgeIPAMJournal(directory: dir, bridge: "cz0")
+            try Self.commit(reopened, [])
+            #expect(reopened.allocations == expected)
+        }
+    }
+
+    @Test("a log newer than the snapshot is replayed, not dropped")
+    func lostSnapshotRename() throws {
+        try Self.withDirectory { dir in
+            do {
+                let journal = try BridgeIPAMJournal(directory: dir, bridge: "cz0", compactAfter: 2)
+                try Self.commit(journal, [.allocate(id: "a", address: 2), .allocate(id: "b", address: 3)])
+                try Self.commit(journal, [.allocate(id: "c", address: 4)])
+                // Simulate a crash that kept the log reset but lost the
+                // snapshot's rename.
+                try FileManager.default.removeItem(atPath: journal.snapshotPath)
+            }
+
+            let reopened = try BridgeIPAMJournal(directory: dir, bridge: "cz0")
+            try Self.commit(reopened, [.allocate(id: "d", address: 5)])
+            #expect(reopened.allocations == ["c": 4, "d": 5])
+        }
+    }
+
+    @Test("bridged-network allocators sharing a journal hand out distinct addresses")
+    func allocatorsShareJournal() throws {
+        try Self.withDirectory { dir in
+            let cidr = try CIDRv4("10.88.0.0/24")
+            var first = try LinuxBridgedNetwork.Allocator(
+                cidr: cidr, journal: try BridgeIPAMJournal(directory: dir, bridge: "cz0"))
+            var second = try LinuxBridgedNetwork.Allocator(
+                cidr: cidr, journal: try BridgeIPAMJournal(directory: dir, bridge: "cz0"))
+
+            let a = try first.allocate("a")
+            let b = try second.allocate("b")
+            #expect(a != b)
+            #expect(throws: (any Error).self) {
+                _ = try second.allocate("a")
+            }
+
+            // A restarted process can release what an earlier one allocated.
+            var restarted = try LinuxBridgedNetwork.Allocator(
+                cidr: cidr, journal: try BridgeIPAMJournal(directory: dir, bridge: "cz0"))
+            try restarted.release("a")
+            let again = try second.allocate("a")
+            #expect(again != b)
+        }
+    }
+}
+#endif
@@ -51,6 +51,22 @@ struct BridgeStateFileTests {
         #expect(s.egressInterface == "eth0")
     }
 
+    @Test("round-trip JSON encode/decode (nftables backend)")
+    func roundTripNftables() throws {
+        let s = BridgeState(natEnabled: true, prevIpForward: "1", egressInterface: "eth0", natBackend: .nftables)
+        let s2 = try BridgeState.decode(try s.encode())
+        #expect(s2.natBackend == .nftables)
+    }
+
+    @Test("legacy state file without natBackend defaults to iptables")
+    func legacyDefaultsToIptables() throws {
+        let legacy = #"{"natEnabled":true,"prevIpForward":"0","egressInterface":"eth0"}"#
+        #expect(try BridgeState.decode(Data(legacy.utf8)).natBackend == .iptables)
+
+        let noNAT = #"{"natEnabled":false}"#
+        #expect(try BridgeState.decode(Data(noNAT.utf8)).natBackend == nil)
+    }
+
     @Test("decode rejects malformed input")
     func malformed() {
         #expect(throws: (any Error).self) {
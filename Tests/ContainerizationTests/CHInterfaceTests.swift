@@ -16,6 +16,7 @@
 
 #if os(Linux)
 import CloudHypervisor
+import ContainerizationError
 import ContainerizationExtras
 import Testing
 
@@ -56,6 +57,25 @@ struct CHInterfaceTests {
         #expect(cfg.mtu == 1500)
     }
 
+    @Test("chNetConfig maps queue pairs to CH's RX+TX queue count")
+    func chNetConfigQueues() throws {
+        let cidr = try CIDRv4("10.0.0.5/24")
+        let single = try TAPInterface(tapName: "tap0", ipv4Address: cidr).chNetConfig()
+        #expect(single.numQueues == nil)
+        #expect(single.queueSize == nil)
+
+        let multi = try TAPInterface(tapName: "tap0", ipv4Address: cidr, queuePairs: 4, queueSize: 512).chNetConfig()
+        #expect(multi.numQueues == 8)
+        #expect(multi.queueSize == 512)
+
+        #expect(throws: ContainerizationError.self) {
+            try TAPInterface(tapName: "tap0", ipv4Address: cidr, queuePairs: 0).chNetConfig()
+        }
+        #expect(throws: ContainerizationError.self) {
+            try TAPInterface(tapName: "tap0", ipv4Address: cidr, queueSize: 100).chNetConfig()
+        }
+    }
+
     @Test("TAPInterface satisfies Interface")
     func interfaceConformance() throws {
         let cidr = try CIDRv4("192.168.64.3/24")
@@ -0,0 +1,76 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+#if os(Linux)
+import Testing
+
+@testable import Containerization
+
+@Suite("CH memory backing")
+struct CHMemoryBackingTests {
+    private static let gib: UInt64 = 1 << 30
+
+    @Test("standard backing never consults the hugepage pool")
+    func standardPassesThrough() {
+        let backing = CHVirtualMachineInstance.effectiveMemoryBacking(
+            .standard,
+            memoryInBytes: Self.gib,
+            availableHugepages: { _ in
+                Issue.record("pool should not be read")
+                return nil
+            }
+        )
+        #expect(backing == .standard)
+    }
+
+    @Test("hugepages are kept when the pool covers all of guest memory")
+    func sufficientPool() {
+        let requested = MemoryBacking.hugepages(.twoMiB, prefault: true)
+        let backing = CHVirtualMachineInstance.effectiveMemoryBacking(
+            requested,
+            memoryInBytes: Self.gib,
+            availableHugepages: { _ in 512 }
+        )
+        #expect(backing == requested)
+    }
+
+    @Test(
+        "an insufficient or missing pool falls back to standard pages",
+        arguments: [UInt64?.none, 0, 511]
+    )
+    func insufficientPool(available: UInt64?) {
+        let backing = CHVirtualMachineInstance.effectiveMemoryBacking(
+            .hugepages(.twoMiB, prefault: true),
+            memoryInBytes: Self.gib,
+            availableHugepages: { _ in available }
+        )
+        #expect(backing == MemoryBacking(hugepageSize: nil, prefault: true))
+    }
+
+    @Test("1 GiB hugepages round guest memory up to whole pages")
+    func oneGiBAlignment() {
+        #expect(CHVirtualMachineInstance.alignMemorySize(Self.gib + 1, to: Self.gib) == 2 * Self.gib)
+        #expect(CHVirtualMachineInstance.alignMemorySize(Self.gib + 1) == Self.gib + 2 * 1024 * 1024)
+
+        let backing = CHVirtualMachineInstance.effectiveMemoryBacking(
+            .hugepages(.oneGiB),
+            memoryInBytes: Self.gib + 1,
+            availableHugepages: { _ in 1 }
+        )
+        #expect(backing.hugepageSize == nil)
+    }
+}
+#endif
@@ -0,0 +1,120 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+#if os(Linux)
+import CloudHypervisor
+import Foundation
+import Testing
+
+@testable import Containerization
+
+@Suite("CHSnapshotTemplate")
+struct CHSnapshotTemplateTests {
+    private static let commandLine = Kernel(path: URL(fileURLWithPath: "/boot/vmlinux"), platform: .linuxArm)
+        .linuxCommandline(initialFilesystem: .block(format: "ext4", source: "/var/init.ext4", destination: "/"))
+
+    private func makeTemplate(in dir: URL) throws -> CHSnapshotTemplate {
+        try FileManager.default.createDirectory(at: dir, withIntermediateDirectories: true)
+        let config: [String: Any] = [
+            "cpus": ["boot_vcpus": 2, "max_vcpus": 2],
+            "vsock": ["cid": 3, "socket": "/run/template/vsock.sock"],
+            "console": ["mode": "File", "file": "/run/template/boot.log"],
+        ]
+        try JSONSerialization.data(withJSONObject: config)
+            .write(to: dir.appendingPathComponent("config.json"))
+        try Data("{}".utf8).write(to: dir.appendingPathComponent("state.json"))
+        try Data(count: 4096).write(to: dir.appendingPathComponent("memory-ranges"))
+        return CHSnapshotTemplate(
+            directory: dir,
+            cpus: 2,
+            memoryInBytes: 512 * 1024 * 1024,
+            kernelPath: "/boot/vmlinux",
+            kernelCommandLine: Self.commandLine,
+            initialFilesystemSource: "/var/init.ext4"
+        )
+    }
+
+    private func instanceConfig(cpus: Int = 2, memory: UInt64 = 512 * 1024 * 1024) -> CHVirtualMachineInstance.Configuration {
+        var config = CHVirtualMachineInstance.Configuration()
+        config.cpus = cpus
+        config.memoryInBytes = memory
+        config.kernel = Kernel(path: URL(fileURLWithPath: "/boot/vmlinux"), platform: .linuxArm)
+        config.initialFilesystem = .block(format: "ext4", source: "/var/init.ext4", destination: "/")
+        return config
+    }
+
+    @Test("materialize rewrites the vsock socket and console and links shared files")
+    func materializeRewritesConfig() throws {
+        let root = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer { try? FileManager.default.removeItem(at: root) }
+        let template = try makeTemplate(in: root.appendingPathComponent("template"))
+
+        let cloneDir = root.appendingPathComponent("clone")
+        let vsock = root.appendingPathComponent("vm1/vsock.sock")
+        let result = try template.materialize(into: cloneDir, vsockSocket: vsock, console: .init(mode: .Null))
+        #expect(result == cloneDir)
+
+        let data = try Data(contentsOf: cloneDir.appendingPathComponent("config.json"))
+        let json = try #require(try JSONSerialization.jsonObject(with: data) as? [String: Any])
+        let vsockJSON = try #require(json["vsock"] as? [String: Any])
+        #expect(vsockJSON["socket"] as? String == vsock.path)
+        #expect(vsockJSON["cid"] as? Int == 3)
+        let consoleJSON = try #require(json["console"] as? [String: Any])
+        #expect(consoleJSON["mode"] as? String == "Null")
+        #expect(consoleJSON["file"] is NSNull)
+        #expect(json["cpus"] != nil)
+
+        let memory = try FileManager.default.destinationOfSymbolicLink(
+            atPath: cloneDir.appendingPathComponent("memory-ranges").path
+        )
+        #expect(memory == template.directory.appendingPathComponent("memory-ranges").path)
+    }
+
+    @Test("manifest round-trips through load(from:)")
+    func manifestRoundTrip() throws {
+        let root = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer { try? FileManager.default.removeItem(at: root) }
+        let template = try makeTemplate(in: root)
+        try template.writeManifest()
+        #expect(try CHSnapshotTemplate.load(from: root) == template)
+    }
+
+    @Test("matches requires the same shape")
+    func matchesShape() throws {
+        let template = CHSnapshotTemplate(
+            directory: URL(fileURLWithPath: "/tmp/unused"),
+            cpus: 2,
+            memoryInBytes: 512 * 1024 * 1024,
+            kernelPath: "/boot/vmlinux",
+            kernelCommandLine: Self.commandLine,
+            initialFilesystemSource: "/var/init.ext4"
+        )
+        #expect(template.matches(instanceConfig()))
+        // Memory is compared after CH's 2 MiB alignment.
+        #expect(template.matches(instanceConfig(memory: 512 * 1024 * 1024 - 4096)))
+        #expect(!template.matches(instanceConfig(cpus: 4)))
+        #expect(!template.matches(instanceConfig(memory: 1024 * 1024 * 1024)))
+
+        var otherKernel = instanceConfig()
+        otherKernel.kernel = Kernel(path: URL(fileURLWithPath: "/boot/other"), platform: .linuxArm)
+        #expect(!template.matches(otherKernel))
+
+        var otherArgs = instanceConfig()
+        otherArgs.kernel?.commandLine.initArgs = ["--io-engine", "io-uring"]
+        #expect(!template.matches(otherArgs))
+    }
+}
+#endif
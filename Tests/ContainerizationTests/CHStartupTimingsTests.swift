@@ -0,0 +1,35 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+@testable import Containerization
+
+@Suite("CHStartupTimings")
+struct CHStartupTimingsTests {
+    @Test("record accumulates repeated phases and leaves skipped phases absent")
+    func recordAccumulates() {
+        var timings = CHStartupTimings()
+        timings.record(.deviceAttach, .milliseconds(3))
+        timings.record(.deviceAttach, .milliseconds(4))
+        timings.record(.vmmSpawn, .milliseconds(20))
+
+        #expect(timings[.deviceAttach] == .milliseconds(7))
+        #expect(timings[.vmmSpawn] == .milliseconds(20))
+        #expect(timings[.vmBoot] == nil)
+        #expect(timings.total == .zero)
+    }
+}
@@ -0,0 +1,140 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+#if os(Linux)
+import Foundation
+import Synchronization
+import Testing
+
+@testable import Containerization
+
+@Suite("CHWarmPool")
+struct CHWarmPoolTests {
+    /// Builds instances without starting them; nothing here needs a real
+    /// cloud-hypervisor binary.
+    private static func unstartedInstance(_ shape: CHWarmPool.Shape, root: URL) throws -> CHVirtualMachineInstance {
+        var config = CHVirtualMachineInstance.Configuration()
+        config.cpus = shape.cpus
+        config.memoryInBytes = shape.memoryInBytes
+        return try CHVirtualMachineInstance(
+            group: nil,
+            config: config,
+            runtimeRoot: root,
+            chBinary: URL(fileURLWithPath: "/nonexistent/cloud-hypervisor"),
+            virtiofsdBinary: nil,
+            logger: nil
+        )
+    }
+
+    @Test("Shape aligns memory like the VmConfig builder")
+    func shapeAlignsMemory() {
+        let a = CHWarmPool.Shape(cpus: 2, memoryInBytes: 512 * 1024 * 1024 - 1)
+        let b = CHWarmPool.Shape(cpus: 2, memoryInBytes: 512 * 1024 * 1024)
+        #expect(a == b)
+    }
+
+    @Test("fill boots up to the target for each shape")
+    func fillReachesTarget() async throws {
+        let root = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer { try? FileManager.default.removeItem(at: root) }
+
+        let small = CHWarmPool.Shape(cpus: 1, memoryInBytes: 256 * 1024 * 1024)
+        let large = CHWarmPool.Shape(cpus: 4, memoryInBytes: 2048 * 1024 * 1024)
+        let boots = Mutex(0)
+        let pool = CHWarmPool(
+            config: .init(targets: [small: 2, large: 1], minimumBootInterval: .milliseconds(1)),
+            logger: nil
+        ) { shape in
+            boots.withLock { $0 += 1 }
+            return try Self.unstartedInstance(shape, root: root)
+        }
+        await pool.fill()
+
+        try await waitFor {
+            let smallReady = await pool.available(small)
+            let largeReady = await pool.available(large)
+            return smallReady == 2 && largeReady == 1
+        }
+        #expect(boots.withLock { $0 } == 3)
+        await pool.shutdown()
+    }
+
+    @Test("take discards VMs that are not running and replenishes")
+    func takeDiscardsDeadVMs() async throws {
+        let root = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer { try? FileManager.default.removeItem(at: root) }
+
+        let shape = CHWarmPool.Shape(cpus: 1, memoryInBytes: 256 * 1024 * 1024)
+        let boots = Mutex(0)
+        let pool = CHWarmPool(
+            config: .init(targets: [shape: 1], minimumBootInterval: .milliseconds(1)),
+            logger: nil
+        ) { shape in
+            boots.withLock { $0 += 1 }
+            return try Self.unstartedInstance(shape, root: root)
+        }
+        await pool.fill()
+        try await waitFor { await pool.available(shape) == 1 }
+
+        // Unstarted instances report `.stopped`, so none can be handed out.
+        #expect(await pool.take(shape) == nil)
+        try await waitFor { await pool.available(shape) == 1 }
+        #expect(boots.withLock { $0 } == 2)
+        await pool.shutdown()
+    }
+
+    @Test("background boots are spaced by the minimum boot interval")
+    func bootsAreRateLimited() async throws {
+        let root = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer { try? FileManager.default.removeItem(at: root) }
+
+        let shape = CHWarmPool.Shape(cpus: 1, memoryInBytes: 256 * 1024 * 1024)
+        let interval = Duration.milliseconds(100)
+        let starts = Mutex<[ContinuousClock.Instant]>([])
+        let created = ContinuousClock.now
+        let pool = CHWarmPool(
+            config: .init(targets: [shape: 3], minimumBootInterval: interval),
+            logger: nil
+        ) { shape in
+            starts.withLock { $0.append(.now) }
+            return try Self.unstartedInstance(shape, root: root)
+        }
+        await pool.fill()
+        try await waitFor { await pool.available(shape) == 3 }
+
+        let times = starts.withLock { $0 }.sorted()
+        #expect(times.count == 3)
+        for (i, start) in times.enumerated() {
+            // Boot slots are handed out `interval` apart starting no earlier
+            // than the pool's creation, and Task.sleep(until:) never wakes
+            // early.
+            #expect(start - created >= interval * i)
+        }
+        await pool.shutdown()
+    }
+
+    @Test("take on an unconfigured shape returns nil without booting")
+    func takeUnknownShape() async throws {
+        let boots = Mutex(0)
+        let pool = CHWarmPool(config: .init(targets: [:]), logger: nil) { _ in
+            boots.withLock { $0 += 1 }
+            throw CancellationError()
+        }
+        #expect(await pool.take(.init(cpus: 8, memoryInBytes: 1 << 30)) == nil)
+        #expect(boots.withLock { $0 } == 0)
+    }
+}
+#endif
@@ -0,0 +1,493 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import Synchronization
+import Testing
+
+@testable import Containerization
+
+#if canImport(Musl)
+import Musl
+private let _SOCK_DGRAM = SOCK_DGRAM
+private let _SOCK_STREAM = SOCK_STREAM
+#elseif canImport(Glibc)
+import Glibc
+private let _SOCK_DGRAM = Int32(SOCK_DGRAM.rawValue)
+private let _SOCK_STREAM = Int32(SOCK_STREAM.rawValue)
+#elseif canImport(Darwin)
+import Darwin
+private let _SOCK_DGRAM = SOCK_DGRAM
+private let _SOCK_STREAM = SOCK_STREAM
+#endif
+
+@Suite("DNSStubResolver")
+struct DNSStubResolverTests {
+    /// A stand-in upstream nameserver on 127.0.0.1 that answers each query
+    /// with `respond`, or drops it when that returns nil.
+    final class Upstream: Sendable {
+        let fd: Int32
+        let port: UInt16
+        let queries = Mutex(0)
+        private let stopped = Atomic(false)
+
+        init(delay: Duration = .zero, respond: @escaping @Sendable ([UInt8]) -> [UInt8]?) throws {
+            (fd, port) = try DNSStubResolverTests.boundSocket()
+            let thread = Thread { [self] in
+                var buffer = [UInt8](repeating: 0, count: 4096)
+                while !stopped.load(ordering: .relaxed) {
+                    var addr = sockaddr_storage()
+                    var len = socklen_t(MemoryLayout<sockaddr_storage>.size)
+                    let n = buffer.withUnsafeMutableBytes { buf in
+                        withUnsafeMutablePointer(to: &addr) {
+                            $0.withMemoryRebound(to: sockaddr.self, capacity: 1) {
+                                recvfrom(fd, buf.baseAddress, buf.count, 0, $0, &len)
+                            }
+                        }
+                    }
+                    guard n > 0 else {
+                        continue
+                    }
+                    queries.withLock { $0 += 1 }
+                    guard let response = respond(Array(buffer[0..<n])) else {
+                        continue
+                    }
+                    if delay > .zero {
+                        Thread.sleep(forTimeInterval: Double(delay.components.attoseconds) / 1e18 + Double(delay.components.seconds))
+                    }
+                    _ = response.withUnsafeBytes { payload in
+                        withUnsafePointer(to: &addr) {
+                            $0.withMemoryRebound(to: sockaddr.self, capacity: 1) {
+                                sendto(fd, payload.baseAddress, payload.count, 0, $0, len)
+                            }
+                        }
+                    }
+                }
+                close(fd)
+            }
+            thread.start()
+        }
+
+        var count: Int { queries.withLock { $0 } }
+
+        func stop() {
+            stopped.store(true, ordering: .relaxed)
+        }
+    }
+
+    /// The TCP side of an upstream on `port`: answers each length-prefixed
+    /// query with `respond`, one connection at a time.
+    final class StreamUpstream: Sendable {
+        let queries = Mutex(0)
+        private let stopped = Atomic(false)
+
+        init(port: UInt16, respond: @escaping @Sendable ([UInt8]) -> [UInt8]) throws {
+            let (fd, _) = try DNSStubResolverTests.boundSocket(type: _SOCK_STREAM, port: port)
+            guard listen(fd, 8) == 0 else {
+                close(fd)
+                throw POSIXError(.init(rawValue: errno) ?? .EIO)
+            }
+            let thread = Thread { [self] in
+                while !stopped.load(ordering: .relaxed) {
+                    let conn = accept(fd, nil, nil)
+                    guard conn >= 0 else {
+                        continue
+                    }
+                    if let query = DNSStubResolverTests.readFramed(conn) {
+                        queries.withLock { $0 += 1 }
+                        DNSStubResolverTests.writeFramed(conn, respond(query))
+                    }
+                    close(conn)
+                }
+                close(fd)
+            }
+            thread.start()
+        }
+
+        var count: Int { queries.withLock { $0 } }
+
+        func stop() {
+            stopped.store(true, ordering: .relaxed)
+        }
+    }
+
+    /// A socket bound to `port` (ephemeral by default) on 127.0.0.1, with a
+    /// short receive timeout so blocking reads come back around.
+    static func boundSocket(type: Int32 = _SOCK_DGRAM, port: UInt16 = 0) throws -> (Int32, UInt16) {
+        let fd = socket(AF_INET, type, 0)
+        guard fd >= 0 else {
+            throw POSIXError(.init(rawValue: errno) ?? .EIO)
+        }
+        var timeout = timeval(tv_sec: 0, tv_usec: 50_000)
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, socklen_t(MemoryLayout<timeval>.size))
+        var addr = loopback(port: port)
+        var len = socklen_t(MemoryLayout<sockaddr_in>.size)
+        let rc = withUnsafeMutablePointer(to: &addr) {
+            $0.withMemoryRebound(to: sockaddr.self, capacity: 1) { ptr -> Int32 in
+                guard bind(fd, ptr, len) == 0 else {
+                    return -1
+                }
+                return getsockname(fd, ptr, &len)
+            }
+        }
+        guard rc == 0 else {
+            close(fd)
+            throw POSIXError(.init(rawValue: errno) ?? .EIO)
+        }
+        return (fd, UInt16(bigEndian: addr.sin_port))
+    }
+
+    static func loopback(port: UInt16) -> sockaddr_in {
+        var addr = sockaddr_in()
+        #if os(macOS)
+        addr.sin_len = UInt8(MemoryLayout<sockaddr_in>.size)
+        #endif
+        addr.sin_family = sa_family_t(AF_INET)
+        addr.sin_port = port.bigEndian
+        addr.sin_addr.s_addr = inet_addr("127.0.0.1")
+        return addr
+    }
+
+    /// Sends `query` to the resolver and waits up to two seconds for a reply.
+    static func ask(_ query: [UInt8], port: UInt16) throws -> [UInt8]? {
+        let (fd, _) = try boundSocket()
+        defer { close(fd) }
+        var addr = loopback(port: port)
+        let sent = query.withUnsafeBytes { payload in
+            withUnsafePointer(to: &addr) {
+                $0.withMemoryRebound(to: sockaddr.self, capacity: 1) {
+                    sendto(fd, payload.baseAddress, payload.count, 0, $0, socklen_t(MemoryLayout<sockaddr_in>.size))
+                }
+            }
+        }
+        guard sent == query.count else {
+            return nil
+        }
+        var buffer = [UInt8](repeating: 0, count: 4096)
+        let deadline = ContinuousClock.now + .seconds(2)
+        while ContinuousClock.now < deadline {
+            let n = buffer.withUnsafeMutableBytes { recv(fd, $0.baseAddress, $0.count, 0) }
+            if n > 0 {
+                return Array(buffer[0..<n])
+            }
+        }
+        return nil
+    }
+
+    /// Sends `query` to the resolver over TCP and waits up to two seconds
+    /// for the reply.
+    static func askStream(_ query: [UInt8], port: UInt16) throws -> [UInt8]? {
+        let fd = socket(AF_INET, _SOCK_STREAM, 0)
+        guard fd >= 0 else {
+            throw POSIXError(.init(rawValue: errno) ?? .EIO)
+        }
+        defer { close(fd) }
+        var timeout = timeval(tv_sec: 2, tv_usec: 0)
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, socklen_t(MemoryLayout<timeval>.size))
+        var addr = loopback(port: port)
+        let rc = withUnsafePointer(to: &addr) {
+            $0.withMemoryRebound(to: sockaddr.self, capacity: 1) {
+                connect(fd, $0, socklen_t(MemoryLayout<sockaddr_in>.size))
+            }
+        }
+        guard rc == 0 else {
+            throw POSIXError(.init(rawValue: errno) ?? .EIO)
+        }
+        writeFramed(fd, query)
+        return readFramed(fd)
+    }
+
+    /// Reads one length-prefixed message, or nil on EOF or timeout.
+    static func readFramed(_ fd: Int32) -> [UInt8]? {
+        func readExactly(_ count: Int) -> [UInt8]? {
+            var bytes = [UInt8](repeating: 0, count: count)
+            var done = 0
+            while done < count {
+                let n = bytes.withUnsafeMutableBytes { read(fd, $0.baseAddress! + done, count - done) }
+                guard n > 0 else {
+                    return nil
+                }
+                done += n
+            }
+            return bytes
+        }
+        guard let prefix = readExactly(2) else {
+            return nil
+        }
+        return readExactly(Int(DNSWire.u16(prefix, 0)))
+    }
+
+    static func writeFramed(_ fd: Int32, _ message: [UInt8]) {
+        let framed = [UInt8(message.count >> 8), UInt8(message.count & 0xff)] + message
+        _ = framed.withUnsafeBytes { write(fd, $0.baseAddress, $0.count) }
+    }
+
+    static func query(_ name: String, type: UInt16 = DNSWire.typeA, qclass: UInt16 = DNSWire.classIN, id: UInt16 = 0x1234) -> [UInt8] {
+        var b: [UInt8] = [UInt8(id >> 8), UInt8(id & 0xff), 0x01, 0x00, 0, 1, 0, 0, 0, 0, 0, 0]
+        for label in name.split(separator: ".") {
+            b.append(UInt8(label.utf8.count))
+            b += Array(label.utf8)
+        }
+        b += [0, UInt8(type >> 8), UInt8(type & 0xff), UInt8(qclass >> 8), UInt8(qclass & 0xff)]
+        return b
+    }
+
+    /// An upstream reply to `query` with `count` A records of `ttl` seconds.
+    static func answer(_ query: [UInt8], ttl: UInt32, count: Int = 1) -> [UInt8] {
+        var b = query
+        b[2] = 0x81
+        b[3] = 0x80
+        DNSWire.put16(&b, 6, UInt16(count))
+        for i in 0..<count {
+            b += [0xc0, 0x0c, 0, 1, 0, 1, 0, 0, 0, 0, 0, 4, 10, 0, 0, UInt8(i + 1)]
+            DNSWire.put32(&b, b.count - 10, ttl)
+        }
+        return b
+    }
+
+    /// An upstream NXDOMAIN reply, with an SOA bounding it when given.
+    static func nxdomain(_ query: [UInt8], soaMinimum: UInt32?) -> [UInt8] {
+        var b = query
+        b[2] = 0x81
+        b[3] = 0x83
+        guard let soaMinimum else {
+            return b
+        }
+        DNSWire.put16(&b, 8, 1)
+        // Root MNAME and RNAME, then serial, refresh, retry, expire, minimum.
+        b += [0xc0, 0x0c, 0, 6, 0, 1, 0, 0, 0x0e, 0x10, 0, 22, 0, 0]
+        b += [UInt8](repeating: 0, count: 16)
+        b += [0, 0, 0, 0]
+        DNSWire.put32(&b, b.count - 4, soaMinimum)
+        return b
+    }
+
+    static func resolver(
+        _ upstream: Upstream,
+        timeout: Duration = .seconds(2),
+        attempts: Int = 3
+    ) throws -> DNSStubResolver {
+        let resolver = DNSStubResolver(
+            configuration: .init(
+                listenAddress: "127.0.0.1",
+                listenPort: 0,
+                upstreams: ["127.0.0.1"],
+                upstreamPort: upstream.port,
+                upstreamTimeout: timeout,
+                attempts: attempts
+            ))
+        try resolver.start()
+        return resolver
+    }
+
+    /// The TTL of the first answer record.
+    static func firstTTL(_ response: [UInt8]) throws -> UInt32 {
+        let (_, end) = try #require(DNSWire.question(in: response))
+        let records = try #require(DNSWire.records(in: response, after: end))
+        return DNSWire.u32(response, try #require(records.first).record.ttlOffset)
+    }
+
+    @Test("answers are cached until their TTL")
+    func cachesPositiveAnswers() throws {
+        let upstream = try Upstream { Self.answer($0, ttl: 300) }
+        defer { upstream.stop() }
+        let resolver = try Self.resolver(upstream)
+        defer { resolver.stop() }
+
+        let first = try #require(try Self.ask(Self.query("example.com", id: 1), port: resolver.port))
+        let second = try #require(try Self.ask(Self.query("EXAMPLE.com", id: 2), port: resolver.port))
+
+        #expect(upstream.count == 1)
+        #expect(DNSWire.id(first) == 1)
+        #expect(DNSWire.id(second) == 2)
+        #expect(DNSWire.answerCount(second) == 1)
+        #expect(try Self.firstTTL(second) <= 300)
+
+        let stats = resolver.statistics
+        #expect(stats.hits == 1)
+        #expect(stats.misses == 1)
+        #expect(stats.entries == 1)
+        #expect(stats.hitRate == 0.5)
+    }
+
+    @Test("an expired answer is fetched again")
+    func expiresAfterTTL() throws {
+        let upstream = try Upstream { Self.answer($0, ttl: 1) }
+        defer { upstream.stop() }
+        let resolver = try Self.resolver(upstream)
+        defer { resolver.stop() }
+
+        _ = try #require(try Self.ask(Self.query("example.com"), port: resolver.port))
+        Thread.sleep(forTimeInterval: 1.2)
+        _ = try #require(try Self.ask(Self.query("example.com"), port: resolver.port))
+
+        #expect(upstream.count == 2)
+        #expect(resolver.statistics.hits == 0)
+    }
+
+    @Test("NXDOMAIN is cached for the SOA minimum")
+    func cachesNegativeAnswers() throws {
+        let upstream = try Upstream { Self.nxdomain($0, soaMinimum: 60) }
+        defer { upstream.stop() }
+        let resolver = try Self.resolver(upstream)
+        defer { resolver.stop() }
+
+        for _ in 0..<3 {
+            let response = try #require(try Self.ask(Self.query("missing.example.com"), port: resolver.port))
+            #expect(DNSWire.rcode(response) == DNSWire.rcodeNXDomain)
+        }
+
+        #expect(upstream.count == 1)
+        #expect(resolver.statistics.negativeHits == 2)
+    }
+
+    @Test("NXDOMAIN without an SOA is not cached")
+    func skipsUnboundedNegativeAnswers() throws {
+        let upstream = try Upstream { Self.nxdomain($0, soaMinimum: nil) }
+        defer { upstream.stop() }
+        let resolver = try Self.resolver(upstream)
+        defer { resolver.stop() }
+
+        _ = try #require(try Self.ask(Self.query("missing.example.com"), port: resolver.port))
+        _ = try #require(try Self.ask(Self.query("missing.example.com"), port: resolver.port))
+
+        #expect(upstream.count == 2)
+        #expect(resolver.statistics.entries == 0)
+    }
+
+    @Test("concurrent identical queries share one upstream lookup")
+    func coalescesQueries() async throws {
+        let upstream = try Upstream(delay: .milliseconds(300)) { Self.answer($0, ttl: 300) }
+        defer { upstream.stop() }
+        let resolver = try Self.resolver(upstream)
+        defer { resolver.stop() }
+        let port = resolver.port
+
+        let ids = try await withThrowingTaskGroup(of: UInt16?.self) { group in
+            for id in UInt16(1)...8 {
+                group.addTask {
+                    try Self.ask(Self.query("example.com", id: id), port: port).map(DNSWire.id)
+                }
+            }
+            var ids: [UInt16] = []
+            for try await id in group {
+                if let id { ids.append(id) }
+            }
+            return ids.sorted()
+        }
+
+        #expect(ids == Array(1...8))
+        #expect(upstream.count == 1)
+        let stats = resolver.statistics
+        #expect(stats.misses + stats.coalesced + stats.hits == 8)
+        #expect(stats.misses == 1)
+    }
+
+    @Test("hosts entries are answered locally")
+    func answersHosts() throws {
+        let upstream = try Upstream { Self.answer($0, ttl: 300) }
+        defer { upstream.stop() }
+        let resolver = try Self.resolver(upstream)
+        defer { resolver.stop() }
+        resolver.update(hosts: [Hosts.Entry(ipAddress: "10.0.0.5", hostnames: ["DB.internal", "db"])])
+
+        let a = try #require(try Self.ask(Self.query("db.internal"), port: resolver.port))
+        #expect(DNSWire.rcode(a) == DNSWire.rcodeNoError)
+        #expect(DNSWire.answerCount(a) == 1)
+        #expect(Array(a.suffix(4)) == [10, 0, 0, 5])
+
+        // The name exists but has no IPv6 address: no data, not NXDOMAIN.
+        let aaaa = try #require(try Self.ask(Self.query("db", type: DNSWire.typeAAAA), port: resolver.port))
+        #expect(DNSWire.rcode(aaaa) == DNSWire.rcodeNoError)
+        #expect(DNSWire.answerCount(aaaa) == 0)
+
+        #expect(upstream.count == 0)
+        #expect(resolver.statistics.localAnswers == 2)
+    }
+
+    @Test("hit and miss counters are served as CHAOS TXT")
+    func servesCounters() throws {
+        let upstream = try Upstream { Self.answer($0, ttl: 300) }
+        defer { upstream.stop() }
+        let resolver = try Self.resolver(upstream)
+        defer { resolver.stop() }
+
+        for _ in 0..<3 {
+            _ = try #require(try Self.ask(Self.query("example.com"), port: resolver.port))
+        }
+        let hits = try #require(
+            try Self.ask(Self.query("hits.bind", type: DNSWire.typeTXT, qclass: DNSWire.classCH), port: resolver.port))
+        let misses = try #require(
+            try Self.ask(Self.query("misses.bind", type: DNSWire.typeTXT, qclass: DNSWire.classCH), port: resolver.port))
+
+        #expect(Array(hits.suffix(2)) == [1, UInt8(ascii: "2")])
+        #expect(Array(misses.suffix(2)) == [1, UInt8(ascii: "1")])
+    }
+
+    @Test("an unresponsive upstream yields SERVFAIL after every attempt")
+    func failsAfterAttempts() throws {
+        let upstream = try Upstream { _ in nil }
+        defer { upstream.stop() }
+        let resolver = try Self.resolver(upstream, timeout: .milliseconds(100), attempts: 2)
+        defer { resolver.stop() }
+
+        let response = try #require(try Self.ask(Self.query("example.com"), port: resolver.port))
+
+        #expect(DNSWire.rcode(response) == DNSWire.rcodeServFail)
+        #expect(upstream.count == 2)
+        #expect(resolver.statistics.upstreamFailures == 1)
+        #expect(resolver.statistics.entries == 0)
+    }
+
+    @Test("large answers are truncated for clients without EDNS")
+    func truncatesForClassicClients() throws {
+        let upstream = try Upstream { Self.answer($0, ttl: 300, count: 40) }
+        defer { upstream.stop() }
+        let resolver = try Self.resolver(upstream)
+        defer { resolver.stop() }
+
+        let response = try #require(try Self.ask(Self.query("example.com"), port: resolver.port))
+
+        #expect(DNSWire.isTruncated(response))
+        #expect(DNSWire.answerCount(response) == 0)
+        #expect(response.count <= DNSWire.classicUDPSize)
+    }
+
+    @Test("a truncated client's TCP retry gets the whole answer")
+    func servesTruncatedAnswersOverTCP() throws {
+        // Like a real nameserver, the upstream truncates for a query without EDNS.
+        let upstream = try Upstream { DNSWire.truncated(Self.answer($0, ttl: 300, count: 40), questionEnd: $0.count) }
+        defer { upstream.stop() }
+        let streamUpstream = try StreamUpstream(port: upstream.port) { Self.answer($0, ttl: 300, count: 40) }
+        defer { streamUpstream.stop() }
+        let resolver = try Self.resolver(upstream)
+        defer { resolver.stop() }
+
+        let truncated = try #require(try Self.ask(Self.query("example.com"), port: resolver.port))
+        #expect(DNSWire.isTruncated(truncated))
+
+        let response = try #require(try Self.askStream(Self.query("example.com", id: 0x4321), port: resolver.port))
+        #expect(!DNSWire.isTruncated(response))
+        #expect(DNSWire.id(response) == 0x4321)
+        #expect(DNSWire.answerCount(response) == 40)
+        #expect(streamUpstream.count == 1)
+
+        // The TCP answer is complete, so it's cached for both transports.
+        let cached = try #require(try Self.askStream(Self.query("example.com"), port: resolver.port))
+        #expect(DNSWire.answerCount(cached) == 40)
+        #expect(streamUpstream.count == 1)
+    }
+}
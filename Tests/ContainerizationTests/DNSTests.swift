@@ -52,6 +52,14 @@ struct DNSTests {
         #expect(dns.resolvConf == expected)
     }
 
+    @Test func dnsResolvConfWithLocalCache() {
+        let dns = DNS(nameservers: ["8.8.8.8"], searchDomains: ["internal.com"], localCache: true)
+
+        // The stub forwards to the nameservers; containers only see the stub.
+        let expected = "nameserver 127.0.0.53\nsearch internal.com\n"
+        #expect(dns.resolvConf == expected)
+    }
+
     @Test func dnsValidateAcceptsValidIPv4Nameservers() throws {
         let dns = DNS(nameservers: ["8.8.8.8", "1.1.1.1"])
         #expect(throws: Never.self) { try dns.validate() }
@@ -15,6 +15,7 @@
 //===----------------------------------------------------------------------===//
 
 import CloudHypervisor
+import ContainerizationError
 import Testing
 
 @testable import Containerization
@@ -22,31 +23,63 @@ import Testing
 @Suite("Mount+CH")
 struct MountCHTests {
     @Test("block mount without options produces DiskConfig with readonly=false")
-    func blockNoOptions() {
+    func blockNoOptions() throws {
         let mount = Mount.block(format: "ext4", source: "/foo.img", destination: "/data")
-        let cfg = mount.chDiskConfig(id: "blk-0")
+        let cfg = try mount.chDiskConfig(id: "blk-0", cpus: 1)
         #expect(cfg?.path == "/foo.img")
         #expect(cfg?.readonly == false)
         #expect(cfg?.id == "blk-0")
         #expect(cfg?.direct == nil)
         #expect(cfg?.iommu == nil)
         #expect(cfg?.pciSegment == nil)
+        #expect(cfg?.queueSize == nil)
     }
 
     @Test("block mount with 'ro' option produces DiskConfig with readonly=true")
-    func blockReadOnly() {
+    func blockReadOnly() throws {
         let mount = Mount.block(format: "ext4", source: "/foo.img", destination: "/data", options: ["ro"])
-        let cfg = mount.chDiskConfig(id: "blk-1")
+        let cfg = try mount.chDiskConfig(id: "blk-1", cpus: 1)
         #expect(cfg?.readonly == true)
     }
 
+    @Test("block mount defaults to one queue per vCPU")
+    func blockQueuesPerCPU() throws {
+        let mount = Mount.block(format: "ext4", source: "/foo.img", destination: "/data")
+        #expect(try mount.chDiskConfig(id: "blk-0", cpus: 1)?.numQueues == 1)
+        #expect(try mount.chDiskConfig(id: "blk-0", cpus: 6)?.numQueues == 6)
+    }
+
+    @Test("ch runtime options override queues and select direct I/O; vz options are ignored")
+    func blockRuntimeOptions() throws {
+        let mount = Mount.block(
+            format: "ext4",
+            source: "/foo.img",
+            destination: "/data",
+            runtimeOptions: ["chNumQueues=2", "chQueueSize=512", "chDirect=true", "vzDiskImageCachingMode=cached"]
+        )
+        let cfg = try mount.chDiskConfig(id: "blk-0", cpus: 8)
+        #expect(cfg?.numQueues == 2)
+        #expect(cfg?.queueSize == 512)
+        #expect(cfg?.direct == true)
+    }
+
+    @Test("invalid ch runtime options are rejected", arguments: [
+        "chNumQueues=0", "chQueueSize=100", "chDirect=maybe", "chImageType=vhdx", "chBogus=1",
+    ])
+    func blockInvalidRuntimeOptions(option: String) {
+        let mount = Mount.block(format: "ext4", source: "/foo.img", destination: "/data", runtimeOptions: [option])
+        #expect(throws: ContainerizationError.self) {
+            try mount.chDiskConfig(id: "blk-0", cpus: 1)
+        }
+    }
+
     @Test("non-block mount returns nil from chDiskConfig")
-    func chDiskConfigNilForNonBlock() {
+    func chDiskConfigNilForNonBlock() throws {
         let share = Mount.share(source: "/host", destination: "/guest")
-        #expect(share.chDiskConfig(id: "x") == nil)
+        #expect(try share.chDiskConfig(id: "x", cpus: 1) == nil)
 
         let any = Mount.any(type: "tmpfs", source: "tmpfs", destination: "/tmp")
-        #expect(any.chDiskConfig(id: "x") == nil)
+        #expect(try any.chDiskConfig(id: "x", cpus: 1) == nil)
     }
 
     @Test("share mount produces FsConfig with tag and socket")
@@ -69,4 +102,52 @@ struct MountCHTests {
         let any = Mount.any(type: "tmpfs", source: "tmpfs", destination: "/tmp")
         #expect(any.chFsConfig(tag: "t", socketPath: "/s", id: "x") == nil)
     }
+
+    @Test("share runtime options select a virtiofs profile; vz options are ignored")
+    func shareProfile() throws {
+        let mount = Mount.share(
+            source: "/host/src",
+            destination: "/src",
+            runtimeOptions: [
+                "chCache=always", "chWriteback=true", "chThreadPoolSize=8",
+                "chNumQueues=2", "chQueueSize=512", "vzShareMode=shared",
+            ]
+        )
+        let profile = try #require(try mount.chVirtiofsProfile())
+        #expect(profile.cache == .always)
+        #expect(profile.writeback)
+        #expect(profile.threadPoolSize == 8)
+
+        let cfg = try mount.chTunedFsConfig(tag: "t", socketPath: "/s", id: "x")
+        #expect(cfg?.numQueues == 2)
+        #expect(cfg?.queueSize == 512)
+
+        let plain = try #require(try Mount.share(source: "/host/src", destination: "/src").chVirtiofsProfile())
+        #expect(plain == VirtiofsProfile())
+    }
+
+    @Test("invalid virtiofs runtime options are rejected", arguments: [
+        "chCache=sometimes", "chWriteback=yes", "chThreadPoolSize=-1", "chNumQueues=0", "chQueueSize=3", "chDirect=true",
+    ])
+    func shareInvalidRuntimeOptions(option: String) {
+        let mount = Mount.share(source: "/host", destination: "/guest", runtimeOptions: [option])
+        #expect(throws: ContainerizationError.self) {
+            try mount.chVirtiofsProfile()
+        }
+        #expect(throws: ContainerizationError.self) {
+            try mount.chTunedFsConfig(tag: "t", socketPath: "/s", id: "x")
+        }
+        #expect(mount.chFsConfig(tag: "t", socketPath: "/s", id: "x")?.numQueues == nil)
+    }
+
+    @Test("mounts sharing a virtiofsd must agree on its profile")
+    func sharedProfile() throws {
+        let a = Mount.share(source: "/host", destination: "/a", runtimeOptions: ["chCache=never"])
+        let b = Mount.share(source: "/host", destination: "/b", runtimeOptions: ["chCache=never"])
+        let c = Mount.share(source: "/host", destination: "/c")
+        #expect(try VirtiofsProfile.shared(by: [a, b]).cache == .never)
+        #expect(throws: ContainerizationError.self) {
+            try VirtiofsProfile.shared(by: [a, c])
+        }
+    }
 }
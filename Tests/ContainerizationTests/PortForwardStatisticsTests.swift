@@ -0,0 +1,77 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+@testable import Containerization
+
+@Suite("PortForwardStatistics")
+struct PortForwardStatisticsTests {
+    @Test("samples land in power-of-two microsecond buckets")
+    func histogramBuckets() {
+        var h = LatencyHistogram()
+        h.record(.microseconds(10))
+        h.record(.microseconds(16))
+        h.record(.microseconds(17))
+        h.record(.milliseconds(1))
+        h.record(.seconds(30))
+
+        #expect(h.count == 5)
+        #expect(h.counts[0] == 2)
+        #expect(h.counts[1] == 1)
+        #expect(h.counts[LatencyHistogram.bucketBounds.firstIndex(of: 1024)!] == 1)
+        #expect(h.counts.last == 1)
+        #expect(h.sum == .microseconds(10 + 16 + 17 + 1000) + .seconds(30))
+    }
+
+    @Test("percentiles report bucket upper bounds")
+    func histogramPercentiles() {
+        var h = LatencyHistogram()
+        #expect(h.percentile(0.5) == nil)
+
+        for _ in 0..<90 {
+            h.record(.microseconds(20))
+        }
+        for _ in 0..<10 {
+            h.record(.milliseconds(3))
+        }
+        #expect(h.percentile(0.5) == .microseconds(32))
+        #expect(h.percentile(0.9) == .microseconds(32))
+        #expect(h.percentile(0.99) == .microseconds(4096))
+
+        h.record(.seconds(60))
+        #expect(h.percentile(1.0) == nil)
+    }
+
+    @Test("flow totals add every counter")
+    func flowTotals() {
+        var total = PortForwardStatistics.Flow(client: "closed")
+        var flow = PortForwardStatistics.Flow(client: "127.0.0.1:5000")
+        flow.bytesToGuest = 10
+        flow.bytesFromGuest = 20
+        flow.packetsToGuest = 1
+        flow.packetsFromGuest = 2
+        flow.packetsDropped = 3
+        total.add(flow)
+        total.add(flow)
+        #expect(total.client == "closed")
+        #expect(total.bytesToGuest == 20)
+        #expect(total.bytesFromGuest == 40)
+        #expect(total.packetsToGuest == 2)
+        #expect(total.packetsFromGuest == 4)
+        #expect(total.packetsDropped == 6)
+    }
+}
@@ -0,0 +1,120 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+import CloudHypervisor
+import ContainerizationError
+import Foundation
+import Testing
+
+@testable import Containerization
+
+@Suite("QCOW2")
+struct QCOW2Tests {
+    private func be<T: FixedWidthInteger>(_ data: Data, _ offset: Int, as: T.Type = T.self) -> T {
+        data[offset..<offset + MemoryLayout<T>.size].reduce(T(0)) { ($0 << 8) | T($1) }
+    }
+
+    private func tempDir() throws -> URL {
+        let dir = FileManager.default.temporaryDirectory.appendingPathComponent("qcow2-\(UUID().uuidString)")
+        try FileManager.default.createDirectory(at: dir, withIntermediateDirectories: true)
+        return dir
+    }
+
+    @Test("overlay header describes a v3 image backed by a raw file")
+    func overlayHeader() throws {
+        let backing = "/var/lib/bases/sha256-abc.ext4"
+        let size: UInt64 = 2 * 1024 * 1024 * 1024
+        let image = try QCOW2.overlayImage(backingFile: backing, virtualSize: size)
+
+        #expect(be(image, 0, as: UInt32.self) == 0x5146_49fb)
+        #expect(be(image, 4, as: UInt32.self) == 3)
+        #expect(be(image, 20, as: UInt32.self) == 16)
+        #expect(be(image, 24, as: UInt64.self) == size)
+        #expect(be(image, 32, as: UInt32.self) == 0)
+        // 2 GiB / 512 MiB per L2 table.
+        #expect(be(image, 36, as: UInt32.self) == 4)
+        #expect(be(image, 40, as: UInt64.self) == 3 * 65536)
+        #expect(be(image, 48, as: UInt64.self) == 65536)
+        #expect(be(image, 56, as: UInt32.self) == 1)
+        #expect(be(image, 72, as: UInt64.self) == 0)
+        #expect(be(image, 96, as: UInt32.self) == 4)
+        #expect(be(image, 100, as: UInt32.self) == 104)
+
+        // Backing format extension follows the header.
+        #expect(be(image, 104, as: UInt32.self) == 0xe279_2aca)
+        #expect(be(image, 108, as: UInt32.self) == 3)
+        #expect(String(decoding: image[112..<115], as: UTF8.self) == "raw")
+
+        let nameOffset = Int(be(image, 8, as: UInt64.self))
+        let nameSize = Int(be(image, 16, as: UInt32.self))
+        #expect(String(decoding: image[nameOffset..<nameOffset + nameSize], as: UTF8.self) == backing)
+    }
+
+    @Test("overlay metadata is refcounted and the L1 table is empty")
+    func overlayTables() throws {
+        let image = try QCOW2.overlayImage(backingFile: "/base.ext4", virtualSize: 1024 * 1024 * 1024)
+        #expect(image.count == 4 * 65536)
+
+        #expect(be(image, 65536, as: UInt64.self) == 2 * 65536)
+        for cluster in 0..<4 {
+            #expect(be(image, 2 * 65536 + cluster * 2, as: UInt16.self) == 1)
+        }
+        #expect(be(image, 2 * 65536 + 4 * 2, as: UInt16.self) == 0)
+        #expect(image[(3 * 65536)...].allSatisfy { $0 == 0 })
+    }
+
+    @Test("qcow2Overlay writes an overlay sized to the source and marks it qcow2")
+    func mountOverlay() throws {
+        let dir = try tempDir()
+        defer { try? FileManager.default.removeItem(at: dir) }
+
+        let basePath = dir.appendingPathComponent("base.ext4")
+        #expect(FileManager.default.createFile(atPath: basePath.path, contents: Data(count: 8 * 1024 * 1024)))
+        let base = Mount.block(format: "ext4", source: basePath.path, destination: "/", runtimeOptions: ["chDirect=true"])
+
+        let overlayPath = dir.appendingPathComponent("rootfs.qcow2").path
+        let overlay = try base.qcow2Overlay(to: overlayPath)
+        #expect(overlay.source == overlayPath)
+        #expect(overlay.destination == "/")
+
+        let data = try Data(contentsOf: URL(fileURLWithPath: overlayPath))
+        #expect(be(data, 24, as: UInt64.self) == 8 * 1024 * 1024)
+
+        let cfg = try #require(try overlay.chDiskConfig(id: "rootfs", cpus: 1))
+        #expect(cfg.imageType == .qcow2)
+        #expect(cfg.backingFiles == true)
+        #expect(cfg.direct == true)
+
+        #expect(throws: ContainerizationError.self) {
+            try base.qcow2Overlay(to: overlayPath)
+        }
+    }
+
+    @Test("non-block mounts and relative backing files are rejected")
+    func invalidOverlays() throws {
+        let share = Mount.share(source: "/host", destination: "/guest")
+        #expect(throws: ContainerizationError.self) {
+            try share.qcow2Overlay(to: "/tmp/never.qcow2")
+        }
+        #expect(throws: ContainerizationError.self) {
+            try QCOW2.createOverlay(
+                at: URL(fileURLWithPath: "/tmp/never.qcow2"),
+                backingFile: "relative.ext4",
+                virtualSize: 512
+            )
+        }
+    }
+}
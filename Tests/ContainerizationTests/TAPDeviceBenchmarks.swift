@@ -0,0 +1,93 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+#if os(Linux)
+import Foundation
+import Synchronization
+import Testing
+
+@testable import Containerization
+
+#if canImport(Musl)
+import Musl
+#elseif canImport(Glibc)
+import Glibc
+#endif
+
+/// Loopback packet-rate comparison of one and several TAP queues: one
+/// writer per queue injects minimum-size frames, the way a VMM's per-queue
+/// TX threads do, and the aggregate rate is reported. Both runs use a
+/// multi-queue device, since a single-queue TAP already attached to its
+/// holder fd refuses a second attach.
+///
+/// Needs root (CAP_NET_ADMIN). Run with:
+///   ENABLE_TIMING_TESTS=1 swift test --filter TAPDeviceBenchmarks
+@Suite
+struct TAPDeviceBenchmarks {
+    private static let isEnabled =
+        ProcessInfo.processInfo.environment["ENABLE_TIMING_TESTS"] != nil && geteuid() == 0
+
+    private static let duration: Duration = .seconds(2)
+
+    @Test(.enabled(if: TAPDeviceBenchmarks.isEnabled))
+    func packetRateByQueueCount() throws {
+        let single = try measure(queues: 1)
+        let multi = try measure(queues: 4)
+        print("TAP loopback: 1 queue  \(Int(single)) frames/s")
+        print("TAP loopback: 4 queues \(Int(multi)) frames/s (\(String(format: "%.2f", multi / single))x)")
+    }
+
+    private func measure(queues: Int) throws -> Double {
+        let device = try TAPDevice(name: "czbench\(queues)", queuePairs: 4)
+        defer { device.close() }
+
+        var fds: [Int32] = []
+        defer { fds.forEach { _ = close($0) } }
+        for _ in 0..<queues {
+            fds.append(try device.openQueue())
+        }
+
+        // Broadcast frame with a local experimental EtherType, so the host
+        // stack drops it right after the TAP's receive path, behind a
+        // zeroed virtio-net header.
+        var frame = [UInt8](repeating: 0, count: 12)
+        frame += [UInt8](repeating: 0xff, count: 6) + [0x02, 0, 0, 0, 0, 1] + [0x88, 0xb5]
+        frame += [UInt8](repeating: 0, count: 46)
+
+        let queues = fds
+        let packet = frame
+        let total = Atomic<Int>(0)
+        let clock = ContinuousClock()
+        let start = clock.now
+        DispatchQueue.concurrentPerform(iterations: queues.count) { i in
+            var sent = 0
+            packet.withUnsafeBytes { bytes in
+                while clock.now - start < Self.duration {
+                    for _ in 0..<1024 {
+                        if write(queues[i], bytes.baseAddress, bytes.count) == bytes.count {
+                            sent += 1
+                        }
+                    }
+                }
+            }
+            total.add(sent, ordering: .relaxed)
+        }
+        let elapsed = clock.now - start
+        let seconds = Double(elapsed.components.seconds) + Double(elapsed.components.attoseconds) / 1e18
+        return Double(total.load(ordering: .relaxed)) / seconds
+    }
+}
+#endif
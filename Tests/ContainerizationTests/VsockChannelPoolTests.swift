@@ -0,0 +1,156 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import Synchronization
+import Testing
+
+@testable import Containerization
+
+#if canImport(Musl)
+import Musl
+#elseif canImport(Glibc)
+import Glibc
+#elseif canImport(Darwin)
+import Darwin
+#endif
+
+@Suite("VsockChannelPool")
+struct VsockChannelPoolTests {
+    /// Hands out one end of a fresh socketpair per dial and keeps the other
+    /// end, standing in for the guest side of a vsock connection.
+    final class Peers: Sendable {
+        let fds = Mutex<[Int32]>([])
+
+        func dial() throws -> FileHandle {
+            var pair: [Int32] = [-1, -1]
+            #if os(macOS)
+            let result = socketpair(AF_UNIX, SOCK_STREAM, 0, &pair)
+            #else
+            let result = socketpair(AF_UNIX, Int32(SOCK_STREAM.rawValue), 0, &pair)
+            #endif
+            guard result == 0 else {
+                throw POSIXError(.init(rawValue: errno) ?? .EIO)
+            }
+            fds.withLock { $0.append(pair[1]) }
+            return FileHandle(fileDescriptor: pair[0], closeOnDealloc: false)
+        }
+
+        var count: Int { fds.withLock { $0.count } }
+
+        func peer(_ index: Int) -> Int32 { fds.withLock { $0[index] } }
+
+        deinit {
+            for fd in fds.withLock({ $0 }) { close(fd) }
+        }
+    }
+
+    @Test("take on an empty pool returns nil and fills it")
+    func takeWarmsPool() async throws {
+        let peers = Peers()
+        let pool = VsockChannelPool(config: .init(size: 3), logger: nil) { try peers.dial() }
+
+        #expect(await pool.take() == nil)
+        try await waitFor { await pool.available == 3 }
+        #expect(peers.count == 3)
+        await pool.shutdown()
+    }
+
+    @Test("take hands out a connected channel and replaces it")
+    func takeReplenishes() async throws {
+        let peers = Peers()
+        let pool = VsockChannelPool(config: .init(size: 1), logger: nil) { try peers.dial() }
+        _ = await pool.take()
+        try await waitFor { await pool.available == 1 }
+
+        let channel = try #require(await pool.take())
+        defer { try? channel.close() }
+        var byte: UInt8 = 0x5a
+        #expect(write(peers.peer(0), &byte, 1) == 1)
+        byte = 0
+        #expect(read(channel.fileDescriptor, &byte, 1) == 1)
+        #expect(byte == 0x5a)
+
+        try await waitFor { await pool.available == 1 }
+        #expect(peers.count == 2)
+        await pool.shutdown()
+    }
+
+    @Test("take discards channels whose peer hung up")
+    func takeSkipsDeadChannels() async throws {
+        let peers = Peers()
+        let pool = VsockChannelPool(config: .init(size: 1), logger: nil) { try peers.dial() }
+        _ = await pool.take()
+        try await waitFor { await pool.available == 1 }
+
+        shutdown(peers.peer(0), Int32(SHUT_RDWR))
+        #expect(await pool.take() == nil)
+
+        try await waitFor { await pool.available == 1 }
+        let channel = try #require(await pool.take())
+        defer { try? channel.close() }
+        #expect(VsockChannelPool.isHealthy(channel.fileDescriptor))
+        await pool.shutdown()
+    }
+
+    @Test("a channel with unread peer data is still healthy")
+    func pendingDataIsHealthy() throws {
+        let peers = Peers()
+        let channel = try peers.dial()
+        defer { try? channel.close() }
+        #expect(VsockChannelPool.isHealthy(channel.fileDescriptor))
+
+        var byte: UInt8 = 1
+        #expect(write(peers.peer(0), &byte, 1) == 1)
+        #expect(VsockChannelPool.isHealthy(channel.fileDescriptor))
+
+        shutdown(peers.peer(0), Int32(SHUT_WR))
+        // Data queued ahead of EOF still reads as healthy; the relay delivers it.
+        #expect(VsockChannelPool.isHealthy(channel.fileDescriptor))
+        #expect(read(channel.fileDescriptor, &byte, 1) == 1)
+        #expect(!VsockChannelPool.isHealthy(channel.fileDescriptor))
+    }
+
+    @Test("channels idle longer than maxIdle are discarded")
+    func expiredChannelsAreDiscarded() async throws {
+        let peers = Peers()
+        let pool = VsockChannelPool(config: .init(size: 1, maxIdle: .zero), logger: nil) { try peers.dial() }
+        _ = await pool.take()
+        try await waitFor { await pool.available == 1 }
+
+        #expect(await pool.take() == nil)
+        await pool.shutdown()
+    }
+
+    @Test("shutdown closes idle channels and stops replenishing")
+    func shutdownClosesIdle() async throws {
+        let peers = Peers()
+        let pool = VsockChannelPool(config: .init(size: 2), logger: nil) { try peers.dial() }
+        _ = await pool.take()
+        try await waitFor { await pool.available == 2 }
+
+        await pool.shutdown()
+        #expect(await pool.available == 0)
+        #expect(await pool.take() == nil)
+        try await Task.sleep(for: .milliseconds(50))
+        #expect(await pool.available == 0)
+        #expect(peers.count == 2)
+
+        // Closing our end makes each peer read EOF.
+        var byte: UInt8 = 0
+        #expect(read(peers.peer(0), &byte, 1) == 0)
+    }
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright © 2026 Apple Inc. and the Containerization project authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// A minimal io_uring binding over the raw syscalls. Musl ships no liburing
+// and the guest only needs a handful of opcodes.
+//
+// Submission is not thread-safe: callers serialize the prep functions and
+// CZ_uring_submit. Completions are reaped by a single thread, which may run
+// concurrently with submitters.
+
+#ifndef CZ_URING_H
+#define CZ_URING_H
+
+#include <stdint.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+struct cz_uring;
+
+struct cz_uring_completion {
+  uint64_t user_data;
+  int32_t res;
+  uint32_t flags;
+};
+
+// SQE flags.
+#define CZ_URING_FIXED_FILE 0x1
+// Always run the next SQE after this one, whatever this one's result. Unlike
+// a soft link, a short read or splice doesn't cancel the rest of the chain.
+#define CZ_URING_HARDLINK 0x2
+// For splice, `fd_in` is a registered file slot.
+#define CZ_URING_FIXED_IN 0x4
+
+// Poll events, as for poll(2).
+#define CZ_URING_POLLIN 0x001
+#define CZ_URING_POLLOUT 0x004
+#define CZ_URING_POLLERR 0x008
+#define CZ_URING_POLLHUP 0x010
+
+// Set up a ring with `entries` submission slots and, if `files` is non-zero,
+// a sparse registered file table of that size. Returns NULL with errno set
+// when io_uring is unavailable or lacks an opcode this binding uses.
+struct cz_uring *CZ_uring_setup(unsigned entries, unsigned files);
+void CZ_uring_destroy(struct cz_uring *ring);
+
+// Point registered file `slot` at `fd`, or clear it with -1.
+int CZ_uring_update_file(struct cz_uring *ring, unsigned slot, int fd);
+int CZ_uring_register_buffers(struct cz_uring *ring, const struct iovec *iovs,
+                              unsigned count);
+
+// Each returns 0, or -EBUSY when the submission queue is full. With
+// CZ_URING_FIXED_FILE, `fd` (for splice, `fd_out`) is a registered file slot.
+int CZ_uring_prep_nop(struct cz_uring *ring, unsigned flags,
+                      uint64_t user_data);
+int CZ_uring_prep_poll(struct cz_uring *ring, int fd, unsigned events,
+                       unsigned flags, uint64_t user_data);
+int CZ_uring_prep_splice(struct cz_uring *ring, int fd_in, int fd_out,
+                         unsigned len, unsigned splice_flags, unsigned flags,
+                         uint64_t user_data);
+int CZ_uring_prep_read_fixed(struct cz_uring *ring, int fd, void *buf,
+                             unsigned len, uint64_t offset,
+                             unsigned buf_index, unsigned flags,
+                             uint64_t user_data);
+int CZ_uring_prep_write_fixed(struct cz_uring *ring, int fd, const void *buf,
+                              unsigned len, uint64_t offset,
+                              unsigned buf_index, unsigned flags,
+                              uint64_t user_data);
+int CZ_uring_prep_cancel(struct cz_uring *ring, uint64_t target,
+                         uint64_t user_data);
+
+// Free submission slots.
+unsigned CZ_uring_sq_space(struct cz_uring *ring);
+
+// Make everything prepared so far visible to the kernel. Returns the number
+// of published SQEs the kernel hasn't consumed yet.
+unsigned CZ_uring_publish(struct cz_uring *ring);
+
+// Submit up to `submit` published SQEs and, if `wait` is non-zero, block
+// until at least that many completions are ready. Doesn't touch the
+// submission queue, so it may run while another thread prepares SQEs.
+// Returns the number submitted or -errno; an interrupted wait returns 0.
+int CZ_uring_enter(struct cz_uring *ring, unsigned submit, unsigned wait);
+
+// CZ_uring_publish followed by CZ_uring_enter.
+int CZ_uring_submit(struct cz_uring *ring, unsigned wait);
+
+// Copy up to `max` ready completions into `out` and consume them.
+unsigned CZ_uring_reap(struct cz_uring *ring, struct cz_uring_completion *out,
+                       unsigned max);
+
+#endif
@@ -0,0 +1,390 @@
+/*
+ * Copyright © 2026 Apple Inc. and the Containerization project authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef __linux__
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "uring.h"
+
+#ifndef SYS_io_uring_setup
+#define SYS_io_uring_setup 425
+#endif
+#ifndef SYS_io_uring_enter
+#define SYS_io_uring_enter 426
+#endif
+#ifndef SYS_io_uring_register
+#define SYS_io_uring_register 427
+#endif
+
+struct cz_uring {
+  int fd;
+
+  void *sq_ring;
+  size_t sq_ring_size;
+  unsigned *sq_head;
+  unsigned *sq_tail;
+  unsigned sq_mask;
+  unsigned sq_entries;
+  unsigned *sq_array;
+  struct io_uring_sqe *sqes;
+  size_t sqes_size;
+  // Prepared but not yet published to the kernel.
+  unsigned sqe_tail;
+
+  void *cq_ring;
+  size_t cq_ring_size;
+  unsigned *cq_head;
+  unsigned *cq_tail;
+  unsigned cq_mask;
+  struct io_uring_cqe *cqes;
+};
+
+static int uring_enter(int fd, unsigned submit, unsigned wait,
+                       unsigned flags) {
+  return (int)syscall(SYS_io_uring_enter, fd, submit, wait, flags, NULL, 0);
+}
+
+static int uring_register(int fd, unsigned op, const void *arg,
+                          unsigned count) {
+  return (int)syscall(SYS_io_uring_register, fd, op, arg, count);
+}
+
+static int uring_supports(int fd) {
+  static const int required[] = {
+      IORING_OP_NOP,        IORING_OP_POLL_ADD,     IORING_OP_SPLICE,
+      IORING_OP_READ_FIXED, IORING_OP_WRITE_FIXED, IORING_OP_ASYNC_CANCEL,
+  };
+  size_t size = sizeof(struct io_uring_probe) +
+                256 * sizeof(struct io_uring_probe_op);
+  struct io_uring_probe *probe = calloc(1, size);
+  if (probe == NULL) {
+    return 0;
+  }
+  int ok = uring_register(fd, IORING_REGISTER_PROBE, probe, 256) == 0;
+  for (size_t i = 0; ok && i < sizeof(required) / sizeof(required[0]); i++) {
+    int op = required[i];
+    ok = op <= probe->last_op && (probe->ops[op].flags & IO_URING_OP_SUPPORTED);
+  }
+  free(probe);
+  return ok;
+}
+
+void CZ_uring_destroy(struct cz_uring *ring) {
+  if (ring == NULL) {
+    return;
+  }
+  if (ring->sqes != NULL && ring->sqes != MAP_FAILED) {
+    munmap(ring->sqes, ring->sqes_size);
+  }
+  if (ring->cq_ring != NULL && ring->cq_ring != MAP_FAILED &&
+      ring->cq_ring != ring->sq_ring) {
+    munmap(ring->cq_ring, ring->cq_ring_size);
+  }
+  if (ring->sq_ring != NULL && ring->sq_ring != MAP_FAILED) {
+    munmap(ring->sq_ring, ring->sq_ring_size);
+  }
+  if (ring->fd >= 0) {
+    close(ring->fd);
+  }
+  free(ring);
+}
+
+struct cz_uring *CZ_uring_setup(unsigned entries, unsigned files) {
+  struct io_uring_params p;
+  memset(&p, 0, sizeof(p));
+
+  struct cz_uring *ring = calloc(1, sizeof(*ring));
+  if (ring == NULL) {
+    return NULL;
+  }
+  ring->fd = (int)syscall(SYS_io_uring_setup, entries, &p);
+  if (ring->fd < 0) {
+    free(ring);
+    return NULL;
+  }
+
+  int err = EOPNOTSUPP;
+  // Hard links and NODROP completions both arrived by 5.5; the opcode
+  // probe covers splice (5.7).
+  if (!(p.features & IORING_FEAT_NODROP) || !uring_supports(ring->fd)) {
+    goto fail;
+  }
+
+  ring->sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+  ring->cq_ring_size =
+      p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+  if (p.features & IORING_FEAT_SINGLE_MMAP) {
+    if (ring->cq_ring_size > ring->sq_ring_size) {
+      ring->sq_ring_size = ring->cq_ring_size;
+    }
+    ring->cq_ring_size = ring->sq_ring_size;
+  }
+
+  ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+  if (ring->sq_ring == MAP_FAILED) {
+    err = errno;
+    goto fail;
+  }
+  if (p.features & IORING_FEAT_SINGLE_MMAP) {
+    ring->cq_ring = ring->sq_ring;
+  } else {
+    ring->cq_ring =
+        mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+    if (ring->cq_ring == MAP_FAILED) {
+      err = errno;
+      goto fail;
+    }
+  }
+  ring->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+  ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+  if (ring->sqes == MAP_FAILED) {
+    err = errno;
+    goto fail;
+  }
+
+  char *sq = ring->sq_ring;
+  ring->sq_head = (unsigned *)(sq + p.sq_off.head);
+  ring->sq_tail = (unsigned *)(sq + p.sq_off.tail);
+  ring->sq_mask = *(unsigned *)(sq + p.sq_off.ring_mask);
+  ring->sq_entries = p.sq_entries;
+  ring->sq_array = (unsigned *)(sq + p.sq_off.array);
+  ring->sqe_tail = *ring->sq_tail;
+  // SQEs are always used in ring order, so the index array is the identity.
+  for (unsigned i = 0; i < p.sq_entries; i++) {
+    ring->sq_array[i] = i;
+  }
+
+  char *cq = ring->cq_ring;
+  ring->cq_head = (unsigned *)(cq + p.cq_off.head);
+  ring->cq_tail = (unsigned *)(cq + p.cq_off.tail);
+  ring->cq_mask = *(unsigned *)(cq + p.cq_off.ring_mask);
+  ring->cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+
+  if (files > 0) {
+    int *fds = malloc(files * sizeof(int));
+    if (fds == NULL) {
+      err = ENOMEM;
+      goto fail;
+    }
+    for (unsigned i = 0; i < files; i++) {
+      fds[i] = -1;
+    }
+    int rc = uring_register(ring->fd, IORING_REGISTER_FILES, fds, files);
+    err = errno;
+    free(fds);
+    if (rc != 0) {
+      goto fail;
+    }
+  }
+  return ring;
+
+fail:
+  CZ_uring_destroy(ring);
+  errno = err;
+  return NULL;
+}
+
+int CZ_uring_update_file(struct cz_uring *ring, unsigned slot, int fd) {
+  struct io_uring_files_update update;
+  memset(&update, 0, sizeof(update));
+  update.offset = slot;
+  update.fds = (uint64_t)(uintptr_t)&fd;
+  int rc = uring_register(ring->fd, IORING_REGISTER_FILES_UPDATE, &update, 1);
+  return rc < 0 ? -1 : 0;
+}
+
+int CZ_uring_register_buffers(struct cz_uring *ring, const struct iovec *iovs,
+                              unsigned count) {
+  return uring_register(ring->fd, IORING_REGISTER_BUFFERS, iovs, count);
+}
+
+static struct io_uring_sqe *uring_get_sqe(struct cz_uring *ring,
+                                          unsigned flags) {
+  unsigned head = atomic_load_explicit((_Atomic unsigned *)ring->sq_head,
+                                       memory_order_acquire);
+  if (ring->sqe_tail - head >= ring->sq_entries) {
+    return NULL;
+  }
+  struct io_uring_sqe *sqe = &ring->sqes[ring->sqe_tail & ring->sq_mask];
+  ring->sqe_tail++;
+  memset(sqe, 0, sizeof(*sqe));
+  if (flags & CZ_URING_FIXED_FILE) {
+    sqe->flags |= IOSQE_FIXED_FILE;
+  }
+  if (flags & CZ_URING_HARDLINK) {
+    sqe->flags |= IOSQE_IO_HARDLINK;
+  }
+  return sqe;
+}
+
+int CZ_uring_prep_nop(struct cz_uring *ring, unsigned flags,
+                      uint64_t user_data) {
+  struct io_uring_sqe *sqe = uring_get_sqe(ring, flags);
+  if (sqe == NULL) {
+    return -EBUSY;
+  }
+  sqe->opcode = IORING_OP_NOP;
+  sqe->fd = -1;
+  sqe->user_data = user_data;
+  return 0;
+}
+
+int CZ_uring_prep_poll(struct cz_uring *ring, int fd, unsigned events,
+                       unsigned flags, uint64_t user_data) {
+  struct io_uring_sqe *sqe = uring_get_sqe(ring, flags);
+  if (sqe == NULL) {
+    return -EBUSY;
+  }
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = fd;
+  sqe->poll_events = (uint16_t)events;
+  sqe->user_data = user_data;
+  return 0;
+}
+
+int CZ_uring_prep_splice(struct cz_uring *ring, int fd_in, int fd_out,
+                         unsigned len, unsigned splice_flags, unsigned flags,
+                         uint64_t user_data) {
+  struct io_uring_sqe *sqe = uring_get_sqe(ring, flags);
+  if (sqe == NULL) {
+    return -EBUSY;
+  }
+  sqe->opcode = IORING_OP_SPLICE;
+  sqe->fd = fd_out;
+  sqe->len = len;
+  // -1 offsets: use and advance the file position, as splice(2) with NULL.
+  sqe->off = (uint64_t)-1;
+  sqe->splice_off_in = (uint64_t)-1;
+  sqe->splice_fd_in = fd_in;
+  sqe->splice_flags = splice_flags;
+  if (flags & CZ_URING_FIXED_IN) {
+    sqe->splice_flags |= SPLICE_F_FD_IN_FIXED;
+  }
+  sqe->user_data = user_data;
+  return 0;
+}
+
+static int uring_prep_rw_fixed(struct cz_uring *ring, int op, int fd,
+                               const void *buf, unsigned len, uint64_t offset,
+                               unsigned buf_index, unsigned flags,
+                               uint64_t user_data) {
+  struct io_uring_sqe *sqe = uring_get_sqe(ring, flags);
+  if (sqe == NULL) {
+    return -EBUSY;
+  }
+  sqe->opcode = (uint8_t)op;
+  sqe->fd = fd;
+  sqe->addr = (uint64_t)(uintptr_t)buf;
+  sqe->len = len;
+  sqe->off = offset;
+  sqe->buf_index = (uint16_t)buf_index;
+  sqe->user_data = user_data;
+  return 0;
+}
+
+int CZ_uring_prep_read_fixed(struct cz_uring *ring, int fd, void *buf,
+                             unsigned len, uint64_t offset,
+                             unsigned buf_index, unsigned flags,
+                             uint64_t user_data) {
+  return uring_prep_rw_fixed(ring, IORING_OP_READ_FIXED, fd, buf, len, offset,
+                             buf_index, flags, user_data);
+}
+
+int CZ_uring_prep_write_fixed(struct cz_uring *ring, int fd, const void *buf,
+                              unsigned len, uint64_t offset,
+                              unsigned buf_index, unsigned flags,
+                              uint64_t user_data) {
+  return uring_prep_rw_fixed(ring, IORING_OP_WRITE_FIXED, fd, buf, len, offset,
+                             buf_index, flags, user_data);
+}
+
+int CZ_uring_prep_cancel(struct cz_uring *ring, uint64_t target,
+                         uint64_t user_data) {
+  struct io_uring_sqe *sqe = uring_get_sqe(ring, 0);
+  if (sqe == NULL) {
+    return -EBUSY;
+  }
+  sqe->opcode = IORING_OP_ASYNC_CANCEL;
+  sqe->fd = -1;
+  sqe->addr = target;
+  sqe->user_data = user_data;
+  return 0;
+}
+
+unsigned CZ_uring_sq_space(struct cz_uring *ring) {
+  unsigned head = atomic_load_explicit((_Atomic unsigned *)ring->sq_head,
+                                       memory_order_acquire);
+  return ring->sq_entries - (ring->sqe_tail - head);
+}
+
+unsigned CZ_uring_publish(struct cz_uring *ring) {
+  // Release, so the SQE contents are visible before the kernel sees the tail.
+  atomic_store_explicit((_Atomic unsigned *)ring->sq_tail, ring->sqe_tail,
+                        memory_order_release);
+  unsigned head = atomic_load_explicit((_Atomic unsigned *)ring->sq_head,
+                                       memory_order_acquire);
+  return ring->sqe_tail - head;
+}
+
+int CZ_uring_enter(struct cz_uring *ring, unsigned submit, unsigned wait) {
+  if (submit == 0 && wait == 0) {
+    return 0;
+  }
+  unsigned flags = wait > 0 ? IORING_ENTER_GETEVENTS : 0;
+  int rc = uring_enter(ring->fd, submit, wait, flags);
+  if (rc >= 0) {
+    return rc;
+  }
+  if (errno == EINTR) {
+    return 0;
+  }
+  return -errno;
+}
+
+int CZ_uring_submit(struct cz_uring *ring, unsigned wait) {
+  return CZ_uring_enter(ring, CZ_uring_publish(ring), wait);
+}
+
+unsigned CZ_uring_reap(struct cz_uring *ring, struct cz_uring_completion *out,
+                       unsigned max) {
+  unsigned head = *ring->cq_head;
+  unsigned tail = atomic_load_explicit((_Atomic unsigned *)ring->cq_tail,
+                                       memory_order_acquire);
+  unsigned n = 0;
+  while (head != tail && n < max) {
+    struct io_uring_cqe *cqe = &ring->cqes[head & ring->cq_mask];
+    out[n].user_data = cqe->user_data;
+    out[n].res = cqe->res;
+    out[n].flags = cqe->flags;
+    head++;
+    n++;
+  }
+  atomic_store_explicit((_Atomic unsigned *)ring->cq_head, head,
+                        memory_order_release);
+  return n;
+}
+
+#endif
@@ -47,6 +47,9 @@ public struct AgentCommand: AsyncParsableCommand {
 
     @OptionGroup var options: LogLevelOption
 
+    @Option(name: .long, help: "I/O engine for stdio relays, vsock proxies and copies (epoll, io-uring)")
+    var ioEngine: IOEngine = .epoll
+
     public init() {}
 
     /// Bootstrap the vminitd environment and create an Initd server.
@@ -107,12 +110,16 @@ public struct AgentCommand: AsyncParsableCommand {
             ),
         ]
 
-        for mnt in mounts {
-            log.info("mounting \(mnt.target)")
+        try GuestBootTrace.span("mounts") {
+            for mnt in mounts {
+                log.info("mounting \(mnt.target)")
 
-            try mnt.mount(createWithPerms: 0o755)
+                try mnt.mount(createWithPerms: 0o755)
+            }
+            try Binfmt.mount()
         }
-        try Binfmt.mount()
+
+        let cgroupStart = GuestBootTrace.now()
 
         let cgManager = Cgroup2Manager(
             group: URL(filePath: "/vminitd"),
@@ -129,6 +136,7 @@ public struct AgentCommand: AsyncParsableCommand {
         try cgManager.setMemoryHigh(bytes: high)
         try cgManager.setMemoryLow(bytes: low)
         try cgManager.addProcess(pid: getpid())
+        GuestBootTrace.record("cgroups", start: cgroupStart)
 
         let memoryMonitor = try MemoryMonitor(
             cgroupManager: cgManager,
@@ -161,9 +169,11 @@ public struct AgentCommand: AsyncParsableCommand {
 
     public mutating func run() async throws {
         let server = try await Self.bootstrap(options: options)
+        IOEngine.select(ioEngine, log: server.log)
 
         do {
             server.log.info("serving vminitd API")
+            GuestBootTrace.instant("serving")
             try await server.serve(port: Self.vsockPort)
             server.log.info("vminitd API returned, syncing filesystems")
 
@@ -37,14 +37,7 @@ struct DirectCommandRunner: CommandRunner {
     }
 
     func wait(_ cmd: Command, subscription: ProcessSubscription) async throws -> Int32 {
-        var rus = rusage()
-        var ws = Int32()
-
-        let result = wait4(cmd.pid, &ws, 0, &rus)
-        guard result == cmd.pid else {
-            throw POSIXError(.init(rawValue: errno)!)
-        }
-        return Command.toExitStatus(ws)
+        try await cmd.waitForExit()
     }
 }
 
@@ -23,6 +23,8 @@ import Foundation
 struct ContainerExitStatus: Sendable {
     var exitCode: Int32
     var exitedAt: Date
+    /// Resource usage from the reaper, if the process was reaped by it.
+    var usage: ResourceUsage? = nil
 }
 
 /// Protocol for managing container processes
@@ -63,8 +65,8 @@ protocol ContainerProcess: Sendable {
     /// - Throws: If cleanup fails
     func delete() async throws
 
-    /// Set the exit status of the process.
-    func setExit(_ status: Int32)
+    /// Set the exit status and reaped resource usage of the process.
+    func setExit(_ status: Int32, usage: ResourceUsage?)
 }
 
 #endif
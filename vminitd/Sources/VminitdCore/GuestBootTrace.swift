@@ -0,0 +1,101 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+#if os(Linux)
+
+import Containerization
+import Synchronization
+
+/// vminitd's own boot timeline, served to the host by the `BootTrace` RPC.
+/// Events land on the ``BootTrace/Lane/guest`` lane, stamped with the
+/// guest's monotonic clock.
+///
+/// Agent boot spans belong to the VM; container spans are kept per container
+/// so a trace for one container never shows another's. A VM adopted from the
+/// warm pool or restored from a snapshot template booted for someone else,
+/// so the host calls ``reset()`` once it takes the VM over.
+public enum GuestBootTrace {
+    static let recorder = Mutex(BootTraceRecorder())
+    static let containers = Mutex<[String: BootTraceRecorder]>([:])
+
+    /// Current guest `CLOCK_MONOTONIC` time in microseconds.
+    public static func now() -> Int64 {
+        BootTraceRecorder.now()
+    }
+
+    /// Record a span from `start` (from ``now()``) until now, against
+    /// `containerID` or, when nil, the VM.
+    public static func record(
+        _ name: String,
+        start: Int64,
+        end: Int64 = BootTraceRecorder.now(),
+        containerID: String? = nil
+    ) {
+        recorder(for: containerID).record(name, lane: .guest, start: start, end: end)
+    }
+
+    /// Record a point in time.
+    public static func instant(_ name: String) {
+        recorder(for: nil).instant(name, lane: .guest)
+    }
+
+    /// Run `body` and record it as a span.
+    public static func span<T>(_ name: String, _ body: () throws -> T) rethrows -> T {
+        let start = now()
+        defer { record(name, start: start) }
+        return try body()
+    }
+
+    /// Forget the spans recorded for `containerID`, so a container created
+    /// again under the same ID starts a fresh timeline.
+    static func removeContainer(_ containerID: String) {
+        _ = containers.withLock { $0.removeValue(forKey: containerID) }
+    }
+
+    /// Drop everything recorded so far, VM and containers alike.
+    static func reset() {
+        recorder.withLock { $0 = BootTraceRecorder() }
+        containers.withLock { $0.removeAll() }
+    }
+
+    /// The VM's events plus those of `containerID`, if given, and a
+    /// ``BootTrace/clockAnchorEvent`` stamped now for the host to line the
+    /// clocks up against.
+    static func anchoredTrace(containerID: String? = nil) -> BootTrace {
+        var trace = recorder(for: nil).trace
+        if let containerID, let container = containers.withLock({ $0[containerID] }) {
+            trace.traceEvents += container.trace.traceEvents
+        }
+        trace.traceEvents.append(.init(name: BootTrace.clockAnchorEvent, lane: .guest, kind: .instant, timestamp: now()))
+        return trace
+    }
+
+    private static func recorder(for containerID: String?) -> BootTraceRecorder {
+        guard let containerID else {
+            return recorder.withLock { $0 }
+        }
+        return containers.withLock { recorders in
+            if let existing = recorders[containerID] {
+                return existing
+            }
+            let created = BootTraceRecorder()
+            recorders[containerID] = created
+            return created
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,58 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+#if os(Linux)
+
+import ArgumentParser
+import Logging
+import Synchronization
+
+/// How vminitd moves bytes for stdio relays, vsock proxies and file copies.
+public enum IOEngine: String, CaseIterable, ExpressibleByArgument, Sendable {
+    /// Readiness from the process supervisor's epoll, then a syscall per
+    /// read and write.
+    case epoll
+    /// A shared io_uring: relays run as linked splice chains on registered
+    /// files, and copies go through registered buffers.
+    case ioUring = "io-uring"
+
+    private static let selected = Mutex<IOUring?>(nil)
+
+    /// The ring the data paths should use, or nil for epoll.
+    static var uring: IOUring? {
+        selected.withLock { $0 }
+    }
+
+    /// Choose the engine for the rest of the process, falling back to epoll
+    /// if the kernel can't run io_uring. Returns the engine in use.
+    @discardableResult
+    public static func select(_ engine: IOEngine, log: Logger) -> IOEngine {
+        guard engine == .ioUring else {
+            return .epoll
+        }
+        do {
+            let ring = try IOUring(log: log)
+            selected.withLock { $0 = ring }
+            log.info("using io_uring for data paths")
+            return .ioUring
+        } catch {
+            log.warning("io_uring unavailable, falling back to epoll", metadata: ["error": "\(error)"])
+            return .epoll
+        }
+    }
+}
+
+#endif
@@ -33,6 +33,7 @@ final class IOPair: Sendable {
         let buffer: UnsafeMutableBufferPointer<UInt8>
         var closed: Bool
         var registeredFd: Int32?
+        var uringRelay: IOUring.Relay?
 
         func drain() {
             let readFrom = OSFile(fd: from.fileDescriptor)
@@ -66,6 +67,13 @@ final class IOPair: Sendable {
                 return
             }
 
+            // Stop the io_uring relay, which flushes what it already read,
+            // then drain whatever is left.
+            if let relay = self.uringRelay {
+                relay.cancel()
+                self.uringRelay = nil
+            }
+
             // Try and drain IO first.
             self.drain()
 
@@ -108,7 +116,8 @@ final class IOPair: Sendable {
                 to: writeTo,
                 buffer: buffer,
                 closed: false,
-                registeredFd: nil
+                registeredFd: nil,
+                uringRelay: nil
             ))
         self.reason = reason
         self.logger = logger
@@ -117,6 +126,12 @@ final class IOPair: Sendable {
     func relay(ignoreHup: Bool = false) throws {
         self.logger?.info("setting up relay for \(reason)")
 
+        // io_uring polls are level-triggered, so a hangup that's ignored
+        // would fire forever. Those relays (terminals) stay on epoll.
+        if !ignoreHup, let ring = IOEngine.uring {
+            return try self.relay(on: ring)
+        }
+
         let (readFromFd, writeToFd) = self.io.withLock { io in
             io.registeredFd = io.from.fileDescriptor
             return (io.from.fileDescriptor, io.to.fileDescriptor)
@@ -178,6 +193,33 @@ final class IOPair: Sendable {
         }
     }
 
+    private func relay(on ring: IOUring) throws {
+        let (readFromFd, writeToFd) = self.io.withLock { io in
+            (io.from.fileDescriptor, io.to.fileDescriptor)
+        }
+
+        // As registering with epoll would; `drain` also relies on it.
+        let flags = fcntl(readFromFd, F_GETFL)
+        guard flags != -1, fcntl(readFromFd, F_SETFL, flags | O_NONBLOCK) != -1 else {
+            throw POSIXError.fromErrno()
+        }
+
+        let relay = try IOUring.Relay(ring: ring, from: readFromFd, to: writeToFd) { finish in
+            switch finish {
+            case .cancelled:
+                // Whoever cancelled is closing the pair.
+                return
+            case .eof:
+                self.logger?.debug("closing relay for \(readFromFd)")
+            case .error(let errno):
+                self.logger?.error("failed with errno \(errno) while relaying for fd \(readFromFd)")
+            }
+            self.close()
+        }
+        self.io.withLock { $0.uringRelay = relay }
+        try relay.start()
+    }
+
     func close() {
         self.io.withLock { io in
             self.logger?.info("closing relay for \(reason)")
@@ -0,0 +1,85 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+#if os(Linux)
+
+import ContainerizationOS
+import Foundation
+
+extension IOUring {
+    /// Copy from `source` to `destination` until EOF, blocking the caller.
+    ///
+    /// Uses two registered buffers, reading into one while the other is
+    /// written out, so each chunk costs a single submission. Returns the
+    /// number of bytes copied, or nil without touching either descriptor
+    /// if no buffers are free.
+    func copy(from source: Int32, to destination: Int32) throws -> Int? {
+        guard let buffers = acquireBuffers(2) else {
+            return nil
+        }
+        defer { releaseBuffers(buffers) }
+
+        var total = 0
+        var current = 0
+        var filled = try wait([.readFixed(source, buffer: buffers[0], count: buffers[0].count)])[0]
+        while true {
+            guard filled >= 0 else {
+                throw POSIXError(.init(rawValue: -filled) ?? .EIO)
+            }
+            if filled == 0 {
+                return total
+            }
+
+            let next = 1 - current
+            let results = try wait([
+                .writeFixed(destination, buffer: buffers[current], at: 0, count: Int(filled)),
+                .readFixed(source, buffer: buffers[next], count: buffers[next].count),
+            ])
+            var written = results[0]
+            while written > 0 && written < filled {
+                let more = try wait([
+                    .writeFixed(destination, buffer: buffers[current], at: Int(written), count: Int(filled - written))
+                ])[0]
+                written = more > 0 ? written + more : more
+            }
+            guard written == filled else {
+                throw POSIXError(.init(rawValue: written < 0 ? -written : EIO) ?? .EIO)
+            }
+
+            total += Int(filled)
+            filled = results[1]
+            current = next
+        }
+    }
+
+    private final class Results: @unchecked Sendable {
+        // Written before `ready` is signalled, read after it's waited on.
+        var values: [Int32] = []
+        let ready = DispatchSemaphore(value: 0)
+    }
+
+    private func wait(_ operations: [Operation]) throws -> [Int32] {
+        let results = Results()
+        try submit(operations) { values in
+            results.values = values
+            results.ready.signal()
+        }
+        results.ready.wait()
+        return results.values
+    }
+}
+
+#endif
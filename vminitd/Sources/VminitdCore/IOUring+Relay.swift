@@ -0,0 +1,236 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+#if os(Linux)
+
+import ContainerizationOS
+import Foundation
+import LCShim
+import Synchronization
+
+extension IOUring {
+    /// Moves bytes one way, from a readable descriptor to a writable one,
+    /// until EOF, an error, or `cancel`.
+    ///
+    /// Each round is one hard-linked chain: poll the source for input,
+    /// splice what's there into a pipe, and splice the pipe out to the
+    /// destination. Whatever the destination doesn't take stays in the pipe
+    /// and is flushed, after a poll for output, before the source is read
+    /// again. Stopping early (cancel or a read error) flushes the pipe the
+    /// same way before finishing, so the completion thread never blocks on
+    /// a slow reader. The source must be non-blocking.
+    final class Relay: Sendable {
+        enum Finish: Sendable, Equatable {
+            /// The source hit EOF and everything read was written.
+            case eof
+            case error(Int32)
+            case cancelled
+        }
+
+        private struct State {
+            // Bytes sitting in the pipe.
+            var pending = 0
+            var eof = false
+            var inFlight: Group?
+            var cancelled = false
+            // Set while the pipe is flushed before finishing this way.
+            var finishing: Finish?
+            var writeFailed = false
+            var finished = false
+        }
+
+        private let ring: IOUring
+        private let source: File
+        private let sink: File
+        private let pipeRead: Int32
+        private let pipeWrite: Int32
+        private let chunk: Int
+        private let onFinish: @Sendable (Finish) -> Void
+        private let state = Mutex(State())
+        private let done = DispatchSemaphore(value: 0)
+
+        /// - Parameter onFinish: Runs once, on the ring's completion thread,
+        ///   after the relay has stopped touching either descriptor.
+        init(
+            ring: IOUring,
+            from source: Int32,
+            to destination: Int32,
+            chunk: Int = 1 << 16,
+            onFinish: @escaping @Sendable (Finish) -> Void
+        ) throws {
+            var fds: [Int32] = [0, 0]
+            guard Foundation.pipe(&fds) == 0 else {
+                throw POSIXError.fromErrno()
+            }
+            for fd in fds {
+                _ = fcntl(fd, F_SETFD, FD_CLOEXEC)
+            }
+            self.ring = ring
+            self.pipeRead = fds[0]
+            self.pipeWrite = fds[1]
+            self.chunk = chunk
+            self.onFinish = onFinish
+            self.source = ring.registerFile(source)
+            self.sink = ring.registerFile(destination)
+        }
+
+        func start() throws {
+            try state.withLock { state in
+                state.inFlight = try submit(readRound)
+            }
+        }
+
+        /// Stop relaying. Bytes already taken from the source are written
+        /// out before the relay finishes. With `wait`, returns only once it
+        /// has; don't wait from the ring's completion thread.
+        func cancel(wait: Bool = true) {
+            let (group, finishNow, inFlight) = state.withLock { state -> (Group?, Bool, Bool) in
+                if state.finished || state.cancelled {
+                    return (nil, false, !state.finished)
+                }
+                state.cancelled = true
+                guard let group = state.inFlight else {
+                    return (nil, true, false)
+                }
+                // Already flushing the pipe; let it finish.
+                if state.finishing != nil {
+                    return (nil, false, true)
+                }
+                return (group, false, true)
+            }
+            if let group {
+                ring.cancel(group)
+            }
+            if finishNow {
+                finish(.cancelled)
+            }
+            if wait && inFlight {
+                done.wait()
+                done.signal()
+            }
+        }
+
+        private var readRound: [Operation] {
+            [
+                .poll(source, events: CZ_URING_POLLIN),
+                .splice(from: source, to: .fd(pipeWrite), count: chunk),
+                .splice(from: .fd(pipeRead), to: sink, count: chunk),
+            ]
+        }
+
+        private func flushRound(_ pending: Int) -> [Operation] {
+            [
+                .poll(sink, events: CZ_URING_POLLOUT),
+                .splice(from: .fd(pipeRead), to: sink, count: pending),
+            ]
+        }
+
+        private func submit(_ operations: [Operation]) throws -> Group {
+            try ring.submit(operations, linked: true) { results in
+                self.completed(results)
+            }
+        }
+
+        private func completed(_ results: [Int32]) {
+            let finish: Finish? = state.withLock { state in
+                state.inFlight = nil
+
+                var failure: Int32?
+                if results.count == 3 {
+                    switch results[1] {
+                    case 1...:
+                        state.pending += Int(results[1])
+                    case 0, -EIO:
+                        state.eof = true
+                    case -EAGAIN, -EINTR, -ECANCELED:
+                        break
+                    default:
+                        failure = -results[1]
+                    }
+                }
+                let wrote = results[results.count - 1]
+                switch wrote {
+                case 1...:
+                    state.pending -= Int(wrote)
+                case 0, -EAGAIN, -EINTR, -ECANCELED:
+                    break
+                default:
+                    state.writeFailed = true
+                    failure = failure ?? -wrote
+                }
+
+                // After the accounting above, so a cancelled round's bytes
+                // still get flushed.
+                let outcome: Finish?
+                if let finishing = state.finishing {
+                    outcome = finishing
+                } else if state.cancelled {
+                    outcome = .cancelled
+                } else if let failure {
+                    outcome = .error(failure)
+                } else if state.eof && state.pending == 0 {
+                    outcome = .eof
+                } else {
+                    outcome = nil
+                }
+                if let outcome {
+                    // Hand over what was already read first. For a blocking
+                    // destination this waits for the reader, as a plain
+                    // write would, but on the ring rather than this thread.
+                    guard state.pending > 0, !state.writeFailed else {
+                        return outcome
+                    }
+                    state.finishing = outcome
+                    guard let group = try? submit(flushRound(state.pending)) else {
+                        return outcome
+                    }
+                    state.inFlight = group
+                    return nil
+                }
+                do {
+                    state.inFlight = try submit(state.pending > 0 ? flushRound(state.pending) : readRound)
+                    return nil
+                } catch {
+                    return .error((error as? POSIXError)?.code.rawValue ?? EIO)
+                }
+            }
+            if let finish {
+                self.finish(finish)
+            }
+        }
+
+        private func finish(_ reason: Finish) {
+            let first = state.withLock { state -> Bool in
+                guard !state.finished else {
+                    return false
+                }
+                state.finished = true
+                return true
+            }
+            guard first else {
+                return
+            }
+            ring.unregisterFile(source)
+            ring.unregisterFile(sink)
+            close(pipeRead)
+            close(pipeWrite)
+            done.signal()
+            onFinish(reason)
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,332 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+#if os(Linux)
+
+import ContainerizationOS
+import Foundation
+import LCShim
+import Logging
+import Synchronization
+
+/// A shared io_uring for vminitd's data paths.
+///
+/// Work is submitted in groups of operations, optionally hard-linked so they
+/// run in order, and a group's callback runs once every operation in it has
+/// completed. One thread reaps completions and runs the callbacks. Work
+/// submitted while it is doing so is handed to the kernel with its next wait,
+/// so a round of completions and everything they trigger costs a single
+/// io_uring_enter.
+final class IOUring: Sendable {
+    /// A descriptor an operation works on.
+    enum File: Sendable {
+        case fd(Int32)
+        /// A registered file slot, from `registerFile`.
+        case slot(UInt32)
+    }
+
+    /// A buffer registered with the ring, from `acquireBuffers`.
+    struct Buffer: @unchecked Sendable {
+        let index: UInt32
+        let base: UnsafeMutableRawPointer
+        let count: Int
+    }
+
+    enum Operation: Sendable {
+        case nop
+        /// Wait for any of `events` (CZ_URING_POLL*) on a descriptor.
+        case poll(File, events: Int32)
+        /// Splice up to `count` bytes. The pipe end never blocks; the other
+        /// descriptor behaves as its O_NONBLOCK flag says.
+        case splice(from: File, to: File, count: Int)
+        /// Read up to `count` bytes into the start of `buffer` at the
+        /// descriptor's current position.
+        case readFixed(Int32, buffer: Buffer, count: Int)
+        /// Write `count` bytes from `buffer`, starting `at` bytes in.
+        case writeFixed(Int32, buffer: Buffer, at: Int, count: Int)
+    }
+
+    /// Called with each operation's result, in submission order: a byte
+    /// count, poll events, or a negated errno.
+    typealias Completion = @Sendable ([Int32]) -> Void
+
+    /// A submitted group, for `cancel`.
+    struct Group: Hashable, Sendable {
+        fileprivate let id: UInt64
+    }
+
+    private struct Pending {
+        var results: [Int32]
+        var remaining: Int
+        let completion: Completion
+    }
+
+    private struct State {
+        var nextID: UInt64 = 1
+        var groups: [UInt64: Pending] = [:]
+        var freeSlots: [UInt32]
+        var freeBuffers: [Buffer]
+        // Set while the completion thread runs callbacks. It submits
+        // whatever they queue right after, so they don't enter themselves.
+        var reaping = false
+    }
+
+    // Submission-side calls happen under `state`; reaping happens only on
+    // the completion thread.
+    private nonisolated(unsafe) let ring: OpaquePointer
+    private let state: Mutex<State>
+    private let log: Logger?
+
+    // Operation index within its group, in the low bits of user_data.
+    // Group 0 marks completions nobody waits for, such as cancellations.
+    private static let indexBits: UInt64 = 8
+
+    /// - Parameters:
+    ///   - entries: Submission queue size.
+    ///   - files: Registered file slots for long-lived relays.
+    ///   - buffers: Registered buffers for copies, pinned for the life of
+    ///     the ring.
+    ///   - bufferSize: Size of each registered buffer.
+    init(
+        entries: UInt32 = 256,
+        files: UInt32 = 1024,
+        buffers: Int = 4,
+        bufferSize: Int = 256 * 1024,
+        log: Logger? = nil
+    ) throws {
+        guard let ring = CZ_uring_setup(entries, files) else {
+            throw POSIXError.fromErrno()
+        }
+        self.ring = ring
+        self.log = log
+
+        var registered: [Buffer] = []
+        if buffers > 0 {
+            let pageSize = Int(getpagesize())
+            var iovecs: [iovec] = []
+            for index in 0..<buffers {
+                let base = UnsafeMutableRawPointer.allocate(byteCount: bufferSize, alignment: pageSize)
+                registered.append(Buffer(index: UInt32(index), base: base, count: bufferSize))
+                iovecs.append(iovec(iov_base: base, iov_len: bufferSize))
+            }
+            if CZ_uring_register_buffers(ring, iovecs, UInt32(iovecs.count)) != 0 {
+                // Copies fall back to plain reads and writes.
+                log?.warning("failed to register io_uring buffers", metadata: ["errno": "\(errno)"])
+                for buffer in registered {
+                    buffer.base.deallocate()
+                }
+                registered = []
+            }
+        }
+
+        self.state = Mutex(
+            State(
+                freeSlots: Array((0..<files).reversed()),
+                freeBuffers: registered
+            ))
+
+        let t = Thread {
+            self.run()
+        }
+        t.start()
+    }
+
+    /// Submit `operations` as one group. With `linked`, each operation
+    /// starts only after the one before it completes, whatever its result.
+    @discardableResult
+    func submit(
+        _ operations: [Operation],
+        linked: Bool = false,
+        completion: @escaping Completion
+    ) throws -> Group {
+        precondition(!operations.isEmpty && operations.count < 1 << Self.indexBits, "bad io_uring group size")
+
+        let (group, toSubmit) = try state.withLock { state in
+            try reserve(operations.count)
+
+            let id = state.nextID
+            state.nextID += 1
+            for (index, operation) in operations.enumerated() {
+                let link = linked && index < operations.count - 1
+                let rc = prep(
+                    operation,
+                    flags: link ? UInt32(CZ_URING_HARDLINK) : 0,
+                    userData: id << Self.indexBits | UInt64(index)
+                )
+                precondition(rc == 0, "io_uring submission queue overrun")
+            }
+            state.groups[id] = Pending(
+                results: .init(repeating: 0, count: operations.count),
+                remaining: operations.count,
+                completion: completion
+            )
+            return (Group(id: id), state.reaping ? 0 : CZ_uring_publish(ring))
+        }
+        // A failure here leaves the SQEs published; the completion thread
+        // submits them with its next wait.
+        _ = CZ_uring_enter(ring, toSubmit, 0)
+        return group
+    }
+
+    /// Ask the kernel to cancel whatever in `group` hasn't completed. The
+    /// group's callback still runs, with -ECANCELED for what was cancelled.
+    func cancel(_ group: Group) {
+        let toSubmit: UInt32 = state.withLock { state in
+            guard let pending = state.groups[group.id] else {
+                return 0
+            }
+            guard (try? reserve(pending.results.count)) != nil else {
+                log?.error("io_uring submission queue full, cannot cancel")
+                return 0
+            }
+            for index in 0..<pending.results.count {
+                _ = CZ_uring_prep_cancel(ring, group.id << Self.indexBits | UInt64(index), 0)
+            }
+            return state.reaping ? 0 : CZ_uring_publish(ring)
+        }
+        _ = CZ_uring_enter(ring, toSubmit, 0)
+    }
+
+    /// Register `fd` in a fixed file slot, which saves the kernel a file
+    /// table lookup per operation. Falls back to the plain descriptor when
+    /// all slots are taken.
+    func registerFile(_ fd: Int32) -> File {
+        state.withLock { state in
+            guard let slot = state.freeSlots.popLast() else {
+                return .fd(fd)
+            }
+            guard CZ_uring_update_file(ring, slot, fd) == 0 else {
+                state.freeSlots.append(slot)
+                return .fd(fd)
+            }
+            return .slot(slot)
+        }
+    }
+
+    /// Release a slot from `registerFile`. Nothing may still be queued
+    /// against it.
+    func unregisterFile(_ file: File) {
+        guard case .slot(let slot) = file else {
+            return
+        }
+        state.withLock { state in
+            _ = CZ_uring_update_file(ring, slot, -1)
+            state.freeSlots.append(slot)
+        }
+    }
+
+    /// Take `count` registered buffers, or nil if that many aren't free.
+    func acquireBuffers(_ count: Int) -> [Buffer]? {
+        state.withLock { state in
+            guard state.freeBuffers.count >= count else {
+                return nil
+            }
+            let taken = Array(state.freeBuffers.suffix(count))
+            state.freeBuffers.removeLast(count)
+            return taken
+        }
+    }
+
+    func releaseBuffers(_ buffers: [Buffer]) {
+        state.withLock { $0.freeBuffers.append(contentsOf: buffers) }
+    }
+
+    // Called under `state`. Makes room for `count` SQEs by handing what's
+    // queued to the kernel.
+    private func reserve(_ count: Int) throws {
+        if CZ_uring_sq_space(ring) >= count {
+            return
+        }
+        _ = CZ_uring_enter(ring, CZ_uring_publish(ring), 0)
+        guard CZ_uring_sq_space(ring) >= count else {
+            throw POSIXError(.EBUSY)
+        }
+    }
+
+    private func prep(_ operation: Operation, flags: UInt32, userData: UInt64) -> Int32 {
+        switch operation {
+        case .nop:
+            return CZ_uring_prep_nop(ring, flags, userData)
+        case .poll(let file, let events):
+            let (fd, fileFlags) = Self.resolve(file, fixed: CZ_URING_FIXED_FILE)
+            return CZ_uring_prep_poll(ring, fd, UInt32(events), flags | fileFlags, userData)
+        case .splice(let from, let to, let count):
+            let (fdIn, inFlags) = Self.resolve(from, fixed: CZ_URING_FIXED_IN)
+            let (fdOut, outFlags) = Self.resolve(to, fixed: CZ_URING_FIXED_FILE)
+            return CZ_uring_prep_splice(
+                ring, fdIn, fdOut, UInt32(count), UInt32(bitPattern: LCShim.SPLICE_F_NONBLOCK),
+                flags | inFlags | outFlags, userData)
+        case .readFixed(let fd, let buffer, let count):
+            return CZ_uring_prep_read_fixed(
+                ring, fd, buffer.base, UInt32(count), UInt64.max, buffer.index, flags, userData)
+        case .writeFixed(let fd, let buffer, let offset, let count):
+            return CZ_uring_prep_write_fixed(
+                ring, fd, buffer.base + offset, UInt32(count), UInt64.max, buffer.index, flags, userData)
+        }
+    }
+
+    private static func resolve(_ file: File, fixed: Int32) -> (Int32, UInt32) {
+        switch file {
+        case .fd(let fd):
+            return (fd, 0)
+        case .slot(let slot):
+            return (Int32(slot), UInt32(fixed))
+        }
+    }
+
+    private func run() {
+        var completions = [cz_uring_completion](repeating: cz_uring_completion(), count: 256)
+        while true {
+            let toSubmit = state.withLock { _ in CZ_uring_publish(ring) }
+            let rc = CZ_uring_enter(ring, toSubmit, 1)
+            // EBUSY and EAGAIN mean completions are backed up or memory is
+            // short; reaping is how both clear.
+            if rc < 0 && rc != -EBUSY && rc != -EAGAIN {
+                preconditionFailure("io_uring_enter failed: \(POSIXError(.init(rawValue: -rc) ?? .EIO))")
+            }
+
+            let n = completions.withUnsafeMutableBufferPointer {
+                Int(CZ_uring_reap(ring, $0.baseAddress, UInt32($0.count)))
+            }
+            if n == 0 {
+                continue
+            }
+
+            var ready: [(Completion, [Int32])] = []
+            state.withLock { state in
+                state.reaping = true
+                for completion in completions[0..<n] {
+                    let id = completion.user_data >> Self.indexBits
+                    let index = Int(completion.user_data & ((1 << Self.indexBits) - 1))
+                    guard id != 0, state.groups[id] != nil else {
+                        continue
+                    }
+                    state.groups[id]!.results[index] = completion.res
+                    state.groups[id]!.remaining -= 1
+                    if state.groups[id]!.remaining == 0, let done = state.groups.removeValue(forKey: id) {
+                        ready.append((done.completion, done.results))
+                    }
+                }
+            }
+            for (completion, results) in ready {
+                completion(results)
+            }
+            state.withLock { $0.reaping = false }
+        }
+    }
+}
+
+#endif
@@ -269,7 +269,7 @@ extension ManagedProcess {
         }
     }
 
-    func setExit(_ status: Int32) {
+    func setExit(_ status: Int32, usage: ResourceUsage?) {
         self.state.withLock { state in
             self.log.info(
                 "managed process exit",
@@ -277,7 +277,7 @@ extension ManagedProcess {
                     "status": "\(status)"
                 ])
 
-            let exitStatus = ContainerExitStatus(exitCode: status, exitedAt: Date.now)
+            let exitStatus = ContainerExitStatus(exitCode: status, exitedAt: Date.now, usage: usage)
             state.exitStatus = exitStatus
 
             do {
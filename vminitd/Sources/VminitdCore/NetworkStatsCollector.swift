@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+// Copyright © 2026 Apple Inc. and the Containerization project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//===----------------------------------------------------------------------===//
+
+#if os(Linux)
+
+import ContainerizationNetlink
+import Logging
+import Synchronization
+
+/// Serves per-interface network statistics from a single `RTM_GETLINK` dump
+/// per sampling interval.
+///
+/// Every container in the guest shares the root network namespace, so one
+/// snapshot of the guest's interfaces answers a statistics request for any
+/// number of containers; concurrent requests inside the interval reuse it
+/// rather than each opening a socket and querying every link.
+final class NetworkStatsCollector: Sendable {
+    struct Interface: Sendable {
+        let name: String
+        let statistics: LinkStatistics64
+    }
+
+    private struct Snapshot {
+        var sampledAt: ContinuousClock.Instant?
+        var interfaces: [Interface] = []
+    }
+
+    private let interval: Duration
+    private let log: Logger
+    private let snapshot = Mutex(Snapshot())
+
+    init(interval: Duration = .milliseconds(250), log: Logger) {
+        self.interval = interval
+        self.log = log
+    }
+
+    /// Statistics for the guest's container interfaces, at most `interval`
+    /// old.
+    func interfaces() throws -> [Interface] {
+        try snapshot.withLock { snapshot in
+            let now = ContinuousClock.now
+            if let sampledAt = snapshot.sampledAt, now - sampledAt < interval {
+                return snapshot.interfaces
+            }
+
+            let session = NetlinkSession(socket: try DefaultNetlinkSocket(), log: log)
+            let links = try session.linkGet(includeStats: true)
+            snapshot.interfaces.removeAll(keepingCapacity: true)
+            for link in links {
+                // NOTE: This works because today every NIC in the root net
+                // namespace is for the container(s), and we only create
+                // ethernet devices. If individual containers ever get their
+                // own NICs this needs to change.
+                guard let name = link.name, name.hasPrefix("eth"),
+                    let statistics = try link.getStatistics()
+                else {
+                    continue
+                }
+                snapshot.interfaces.append(Interface(name: name, statistics: statistics))
+            }
+            snapshot.sampledAt = now
+            return snapshot.interfaces
+        }
+    }
+}
+
+#endif
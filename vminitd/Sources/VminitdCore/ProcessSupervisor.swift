@@ -23,7 +23,7 @@ import Synchronization
 
 final class ProcessSupervisor: Sendable {
     private let poller: Epoll
-    private let handlers = Mutex<[Int32: @Sendable (Epoll.Mask) -> Void]>([:])
+    private let handlers = EpollHandlerTable<@Sendable (Epoll.Mask) -> Void>()
 
     private let queue: DispatchQueue
     // `DispatchSourceSignal` is thread-safe.
@@ -50,16 +50,14 @@ final class ProcessSupervisor: Sendable {
         self.poller = try! Epoll()
         self.state = Mutex(State())
         let t = Thread {
-            while true {
-                guard let events = self.poller.wait() else {
+            // Reused across wakeups; dispatch takes no lock per event.
+            var batch = Epoll.EventBatch(capacity: 1024)
+            while self.poller.wait(into: &batch) {
+                if batch.isEmpty {
                     return
                 }
-                if events.isEmpty {
-                    return
-                }
-                for event in events {
-                    let handler = self.handlers.withLock { $0[event.fd] }
-                    handler?(event.mask)
+                self.handlers.dispatch(batch) { handler, event in
+                    handler(event.mask)
                 }
             }
         }
@@ -75,18 +73,18 @@ final class ProcessSupervisor: Sendable {
         mask: Epoll.Mask = [.input, .output],
         handler: @escaping @Sendable (Epoll.Mask) -> Void
     ) throws {
-        self.handlers.withLock { $0[fd] = handler }
+        try self.handlers.set(fd, handler)
         do {
             try self.poller.add(fd, mask: mask)
         } catch {
-            self.handlers.withLock { _ = $0.removeValue(forKey: fd) }
+            self.handlers.remove(fd)
             throw error
         }
     }
 
     /// Remove a file descriptor from epoll monitoring and discard its handler.
     func unregisterFd(_ fd: Int32) throws {
-        self.handlers.withLock { _ = $0.removeValue(forKey: fd) }
+        self.handlers.remove(fd)
         try self.poller.delete(fd)
     }
 
@@ -100,10 +98,10 @@ final class ProcessSupervisor: Sendable {
     private func handleSignal() {
         dispatchPrecondition(condition: .onQueue(queue))
 
-        let exited = Reaper.reap()
+        let exited = Reaper.reapWithUsage()
 
-        for (pid, status) in exited {
-            reaperCommandRunner.notifyExit(pid: pid, status: status)
+        for (pid, exit) in exited {
+            reaperCommandRunner.notifyExit(pid: pid, status: exit.status)
         }
 
         self.state.withLock { state in
@@ -122,15 +120,17 @@ final class ProcessSupervisor: Sendable {
                     continue
                 }
 
-                if let status = exited[pid] {
+                if let exit = exited[pid] {
                     state.log?.debug(
                         "managed process exited",
                         metadata: [
                             "pid": "\(pid)",
-                            "status": "\(status)",
+                            "status": "\(exit.status)",
+                            "cpu": "\(exit.usage.cpuTime)",
+                            "maxRSS": "\(exit.usage.maxRSSBytes)",
                             "count": "\(state.processes.count - 1)",
                         ])
-                    proc.setExit(status)
+                    proc.setExit(exit.status, usage: exit.usage)
                     state.processes.removeAll(where: { $0.pid == pid })
                 }
             }
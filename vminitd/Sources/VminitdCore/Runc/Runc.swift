@@ -335,11 +335,18 @@ extension Runc {
             extraFiles: extraFiles
         )
 
-        // Setup IO
-        let outPipe = Pipe()
+        // Setup IO. Output is only captured when the caller didn't supply
+        // stdout. Otherwise the streams belong to the container: `runc
+        // create` hands them to its init, which would hold a capture pipe
+        // open for the container's lifetime, so an unset stderr goes to
+        // /dev/null instead (opened fresh: FileHandle.nullDevice's sentinel
+        // fd doesn't survive the child's dup2).
+        let outPipe = stdout == nil ? Pipe() : nil
+        let devNull = outPipe == nil && stderr == nil ? FileHandle(forWritingAtPath: "/dev/null") : nil
+        defer { try? devNull?.close() }
         cmd.stdin = stdin
-        cmd.stdout = stdout ?? outPipe.fileHandleForWriting
-        cmd.stderr = stderr ?? outPipe.fileHandleForWriting
+        cmd.stdout = stdout ?? outPipe?.fileHandleForWriting
+        cmd.stderr = stderr ?? outPipe?.fileHandleForWriting ?? devNull
 
         if let pdeathSignal = pdeathSignal {
             cmd.attrs.pdeathSignal = pdeathSignal
@@ -349,23 +356,26 @@ extension Runc {
             cmd.attrs.setPGroup = true
         }
 
-        let exitStatus: Int32
-
+        var subscription: ProcessSubscription?
         if let runner = commandRunner {
-            let subscription = try runner.start(&cmd)
-            exitStatus = try await runner.wait(cmd, subscription: subscription)
+            subscription = try runner.start(&cmd)
         } else {
             try cmd.start()
-            exitStatus = try cmd.wait()
         }
+        // Drop our copy of the write end so the read sees EOF when runc
+        // exits, and drain while waiting so runc can't stall on a full pipe.
+        try? outPipe?.fileHandleForWriting.close()
+        async let drained = outPipe?.fileHandleForReading.readToEndAsync()
 
-        var output = Data()
-        if stdout == nil {
-            try? outPipe.fileHandleForWriting.close()
-            output = try outPipe.fileHandleForReading.readToEnd() ?? Data()
+        let exitStatus: Int32
+        if let runner = commandRunner, let subscription {
+            exitStatus = try await runner.wait(cmd, subscription: subscription)
+        } else {
+            exitStatus = try await cmd.waitForExit()
         }
 
-        return (exitStatus, output)
+        let output = try await drained
+        return (exitStatus, output ?? Data())
     }
 
     /// Execute command and parse JSON output
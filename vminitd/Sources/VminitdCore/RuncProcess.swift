@@ -201,7 +201,7 @@ final class RuncProcess: ContainerProcess, Sendable {
         return pid
     }
 
-    func setExit(_ status: Int32) {
+    func setExit(_ status: Int32, usage: ResourceUsage?) {
         self.state.withLock {
             self.log.info(
                 "runc process exit",
@@ -209,7 +209,7 @@ final class RuncProcess: ContainerProcess, Sendable {
                     "status": "\(status)"
                 ])
 
-            let exitStatus = ContainerExitStatus(exitCode: status, exitedAt: Date.now)
+            let exitStatus = ContainerExitStatus(exitCode: status, exitedAt: Date.now, usage: usage)
             $0.state = .exited(exitStatus)
 
             do {
@@ -207,14 +207,27 @@ extension Initd: Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServ
                 "port": "\(request.vsockPort)",
                 "guestPath": "\(request.guestPath)",
                 "action": "\(request.action)",
+                "transport": "\(request.transport)",
+                "guestPort": "\(request.guestPort)",
             ])
 
+        let transport: VsockProxy.Transport
+        switch request.transport {
+        case .tcp:
+            transport = .tcp(UInt16(truncatingIfNeeded: request.guestPort))
+        case .udp:
+            transport = .udp(UInt16(truncatingIfNeeded: request.guestPort))
+        case .unix, .UNRECOGNIZED:
+            transport = .unix
+        }
+
         let proxy = VsockProxy(
             id: request.id,
             action: request.action == .into ? .dial : .listen,
             port: request.vsockPort,
             path: URL(fileURLWithPath: request.guestPath),
             udsPerms: request.guestSocketPermissions,
+            transport: transport,
             log: log
         )
 
@@ -505,6 +518,10 @@ extension Initd: Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServ
                 }
                 defer { close(fd) }
 
+                if let ring = IOEngine.uring, try ring.copy(from: sockFd, to: fd) != nil {
+                    return []
+                }
+
                 var buf = [UInt8](repeating: 0, count: Self.copyChunkSize)
                 while true {
                     let n = read(sockFd, &buf, buf.count)
@@ -605,6 +622,10 @@ extension Initd: Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServ
                 }
                 defer { close(srcFd) }
 
+                if let ring = IOEngine.uring, try ring.copy(from: srcFd, to: sock.fileDescriptor) != nil {
+                    return
+                }
+
                 var buf = [UInt8](repeating: 0, count: Self.copyChunkSize)
                 while true {
                     let n = read(srcFd, &buf, buf.count)
@@ -655,54 +676,49 @@ extension Initd: Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServ
             ])
 
         do {
-            let mnt = ContainerizationOS.Mount(
-                type: request.type,
-                source: request.source,
-                target: request.destination,
-                options: request.options
-            )
-
             #if os(Linux)
-            do {
-                try mnt.mount(createWithPerms: 0o755)
-            } catch {
-                // A hot-plugged virtio device (virtio-blk / virtio-fs) may not
-                // be enumerated by the guest yet when the host issues this
-                // mount immediately after vm.add-disk / vm.add-fs: cloud-
-                // hypervisor places the device on the PCI bus but the guest
-                // does not always auto-probe it. Force a PCI rescan and retry
-                // with a bounded wait. Scoped to hot-plug-candidate sources so
-                // an ordinary mount failure isn't delayed.
-                let hotplugCandidate = request.type == "virtiofs" || request.source.hasPrefix("/dev/vd")
-                guard hotplugCandidate else { throw error }
-
-                if let rescan = FileHandle(forWritingAtPath: "/sys/bus/pci/rescan") {
-                    defer { try? rescan.close() }
-                    do {
-                        try rescan.write(contentsOf: Data("1".utf8))
-                        log.info("mount: triggered PCI bus rescan for hot-plugged device")
-                    } catch {
-                        log.error("mount: PCI rescan write failed", metadata: ["error": "\(error)"])
-                    }
-                } else {
-                    log.error("mount: cannot open /sys/bus/pci/rescan")
-                }
+            try await mountHotplugAware(request)
+            return .init()
+            #else
+            fatalError("mount not supported on platform")
+            #endif
+        } catch {
+            log.error(
+                "mount",
+                metadata: [
+                    "error": "\(error)"
+                ])
+            throw RPCError(code: .internalError, message: "mount", cause: error)
+        }
+    }
 
-                var mounted = false
-                for attempt in 1...20 {  // up to ~2s for the device to enumerate
-                    try? await Task.sleep(for: .milliseconds(100))
-                    do {
-                        try mnt.mount(createWithPerms: 0o755)
-                        log.info("mount: succeeded after PCI rescan", metadata: ["attempt": "\(attempt)"])
-                        mounted = true
-                        break
-                    } catch {
-                        continue
+    public func mountBatch(request: Com_Apple_Containerization_Sandbox_V3_MountBatchRequest, context: GRPCCore.ServerContext)
+        async throws -> Com_Apple_Containerization_Sandbox_V3_MountBatchResponse
+    {
+        log.debug(
+            "mountBatch",
+            metadata: [
+                "count": "\(request.mounts.count)",
+                "sources": "\(request.mounts.map(\.source))",
+            ])
+
+        do {
+            #if os(Linux)
+            // Wait for every hot-plugged block device in one pass rather than
+            // discovering them one mount at a time, then mount concurrently.
+            // Each mount still falls back to the per-mount rescan/retry path,
+            // which also covers virtio-fs tags (they have no device node to
+            // wait on).
+            let devices = request.mounts.map(\.source).filter { $0.hasPrefix("/dev/vd") }
+            await waitForHotplugDevices(devices)
+
+            try await withThrowingTaskGroup(of: Void.self) { group in
+                for mount in request.mounts {
+                    group.addTask {
+                        try await self.mountHotplugAware(mount)
                     }
                 }
-                if !mounted {
-                    throw error
-                }
+                try await group.waitForAll()
             }
             return .init()
             #else
@@ -710,14 +726,92 @@ extension Initd: Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServ
             #endif
         } catch {
             log.error(
-                "mount",
+                "mountBatch",
                 metadata: [
                     "error": "\(error)"
                 ])
-            throw RPCError(code: .internalError, message: "mount", cause: error)
+            throw RPCError(code: .internalError, message: "mountBatch", cause: error)
         }
     }
 
+    #if os(Linux)
+    /// Mount `request`, tolerating a hot-plugged virtio device that the guest
+    /// has not enumerated yet.
+    private func mountHotplugAware(_ request: Com_Apple_Containerization_Sandbox_V3_MountRequest) async throws {
+        let mnt = ContainerizationOS.Mount(
+            type: request.type,
+            source: request.source,
+            target: request.destination,
+            options: request.options
+        )
+
+        do {
+            try mnt.mount(createWithPerms: 0o755)
+        } catch {
+            // A hot-plugged virtio device (virtio-blk / virtio-fs) may not
+            // be enumerated by the guest yet when the host issues this
+            // mount immediately after vm.add-disk / vm.add-fs: cloud-
+            // hypervisor places the device on the PCI bus but the guest
+            // does not always auto-probe it. Force a PCI rescan and retry
+            // with a bounded wait. Scoped to hot-plug-candidate sources so
+            // an ordinary mount failure isn't delayed.
+            let hotplugCandidate = request.type == "virtiofs" || request.source.hasPrefix("/dev/vd")
+            guard hotplugCandidate else { throw error }
+
+            rescanPCIBus()
+
+            var mounted = false
+            for attempt in 1...20 {  // up to ~2s for the device to enumerate
+                try? await Task.sleep(for: .milliseconds(100))
+                do {
+                    try mnt.mount(createWithPerms: 0o755)
+                    log.info("mount: succeeded after PCI rescan", metadata: ["attempt": "\(attempt)"])
+                    mounted = true
+                    break
+                } catch {
+                    continue
+                }
+            }
+            if !mounted {
+                throw error
+            }
+        }
+    }
+
+    /// Wait (up to ~2s) for all of `devices` to appear under /dev, issuing at
+    /// most one PCI rescan for the whole set. Returns early once every node
+    /// exists; devices that never show up are left for the per-mount retry
+    /// to report.
+    private func waitForHotplugDevices(_ devices: [String]) async {
+        var missing = devices.filter { !FileManager.default.fileExists(atPath: $0) }
+        guard !missing.isEmpty else { return }
+
+        rescanPCIBus()
+        for _ in 1...100 {
+            try? await Task.sleep(for: .milliseconds(20))
+            missing.removeAll { FileManager.default.fileExists(atPath: $0) }
+            if missing.isEmpty {
+                return
+            }
+        }
+        log.warning("mountBatch: hot-plugged devices did not appear", metadata: ["missing": "\(missing)"])
+    }
+
+    private func rescanPCIBus() {
+        guard let rescan = FileHandle(forWritingAtPath: "/sys/bus/pci/rescan") else {
+            log.error("mount: cannot open /sys/bus/pci/rescan")
+            return
+        }
+        defer { try? rescan.close() }
+        do {
+            try rescan.write(contentsOf: Data("1".utf8))
+            log.info("mount: triggered PCI bus rescan for hot-plugged device")
+        } catch {
+            log.error("mount: PCI rescan write failed", metadata: ["error": "\(error)"])
+        }
+    }
+    #endif
+
     public func filesystemOperation(request: Com_Apple_Containerization_Sandbox_V3_FilesystemOperationRequest, context: GRPCCore.ServerContext)
         async throws -> Com_Apple_Containerization_Sandbox_V3_FilesystemOperationResponse
     {
@@ -960,6 +1054,7 @@ extension Initd: Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServ
                     try hostname.write(toFile: hostnamePath.path, atomically: true, encoding: .utf8)
                 }
 
+                let created = GuestBootTrace.now()
                 let ctr = try await ManagedContainer(
                     id: request.id,
                     stdio: stdioPorts,
@@ -968,6 +1063,7 @@ extension Initd: Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServ
                     log: self.log
                 )
                 try await self.state.add(container: ctr)
+                GuestBootTrace.record("createContainer", start: created, containerID: request.id)
             }
 
             return .init()
@@ -1064,6 +1160,7 @@ extension Initd: Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServ
             if request.id == request.containerID {
                 try await ctr.delete()
                 try await state.remove(container: request.id)
+                GuestBootTrace.removeContainer(request.id)
             } else {
                 // Or just a single exec.
                 try await ctr.deleteExec(id: request.id)
@@ -1113,7 +1210,13 @@ extension Initd: Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServ
             }
 
             let ctr = try await self.state.get(container: request.containerID)
+            let started = GuestBootTrace.now()
             let pid = try await ctr.start(execID: request.id)
+            // Execs come and go for the life of the sandbox; only the init
+            // process belongs on the boot timeline.
+            if request.id == request.containerID {
+                GuestBootTrace.record("startContainer", start: started, containerID: request.containerID)
+            }
 
             return .with {
                 $0.pid = pid
@@ -1218,6 +1321,9 @@ extension Initd: Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServ
             return .with {
                 $0.exitCode = exitStatus.exitCode
                 $0.exitedAt = Google_Protobuf_Timestamp(date: exitStatus.exitedAt)
+                if let usage = exitStatus.usage {
+                    $0.usage = .init(usage)
+                }
             }
         } catch let err as ContainerizationError {
             log.error(
@@ -1334,8 +1440,8 @@ extension Initd: Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServ
             let socket = try DefaultNetlinkSocket()
             let session = NetlinkSession(socket: socket, log: log)
             let ipv4Address = try CIDRv4(request.ipv4Address)
-            try session.addressAdd(interface: request.interface, ipv4Address: ipv4Address)
-            if request.hasIpv6Address {
+            let ipv6Address = request.hasIpv6Address ? try CIDRv6(request.ipv6Address) : nil
+            if ipv6Address != nil {
                 // Suppress SLAAC on this interface before adding the static
                 // address: the host would provide a static IPv6 config, this
                 // auto-derived IPv6 config would compete with the static one.
@@ -1355,9 +1461,13 @@ extension Initd: Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServ
                             ])
                     }
                 }
+            }
 
-                let ipv6Address = try CIDRv6(request.ipv6Address)
-                try session.addressAdd(interface: request.interface, ipv6Address: ipv6Address)
+            try session.batch {
+                try session.addressAdd(interface: request.interface, ipv4Address: ipv4Address)
+                if let ipv6Address {
+                    try session.addressAdd(interface: request.interface, ipv6Address: ipv6Address)
+                }
             }
         } catch {
             log.error(
@@ -1394,23 +1504,25 @@ extension Initd: Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServ
         do {
             let socket = try DefaultNetlinkSocket()
             let session = NetlinkSession(socket: socket, log: log)
-            if !request.dstIpv4Addr.isEmpty {
-                let dstIpv4Addr = try CIDRv4(request.dstIpv4Addr)
-                let srcIpv4Addr = request.srcIpv4Addr.isEmpty ? nil : try IPv4Address(request.srcIpv4Addr)
-                try session.routeAdd(
-                    interface: request.interface,
-                    dstIpv4Addr: dstIpv4Addr,
-                    srcIpv4Addr: srcIpv4Addr
-                )
-            }
-            if request.hasDstIpv6Addr {
-                let dstIpv6Addr = try CIDRv6(request.dstIpv6Addr)
-                let srcIpv6Addr = request.hasSrcIpv6Addr ? try IPv6Address(request.srcIpv6Addr) : nil
-                try session.routeAdd(
-                    interface: request.interface,
-                    dstIpv6Addr: dstIpv6Addr,
-                    srcIpv6Addr: srcIpv6Addr
-                )
+            try session.batch {
+                if !request.dstIpv4Addr.isEmpty {
+                    let dstIpv4Addr = try CIDRv4(request.dstIpv4Addr)
+                    let srcIpv4Addr = request.srcIpv4Addr.isEmpty ? nil : try IPv4Address(request.srcIpv4Addr)
+                    try session.routeAdd(
+                        interface: request.interface,
+                        dstIpv4Addr: dstIpv4Addr,
+                        srcIpv4Addr: srcIpv4Addr
+                    )
+                }
+                if request.hasDstIpv6Addr {
+                    let dstIpv6Addr = try CIDRv6(request.dstIpv6Addr)
+                    let srcIpv6Addr = request.hasSrcIpv6Addr ? try IPv6Address(request.srcIpv6Addr) : nil
+                    try session.routeAdd(
+                        interface: request.interface,
+                        dstIpv6Addr: dstIpv6Addr,
+                        srcIpv6Addr: srcIpv6Addr
+                    )
+                }
             }
         } catch {
             log.error(
@@ -1439,17 +1551,19 @@ extension Initd: Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServ
         do {
             let socket = try DefaultNetlinkSocket()
             let session = NetlinkSession(socket: socket, log: log)
-            if !request.ipv4Gateway.isEmpty {
-                let ipv4Gateway = try IPv4Address(request.ipv4Gateway)
-                try session.routeAddDefault(interface: request.interface, ipv4Gateway: ipv4Gateway)
-            } else if !request.hasIpv6Gateway {
-                // No v4 gateway and no v6 either: install a v4 default route
-                // with no gateway (preserves pre-IPv6 behavior).
-                try session.routeAddDefault(interface: request.interface, ipv4Gateway: nil)
-            }
-            if request.hasIpv6Gateway {
-                let ipv6Gateway = try IPv6Address(request.ipv6Gateway)
-                try session.routeAddDefault(interface: request.interface, ipv6Gateway: ipv6Gateway)
+            try session.batch {
+                if !request.ipv4Gateway.isEmpty {
+                    let ipv4Gateway = try IPv4Address(request.ipv4Gateway)
+                    try session.routeAddDefault(interface: request.interface, ipv4Gateway: ipv4Gateway)
+                } else if !request.hasIpv6Gateway {
+                    // No v4 gateway and no v6 either: install a v4 default route
+                    // with no gateway (preserves pre-IPv6 behavior).
+                    try session.routeAddDefault(interface: request.interface, ipv4Gateway: nil)
+                }
+                if request.hasIpv6Gateway {
+                    let ipv6Gateway = try IPv6Address(request.ipv6Gateway)
+                    try session.routeAddDefault(interface: request.interface, ipv6Gateway: ipv6Gateway)
+                }
             }
         } catch {
             log.error(
@@ -1476,6 +1590,7 @@ extension Initd: Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServ
                 "domain": "\(domain ?? "")",
                 "searchDomains": "\(request.searchDomains)",
                 "options": "\(request.options)",
+                "localCache": "\(request.localCache)",
             ])
 
         do {
@@ -1486,8 +1601,12 @@ extension Initd: Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServ
                 nameservers: request.nameservers,
                 domain: domain,
                 searchDomains: request.searchDomains,
-                options: request.options
+                options: request.options,
+                localCache: request.localCache
             )
+            if config.localCache {
+                try await state.startDNSStub(upstreams: config.nameservers, location: request.location)
+            }
             let text = config.resolvConf
             log.debug("writing to path \(resolvConf.path) \(text)")
             try text.write(toFile: resolvConf.path, atomically: true, encoding: .utf8)
@@ -1522,6 +1641,7 @@ extension Initd: Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServ
             let config = request.toCZHosts()
             let text = config.hostsFile
             try text.write(toFile: hostsPath.path, atomically: true, encoding: .utf8)
+            await state.setDNSStubHosts(config.entries, location: request.location)
 
             log.debug("wrote /etc/hosts configuration", metadata: ["path": "\(hostsPath.path)"])
         } catch {
@@ -1558,8 +1678,23 @@ extension Initd: Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServ
             let wantNetwork = wantAll || categories.contains(.network)
             let wantMemoryEvents = wantAll || categories.contains(.memoryEvents)
 
-            // Get all network interfaces (skip loopback) only if needed
-            let interfaces = wantNetwork ? try getNetworkInterfaces() : []
+            // One link dump serves every container in the request.
+            var networkStats: [Com_Apple_Containerization_Sandbox_V3_NetworkStats] = []
+            if wantNetwork {
+                for interface in try self.networkStats.interfaces() {
+                    let stats = interface.statistics
+                    networkStats.append(
+                        .with {
+                            $0.interface = interface.name
+                            $0.receivedPackets = stats.rxPackets
+                            $0.transmittedPackets = stats.txPackets
+                            $0.receivedBytes = stats.rxBytes
+                            $0.transmittedBytes = stats.txBytes
+                            $0.receivedErrors = stats.rxErrors
+                            $0.transmittedErrors = stats.txErrors
+                        })
+                }
+            }
 
             // Get containers to query
             let containerIDs: [String]
@@ -1583,28 +1718,6 @@ extension Initd: Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServ
 
                 let cgStats: Cgroup2Stats? = cgCategories.isEmpty ? nil : try await container.stats(cgCategories)
 
-                // Get network stats only if requested
-                var networkStats: [Com_Apple_Containerization_Sandbox_V3_NetworkStats] = []
-                if wantNetwork {
-                    let socket = try DefaultNetlinkSocket()
-                    let session = NetlinkSession(socket: socket, log: log)
-                    for interface in interfaces {
-                        let responses = try session.linkGet(interface: interface, includeStats: true)
-                        if responses.count == 1, let stats = try responses[0].getStatistics() {
-                            networkStats.append(
-                                .with {
-                                    $0.interface = interface
-                                    $0.receivedPackets = stats.rxPackets
-                                    $0.transmittedPackets = stats.txPackets
-                                    $0.receivedBytes = stats.rxBytes
-                                    $0.transmittedBytes = stats.txBytes
-                                    $0.receivedErrors = stats.rxErrors
-                                    $0.transmittedErrors = stats.txErrors
-                                })
-                        }
-                    }
-                }
-
                 // Get memory events only if requested
                 var memoryEvents: MemoryEvents?
                 if wantMemoryEvents {
@@ -1650,23 +1763,6 @@ extension Initd: Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServ
         return error
     }
 
-    // NOTE: This is just crummy. It works because today the assumption is
-    // every NIC in the root net namespace is for the container(s), but if we
-    // ever supported individual containers having their own NICs/IPs then this
-    // logic needs to change. We only create ethernet devices today too, so that's
-    // what this filters for as well.
-    private func getNetworkInterfaces() throws -> [String] {
-        let netPath = URL(filePath: "/sys/class/net")
-        let interfaces = try FileManager.default.contentsOfDirectory(
-            at: netPath,
-            includingPropertiesForKeys: nil
-        )
-        return
-            interfaces
-            .map { $0.lastPathComponent }
-            .filter { $0.hasPrefix("eth") }
-    }
-
     private func mapStatsToProto(
         containerID: String,
         cgStats: Cgroup2Stats?,
@@ -1752,6 +1848,78 @@ extension Initd: Com_Apple_Containerization_Sandbox_V3_SandboxContext.SimpleServ
         }
     }
 
+    public func bootTrace(
+        request: Com_Apple_Containerization_Sandbox_V3_BootTraceRequest,
+        context: GRPCCore.ServerContext
+    ) async throws -> Com_Apple_Containerization_Sandbox_V3_BootTraceResponse {
+        log.debug(
+            "bootTrace",
+            metadata: [
+                "containerID": "\(request.containerID)",
+                "reset": "\(request.reset)",
+            ])
+
+        if request.reset {
+            GuestBootTrace.reset()
+            return .init()
+        }
+        do {
+            let containerID = request.containerID.isEmpty ? nil : request.containerID
+            let trace = try GuestBootTrace.anchoredTrace(containerID: containerID).jsonData()
+            return .with {
+                $0.trace = trace
+            }
+        } catch {
+            log.error(
+                "bootTrace",
+                metadata: [
+                    "error": "\(error)"
+                ])
+            throw RPCError(code: .internalError, message: "failed to encode boot trace", cause: error)
+        }
+    }
+
+    public func reseed(
+        request: Com_Apple_Containerization_Sandbox_V3_ReseedRequest,
+        context: GRPCCore.ServerContext
+    ) async throws -> Com_Apple_Containerization_Sandbox_V3_ReseedResponse {
+        log.debug(
+            "reseed",
+            metadata: [
+                "bytes": "\(request.entropy.count)"
+            ])
+
+        let fd = open("/dev/urandom", O_WRONLY | O_CLOEXEC)
+        guard fd != -1 else {
+            let error = swiftErrno("open")
+            throw RPCError(code: .internalError, message: "reseed: failed to open /dev/urandom", cause: error)
+        }
+        defer { close(fd) }
+
+        // struct rand_pool_info { int entropy_count; int buf_size; __u32 buf[]; }
+        // A write(2) to /dev/urandom only mixes the bytes in; RNDADDENTROPY
+        // credits them, and RNDRESEEDCRNG makes the CRNG use them now rather
+        // than at its next scheduled reseed.
+        let RNDADDENTROPY: UInt = 0x4008_5203
+        let RNDRESEEDCRNG: UInt = 0x5207
+        var info = [UInt8](repeating: 0, count: 8 + request.entropy.count)
+        let count = Int32(request.entropy.count)
+        withUnsafeBytes(of: count * 8) { info.replaceSubrange(0..<4, with: $0) }
+        withUnsafeBytes(of: count) { info.replaceSubrange(4..<8, with: $0) }
+        info.replaceSubrange(8..., with: request.entropy)
+
+        let rc: CInt = info.withUnsafeMutableBytes { ioctl(fd, RNDADDENTROPY, $0.baseAddress!) }
+        if rc != 0 {
+            let error = swiftErrno("ioctl(RNDADDENTROPY)")
+            throw RPCError(code: .internalError, message: "reseed: failed to add entropy", cause: error)
+        }
+        if ioctl(fd, RNDRESEEDCRNG, 0) != 0 {
+            let error = swiftErrno("ioctl(RNDRESEEDCRNG)")
+            throw RPCError(code: .internalError, message: "reseed: failed to reseed", cause: error)
+        }
+        return .init()
+    }
+
     public func sync(
         request: Com_Apple_Containerization_Sandbox_V3_SyncRequest,
         context: GRPCCore.ServerContext
@@ -1796,6 +1964,26 @@ extension Com_Apple_Containerization_Sandbox_V3_ConfigureHostsRequest {
     }
 }
 
+extension Com_Apple_Containerization_Sandbox_V3_ResourceUsage {
+    init(_ usage: ResourceUsage) {
+        self.init()
+        self.userTimeUsec = Self.microseconds(usage.userTime)
+        self.systemTimeUsec = Self.microseconds(usage.systemTime)
+        self.maxRssBytes = usage.maxRSSBytes
+        self.minorPageFaults = usage.minorPageFaults
+        self.majorPageFaults = usage.majorPageFaults
+        self.voluntaryContextSwitches = usage.voluntaryContextSwitches
+        self.involuntaryContextSwitches = usage.involuntaryContextSwitches
+        self.blockInputOps = usage.blockInputOps
+        self.blockOutputOps = usage.blockOutputOps
+    }
+
+    private static func microseconds(_ duration: Duration) -> UInt64 {
+        let (seconds, attoseconds) = duration.components
+        return UInt64(clamping: seconds * 1_000_000 + attoseconds / 1_000_000_000_000)
+    }
+}
+
 extension Initd {
     func ociAlterations(id: String, ociSpec: inout ContainerizationOCI.Spec) throws {
         guard var process = ociSpec.process else {
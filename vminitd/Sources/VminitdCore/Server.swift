@@ -16,6 +16,7 @@
 
 #if os(Linux)
 
+import Containerization
 import ContainerizationError
 import Foundation
 import GRPCCore
@@ -29,6 +30,9 @@ public final class Initd: Sendable {
     public actor State {
         private(set) var containers: [String: ManagedContainer] = [:]
         var proxies: [String: VsockProxy] = [:]
+        private var dnsStub: DNSStubResolver?
+        private var dnsStubHosts: [String: [Hosts.Entry]] = [:]
+        private var dnsStubUpstreams: [String: [String]] = [:]
 
         public typealias ContainerDeletedHandler = @Sendable (String) async -> Void
         private var onContainerDeleted: [ContainerDeletedHandler] = []
@@ -77,6 +81,35 @@ public final class Initd: Sendable {
             return proxy
         }
 
+        /// Starts the VM's shared DNS stub resolver, or adds the nameservers
+        /// configured for `location` to the running one. There is one stub
+        /// per VM, so it can't route by caller: it forwards every miss to the
+        /// nameservers of all locations, ordered by location and then as
+        /// configured, and caches the answers for everyone. Containers
+        /// needing isolated resolution shouldn't enable the local cache.
+        func startDNSStub(upstreams: [String], location: String) throws {
+            var all = dnsStubUpstreams
+            all[location] = upstreams
+            var seen = Set<String>()
+            let merged = all.sorted { $0.key < $1.key }.flatMap(\.value).filter { seen.insert($0).inserted }
+            if let dnsStub {
+                try dnsStub.update(upstreams: merged)
+            } else {
+                let stub = DNSStubResolver(configuration: .init(upstreams: merged))
+                try stub.start()
+                stub.update(hosts: dnsStubHosts.sorted { $0.key < $1.key }.flatMap(\.value))
+                dnsStub = stub
+            }
+            dnsStubUpstreams = all
+        }
+
+        /// Records the hosts entries written under `location` so the DNS stub
+        /// answers them. Entries from every location are served together.
+        func setDNSStubHosts(_ entries: [Hosts.Entry], location: String) {
+            dnsStubHosts[location] = entries
+            dnsStub?.update(hosts: dnsStubHosts.sorted { $0.key < $1.key }.flatMap(\.value))
+        }
+
         func remove(container id: String) throws {
             guard let _ = containers.removeValue(forKey: id) else {
                 throw ContainerizationError(
@@ -97,12 +130,14 @@ public final class Initd: Sendable {
     public let state: State
     let group: MultiThreadedEventLoopGroup
     let blockingPool: NIOThreadPool
+    let networkStats: NetworkStatsCollector
 
     public init(log: Logger, group: MultiThreadedEventLoopGroup, blockingPool: NIOThreadPool) {
         self.log = log
         self.group = group
         self.blockingPool = blockingPool
         self.state = State()
+        self.networkStats = NetworkStatsCollector(log: log)
     }
 
     public func serve(port: Int, additionalServices: [any RegistrableRPCService] = []) async throws {
@@ -16,11 +16,13 @@
 
 #if os(Linux)
 
+import ContainerizationError
 import ContainerizationIO
 import ContainerizationOS
 import Foundation
 import LCShim
 import Logging
+import Synchronization
 
 actor VsockProxy {
     enum Action {
@@ -28,6 +30,17 @@ actor VsockProxy {
         case dial
     }
 
+    /// What a `.listen` proxy connects accepted vsock connections to.
+    enum Transport {
+        /// The Unix socket at `path`.
+        case unix
+        /// A TCP port on the loopback address.
+        case tcp(UInt16)
+        /// A UDP port on the loopback address. The vsock stream carries
+        /// datagrams framed by `DatagramFraming`.
+        case udp(UInt16)
+    }
+
     private enum SocketType {
         case unix
         case vsock
@@ -39,6 +52,7 @@ actor VsockProxy {
     private let action: Action
     private let port: UInt32
     private let udsPerms: UInt32?
+    private let transport: Transport
     private let log: Logger?
 
     private var listener: Socket?
@@ -51,6 +65,7 @@ actor VsockProxy {
         port: UInt32,
         path: URL,
         udsPerms: UInt32?,
+        transport: Transport = .unix,
         log: Logger? = nil
     ) {
         self.id = id
@@ -58,6 +73,7 @@ actor VsockProxy {
         self.port = port
         self.path = path
         self.udsPerms = udsPerms
+        self.transport = transport
         self.log = log
     }
 }
@@ -78,6 +94,12 @@ extension VsockProxy {
 
         switch action {
         case .dial:
+            guard case .unix = transport else {
+                throw ContainerizationError(
+                    .invalidArgument,
+                    message: "only Unix sockets can be relayed from the guest to the host"
+                )
+            }
             try dialHost()
         case .listen:
             try dialGuest()
@@ -169,10 +191,14 @@ extension VsockProxy {
                                 "socketType": "\(socketType)",
                             ])
                         do {
-                            try await handleConn(
-                                conn: conn,
-                                connType: socketType
-                            )
+                            if socketType == .vsock, case .udp(let guestPort) = transport {
+                                try await handleDatagramConn(conn: conn, guestPort: guestPort)
+                            } else {
+                                try await handleConn(
+                                    conn: conn,
+                                    connType: socketType
+                                )
+                            }
                         } catch {
                             self.log?.error("failed to handle connection: \(error)")
                         }
@@ -207,7 +233,12 @@ extension VsockProxy {
                         closeOnDeinit: false
                     )
                 case .vsock:
-                    let type = try UnixType(path: path.path)
+                    let type: any ContainerizationOS.SocketType
+                    if case .tcp(let guestPort) = transport {
+                        type = try InetType(address: Self.loopback, port: guestPort)
+                    } else {
+                        type = try UnixType(path: path.path)
+                    }
                     relayTo = try Socket(
                         type: type,
                         closeOnDeinit: false
@@ -215,6 +246,21 @@ extension VsockProxy {
                 }
 
                 try relayTo.connect()
+                if case .tcp = transport {
+                    var one: Int32 = 1
+                    _ = setsockopt(
+                        relayTo.fileDescriptor, Int32(IPPROTO_TCP), TCP_NODELAY, &one,
+                        socklen_t(MemoryLayout<Int32>.size))
+                }
+
+                if let ring = IOEngine.uring {
+                    let metadata: Logger.Metadata = [
+                        "vport": "\(port)",
+                        "uds": "\(path)",
+                        "action": "\(action)",
+                    ]
+                    return try Self.relay(conn, relayTo, on: ring, log: log, metadata: metadata, continuation: c)
+                }
 
                 // `clientFile` isn't used concurrently.
                 nonisolated(unsafe) var clientFile = OSFile.SpliceFile(fd: conn.fileDescriptor)
@@ -363,6 +409,212 @@ extension VsockProxy {
         }
     }
 
+    /// Both directions of a connection relayed through io_uring.
+    private final class UringRelays: Sendable {
+        let relays = Mutex<[IOUring.Relay]>([])
+        let remaining = Atomic<Int>(2)
+
+        func cancelAll() {
+            // Called from a relay's finish handler, on the completion thread.
+            for relay in relays.withLock({ $0 }) {
+                relay.cancel(wait: false)
+            }
+        }
+    }
+
+    /// Splices each direction of a connection with its own io_uring relay.
+    /// A direction that reaches EOF half-closes its destination. The
+    /// connection is torn down once both are done, or as soon as either
+    /// fails.
+    private static func relay(
+        _ client: ContainerizationOS.Socket,
+        _ server: ContainerizationOS.Socket,
+        on ring: IOUring,
+        log: Logger?,
+        metadata: Logger.Metadata,
+        continuation c: CheckedContinuation<Void, Error>
+    ) throws {
+        let clientFd = client.fileDescriptor
+        let serverFd = server.fileDescriptor
+        for fd in [clientFd, serverFd] {
+            let flags = fcntl(fd, F_GETFL)
+            guard flags != -1, fcntl(fd, F_SETFL, flags | O_NONBLOCK) != -1 else {
+                throw POSIXError.fromErrno()
+            }
+        }
+
+        let pair = UringRelays()
+        let finished = { @Sendable (finish: IOUring.Relay.Finish, destination: Int32) in
+            switch finish {
+            case .eof:
+                // half close: the peer sees EOF for this direction only
+                if shutdown(destination, Int32(SHUT_WR)) != 0 {
+                    log?.warning("failed to shut down writes", metadata: metadata.merging(["errno": "\(errno)"]) { $1 })
+                }
+            case .error(let errno):
+                log?.debug("relay failed", metadata: metadata.merging(["errno": "\(errno)"]) { $1 })
+                pair.cancelAll()
+            case .cancelled:
+                pair.cancelAll()
+            }
+            guard pair.remaining.subtract(1, ordering: .acquiringAndReleasing).newValue == 0 else {
+                return
+            }
+            log?.debug("cleaning up", metadata: metadata)
+            do {
+                try client.close()
+                try server.close()
+            } catch {
+                log?.error("Failed to clean up vsock proxy: \(error)")
+            }
+            c.resume()
+        }
+
+        let toServer = try IOUring.Relay(ring: ring, from: clientFd, to: serverFd) { finished($0, serverFd) }
+        let toClient: IOUring.Relay
+        do {
+            toClient = try IOUring.Relay(ring: ring, from: serverFd, to: clientFd) { finished($0, clientFd) }
+        } catch {
+            // With only one relay finished, the connection is left to the
+            // caller's error path.
+            toServer.cancel()
+            throw error
+        }
+        pair.relays.withLock { $0 = [toServer, toClient] }
+
+        do {
+            try toServer.start()
+            try toClient.start()
+        } catch {
+            // Both relays finish as cancelled, which closes the connection.
+            log?.error("failed to start relay: \(error)", metadata: metadata)
+            pair.cancelAll()
+        }
+    }
+
+    private static let loopback = "127.0.0.1"
+
+    /// Relays framed datagrams between a vsock connection and a UDP socket
+    /// connected to `guestPort` on the loopback address. Datagrams the guest
+    /// service sends while the vsock side is backed up are queued up to the
+    /// encoder's capacity and dropped past it, as a UDP hop would.
+    private func handleDatagramConn(
+        conn: ContainerizationOS.Socket,
+        guestPort: UInt16
+    ) async throws {
+        let address = try InetType(address: Self.loopback, port: guestPort)
+        #if canImport(Musl)
+        let type = SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC
+        #else
+        let type = Int32(SOCK_DGRAM.rawValue | SOCK_NONBLOCK.rawValue | SOCK_CLOEXEC.rawValue)
+        #endif
+        let udpFd = socket(address.domain, type, 0)
+        guard udpFd >= 0 else {
+            try? conn.close()
+            throw ContainerizationError(.internalError, message: "failed to create UDP socket: errno \(errno)")
+        }
+        var rc: Int32 = 0
+        try address.withSockAddr { ptr, len in
+            rc = connect(udpFd, ptr, socklen_t(len))
+        }
+        let vsockFd = conn.fileDescriptor
+        let flags = fcntl(vsockFd, F_GETFL)
+        guard rc == 0, flags != -1, fcntl(vsockFd, F_SETFL, flags | O_NONBLOCK) != -1 else {
+            let err = errno
+            close(udpFd)
+            try? conn.close()
+            throw ContainerizationError(.internalError, message: "failed to set up UDP relay to \(address): errno \(err)")
+        }
+
+        try await withCheckedThrowingContinuation { (c: CheckedContinuation<Void, Error>) in
+            // Only touched from the ProcessSupervisor's epoll thread once both
+            // fds are registered.
+            nonisolated(unsafe) var encoder = DatagramFraming.Encoder()
+            nonisolated(unsafe) var decoder = DatagramFraming.Decoder()
+            nonisolated(unsafe) var buffer = [UInt8](repeating: 0, count: DatagramFraming.maxDatagramSize)
+            nonisolated(unsafe) var done = false
+
+            // Closes both ends and resumes the caller, with `error` if the relay
+            // could not be set up.
+            let finish = { @Sendable [log, port] (error: (any Error)?) in
+                guard !done else {
+                    return
+                }
+                done = true
+                log?.debug(
+                    "cleaning up UDP relay",
+                    metadata: ["vport": "\(port)", "guestPort": "\(guestPort)", "vsockFd": "\(vsockFd)"]
+                )
+                try? ProcessSupervisor.default.unregisterFd(vsockFd)
+                try? ProcessSupervisor.default.unregisterFd(udpFd)
+                close(udpFd)
+                try? conn.close()
+                if let error {
+                    c.resume(throwing: error)
+                } else {
+                    c.resume()
+                }
+            }
+            let cleanup = { @Sendable in finish(nil) }
+
+            // Host -> guest: unframe each datagram and send it to the service.
+            do {
+                try ProcessSupervisor.default.registerFd(vsockFd, mask: [.input, .output]) { mask in
+                    if mask.readyToRead {
+                        while !done {
+                            let n = buffer.withUnsafeMutableBytes { read(vsockFd, $0.baseAddress, $0.count) }
+                            if n < 0 && errno == EINTR {
+                                continue
+                            }
+                            if n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK) {
+                                break
+                            }
+                            guard n > 0 else {
+                                return cleanup()
+                            }
+                            buffer.withUnsafeBytes { decoder.append(UnsafeRawBufferPointer(rebasing: $0[0..<n])) }
+                            while let datagram = decoder.next() {
+                                // A refused or full UDP send loses the datagram, nothing more.
+                                _ = datagram.withUnsafeBytes { send(udpFd, $0.baseAddress, $0.count, Int32(MSG_DONTWAIT)) }
+                            }
+                        }
+                    }
+                    if mask.readyToWrite && !done && !encoder.flush(to: vsockFd) {
+                        return cleanup()
+                    }
+                    if mask.isHangup {
+                        return cleanup()
+                    }
+                }
+            } catch {
+                return finish(error)
+            }
+
+            // Guest -> host: frame each reply from the service onto the vsock stream.
+            do {
+                try ProcessSupervisor.default.registerFd(udpFd, mask: [.input]) { mask in
+                    guard mask.readyToRead, !done else {
+                        return
+                    }
+                    while true {
+                        let n = buffer.withUnsafeMutableBytes { recv(udpFd, $0.baseAddress, $0.count, Int32(MSG_DONTWAIT)) }
+                        if n < 0 {
+                            // ECONNREFUSED reports an earlier send to a closed port; keep draining.
+                            if errno == EINTR || errno == ECONNREFUSED { continue }
+                            break
+                        }
+                        _ = buffer.withUnsafeBytes { encoder.enqueue(UnsafeRawBufferPointer(rebasing: $0[0..<n])) }
+                    }
+                    if !encoder.flush(to: vsockFd) {
+                        return cleanup()
+                    }
+                }
+            } catch {
+                return finish(error)
+            }
+        }
+    }
+
     private static func transferData(
         fromFile: inout OSFile.SpliceFile,
         toFile: inout OSFile.SpliceFile,
@@ -47,9 +47,14 @@ struct Application: AsyncParsableCommand {
             return
         }
 
+        // The guest's monotonic clock starts at zero when the kernel boots,
+        // so everything up to here is kernel and initramfs time.
+        let entered = GuestBootTrace.now()
+        GuestBootTrace.record("kernel", start: 0, end: entered)
+
         // Swift has issues spawning threads if /proc isn't mounted,
         // so we do this synchronously before any async code runs.
-        try mountProc()
+        try GuestBootTrace.span("mountProc") { try mountProc() }
 
         // When running as PID 1 with a Musl-static build, Swift's runtime
         // captures argc/argv as empty. Recover argv from /proc/self/cmdline.